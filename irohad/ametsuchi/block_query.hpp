@@ -7,6 +7,7 @@
 #define IROHA_BLOCK_QUERY_HPP
 
 #include <optional>
+#include <vector>
 
 #include "ametsuchi/tx_cache_response.hpp"
 #include "common/result_fwd.hpp"
@@ -64,6 +65,16 @@ namespace iroha {
        */
       virtual std::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) = 0;
+
+      /**
+       * Synchronously checks whether transactions with given hashes are
+       * present in any block with a single storage request
+       * @param hashes - transactions' hashes
+       * @return statuses of transactions in the order of given hashes if
+       * storage query was successful, null otherwise
+       */
+      virtual std::optional<std::vector<TxCacheStatusType>> checkTxPresence(
+          const std::vector<shared_model::crypto::Hash> &hashes) = 0;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -15,6 +15,7 @@
 #include <iostream>
 #include <sstream>
 
+#include "ametsuchi/impl/mapped_file.hpp"
 #include "common/files.hpp"
 #include "common/result.hpp"
 #include "logger/logger.hpp"
@@ -77,52 +78,21 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
     log_->warn("insertion for {} failed, because file already exists", id);
     return false;
   }
-  // New file will be created
-  boost::iostreams::stream<boost::iostreams::file_descriptor_sink> file;
-  try {
-    file.open(tmp_file_name, std::ofstream::binary);
-  } catch (std::ios_base::failure const &e) {
-    log_->warn("Cannot open file by index {} for writing: {}", id, e.what());
-    return false;
-  }
-  if (not file.is_open()) {
-    log_->warn("Cannot open file by index {} for writing", id);
-    return false;
-  }
 
-  auto val_size =
-      sizeof(std::remove_reference<decltype(block)>::type::value_type);
-
-  if (not file.write(reinterpret_cast<const char *>(block.data()),
-                     block.size() * val_size)) {
-    log_->warn("Cannot write file by index {}", id);
-    return false;
-  }
-
-  if (not file.flush()) {
-    log_->warn("Cannot flush file by index {}", id);
+  if (not write(id, block)) {
     return false;
   }
 
-#ifdef _WIN32
-  if (not FlushFileBuffers(file->handle())) {
-#else
-  if (fsync(file->handle())) {
-#endif
-    log_->warn("Cannot fsync file by index {}", id);
-    return false;
-  }
+  available_blocks_.insert(id);
+  return true;
+}
 
-  boost::system::error_code error_code;
-  boost::filesystem::rename(tmp_file_name, file_name, error_code);
-  if (error_code != boost::system::errc::success) {
-    log_->error(
-        "insertion for {} failed, because {}", id, error_code.message());
+bool FlatFile::replace(Identifier id, const Bytes &block) {
+  if (available_blocks_.count(id) == 0) {
+    log_->warn("replacement for {} failed, because file does not exist", id);
     return false;
   }
-
-  available_blocks_.insert(id);
-  return true;
+  return write(id, block);
 }
 
 boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
@@ -136,6 +106,22 @@ boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
       iroha::readBinaryFile(filename.string()));
 }
 
+boost::optional<FlatFile::BytesView> FlatFile::getView(Identifier id) const {
+  const auto filename =
+      boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
+  return MappedFile::open(filename.string())
+      .match(
+          [](auto &&mapping) -> boost::optional<BytesView> {
+            const auto *data = mapping.value->data();
+            const auto size = mapping.value->size();
+            return BytesView{std::move(mapping.value), data, size};
+          },
+          [&](const auto &error) -> boost::optional<BytesView> {
+            log_->info("getView({}) {}", id, error.error);
+            return boost::none;
+          });
+}
+
 std::string FlatFile::directory() const {
   return dump_dir_;
 }
@@ -144,6 +130,17 @@ Identifier FlatFile::last_id() const {
   return (available_blocks_.empty()) ? 0 : *available_blocks_.rbegin();
 }
 
+iroha::expected::Result<void, std::string> FlatFile::forEachIdentifier(
+    IdentifierFunction function) const {
+  for (auto id : available_blocks_) {
+    auto maybe_error = function(id);
+    if (iroha::expected::hasError(maybe_error)) {
+      return maybe_error;
+    }
+  }
+  return {};
+}
+
 void FlatFile::reload() {
   available_blocks_.clear();
   for (auto it = boost::filesystem::directory_iterator{dump_dir_};
@@ -173,6 +170,57 @@ const BlockIdCollectionType &FlatFile::blockIdentifiers() const {
 
 // ----------| private API |----------
 
+bool FlatFile::write(Identifier id, const Bytes &block) {
+  const auto tmp_file_name = boost::filesystem::path{dump_dir_}
+      / (id_to_name(id) + kTempFileExtension);
+  const auto file_name = boost::filesystem::path{dump_dir_} / id_to_name(id);
+
+  // New file will be created
+  boost::iostreams::stream<boost::iostreams::file_descriptor_sink> file;
+  try {
+    file.open(tmp_file_name, std::ofstream::binary);
+  } catch (std::ios_base::failure const &e) {
+    log_->warn("Cannot open file by index {} for writing: {}", id, e.what());
+    return false;
+  }
+  if (not file.is_open()) {
+    log_->warn("Cannot open file by index {} for writing", id);
+    return false;
+  }
+
+  auto val_size =
+      sizeof(std::remove_reference<decltype(block)>::type::value_type);
+
+  if (not file.write(reinterpret_cast<const char *>(block.data()),
+                     block.size() * val_size)) {
+    log_->warn("Cannot write file by index {}", id);
+    return false;
+  }
+
+  if (not file.flush()) {
+    log_->warn("Cannot flush file by index {}", id);
+    return false;
+  }
+
+#ifdef _WIN32
+  if (not FlushFileBuffers(file->handle())) {
+#else
+  if (fsync(file->handle())) {
+#endif
+    log_->warn("Cannot fsync file by index {}", id);
+    return false;
+  }
+
+  boost::system::error_code error_code;
+  boost::filesystem::rename(tmp_file_name, file_name, error_code);
+  if (error_code != boost::system::errc::success) {
+    log_->error(
+        "insertion for {} failed, because {}", id, error_code.message());
+    return false;
+  }
+  return true;
+}
+
 FlatFile::FlatFile(std::string path,
                    FlatFile::private_tag,
                    logger::LoggerPtr log)
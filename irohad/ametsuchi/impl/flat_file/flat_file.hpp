@@ -70,12 +70,19 @@ namespace iroha {
 
       bool add(Identifier id, const Bytes &blob) override;
 
+      bool replace(Identifier id, const Bytes &blob) override;
+
       boost::optional<Bytes> get(Identifier id) const override;
 
+      boost::optional<BytesView> getView(Identifier id) const override;
+
       std::string directory() const override;
 
       Identifier last_id() const override;
 
+      expected::Result<void, std::string> forEachIdentifier(
+          IdentifierFunction function) const override;
+
       void reload() override;
 
       void dropAll() override;
@@ -107,6 +114,15 @@ namespace iroha {
                logger::LoggerPtr log);
 
      private:
+      /**
+       * Write blob to a temporary file, fsync it and rename it to the file
+       * for the given id
+       * @param id - reference key
+       * @param blob - data to write
+       * @return true on success
+       */
+      bool write(Identifier id, const Bytes &blob);
+
       /**
        * Folder of storage
        */
@@ -0,0 +1,153 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/flat_file_block_codec.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include <fmt/core.h>
+#include <boost/crc.hpp>
+#include "backend/protobuf/block.hpp"
+#include "common/byteutils.hpp"
+#include "common/result.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  constexpr std::array<uint8_t, 4> kBinaryMagic{'I', 'R', 'B', 'K'};
+  constexpr size_t kVersionOffset = 4;
+  constexpr size_t kFlagsOffset = 5;
+  constexpr size_t kLengthOffset = 8;
+  constexpr size_t kChecksumOffset = 12;
+
+  void writeUint32(FlatFileBlockCodec::Bytes &dest,
+                   size_t offset,
+                   uint32_t value) {
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      dest[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  }
+
+  uint32_t readUint32(const uint8_t *src, size_t offset) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      value |= static_cast<uint32_t>(src[offset + i]) << (8 * i);
+    }
+    return value;
+  }
+
+  uint32_t checksum(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+}  // namespace
+
+std::optional<FlatFileBlockFormat> iroha::ametsuchi::
+    flatFileBlockFormatFromString(std::string_view name) {
+  if (name == "json") {
+    return FlatFileBlockFormat::kJson;
+  }
+  if (name == "binary") {
+    return FlatFileBlockFormat::kBinary;
+  }
+  return std::nullopt;
+}
+
+FlatFileBlockCodec::FlatFileBlockCodec(
+    FlatFileBlockFormat write_format,
+    std::shared_ptr<shared_model::interface::BlockJsonConverter>
+        json_converter,
+    bool checksum_payload)
+    : write_format_(write_format),
+      json_converter_(std::move(json_converter)),
+      checksum_payload_(checksum_payload) {}
+
+FlatFileBlockFormat FlatFileBlockCodec::writeFormat() const {
+  return write_format_;
+}
+
+iroha::expected::Result<FlatFileBlockCodec::Bytes, std::string>
+FlatFileBlockCodec::encode(const shared_model::interface::Block &block) const {
+  if (write_format_ == FlatFileBlockFormat::kJson) {
+    return json_converter_->serialize(block) |
+        [](const auto &block_json) { return stringToBytes(block_json); };
+  }
+
+  // blob of a block is the serialized iroha::protocol::Block_v1
+  const auto &payload = block.blob().blob();
+  Bytes result(kBinaryHeaderSize + payload.size(), 0);
+  std::copy(kBinaryMagic.begin(), kBinaryMagic.end(), result.begin());
+  result[kVersionOffset] = kBinaryFormatVersion;
+  writeUint32(result, kLengthOffset, static_cast<uint32_t>(payload.size()));
+  if (checksum_payload_) {
+    writeUint32(
+        result, kChecksumOffset, checksum(payload.data(), payload.size()));
+  } else {
+    result[kFlagsOffset] = kNoChecksumFlag;
+  }
+  std::copy(payload.begin(),
+            payload.end(),
+            result.begin() + static_cast<std::ptrdiff_t>(kBinaryHeaderSize));
+  return result;
+}
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+FlatFileBlockCodec::decode(const Bytes &data) const {
+  return decode(data.data(), data.size());
+}
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+FlatFileBlockCodec::decode(const uint8_t *data, size_t size) const {
+  if (detectFormat(data, size) == FlatFileBlockFormat::kJson) {
+    return json_converter_->deserialize(
+        std::string(reinterpret_cast<const char *>(data), size));
+  }
+
+  // version 1 differs only by the flags, which are always zero in it
+  if (data[kVersionOffset] == 0
+      or data[kVersionOffset] > kBinaryFormatVersion) {
+    return fmt::format("Unsupported binary block format version {}",
+                       data[kVersionOffset]);
+  }
+  const auto payload_size = readUint32(data, kLengthOffset);
+  if (payload_size != size - kBinaryHeaderSize) {
+    return fmt::format("Block payload length mismatch: header {}, actual {}",
+                       payload_size,
+                       size - kBinaryHeaderSize);
+  }
+  const auto *payload = data + kBinaryHeaderSize;
+  if (checksum_payload_ and not(data[kFlagsOffset] & kNoChecksumFlag)
+      and readUint32(data, kChecksumOffset)
+          != checksum(payload, payload_size)) {
+    return "Block payload checksum mismatch";
+  }
+
+  iroha::protocol::Block_v1 block;
+  if (not block.ParseFromArray(payload, static_cast<int>(payload_size))) {
+    return "Failed to parse block payload";
+  }
+  return expected::makeValue<std::unique_ptr<shared_model::interface::Block>>(
+      std::make_unique<shared_model::proto::Block>(
+          std::move(block),
+          shared_model::interface::types::ByteRange(
+              reinterpret_cast<const std::byte *>(payload), payload_size)));
+}
+
+FlatFileBlockFormat FlatFileBlockCodec::detectFormat(const Bytes &data) {
+  return detectFormat(data.data(), data.size());
+}
+
+FlatFileBlockFormat FlatFileBlockCodec::detectFormat(const uint8_t *data,
+                                                     size_t size) {
+  if (size >= kBinaryHeaderSize
+      and std::equal(kBinaryMagic.begin(), kBinaryMagic.end(), data)) {
+    return FlatFileBlockFormat::kBinary;
+  }
+  return FlatFileBlockFormat::kJson;
+}
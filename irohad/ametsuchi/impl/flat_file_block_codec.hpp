@@ -0,0 +1,133 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FLAT_FILE_BLOCK_CODEC_HPP
+#define IROHA_FLAT_FILE_BLOCK_CODEC_HPP
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "ametsuchi/key_value_storage.hpp"
+#include "common/result_fwd.hpp"
+#include "interfaces/iroha_internal/block_json_converter.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * On-disk representation of a single block in flat file storage
+     */
+    enum class FlatFileBlockFormat {
+      /// protobuf JSON text of iroha::protocol::Block
+      kJson,
+      /// serialized iroha::protocol::Block_v1 prefixed with a binary header
+      kBinary
+    };
+
+    /**
+     * Parse block format name as specified in the configuration
+     * @param name - "json" or "binary"
+     * @return the format or std::nullopt if the name is unknown
+     */
+    std::optional<FlatFileBlockFormat> flatFileBlockFormatFromString(
+        std::string_view name);
+
+    /**
+     * Encodes blocks to the configured on-disk format and decodes blocks
+     * stored in any of the supported formats, so that a storage can be
+     * migrated between formats without downtime.
+     *
+     * Binary format layout (all integers are little-endian):
+     *   bytes [0, 4)   - magic "IRBK"
+     *   byte  4        - format version
+     *   byte  5        - flags, kNoChecksumFlag if the CRC is omitted
+     *   bytes [6, 8)   - reserved, zero
+     *   bytes [8, 12)  - payload length
+     *   bytes [12, 16) - CRC-32 of payload, zero if omitted
+     *   bytes [16, ..) - payload: serialized iroha::protocol::Block_v1
+     *
+     * Storages which checksum their records themselves use a codec without
+     * payload checksums, so that every block is checked only once.
+     */
+    class FlatFileBlockCodec {
+     public:
+      using Bytes = KeyValueStorage::Bytes;
+
+      static constexpr size_t kBinaryHeaderSize = 16;
+      static constexpr uint8_t kBinaryFormatVersion = 2;
+      static constexpr uint8_t kNoChecksumFlag = 1;
+
+      /**
+       * @param write_format - format used by encode
+       * @param json_converter - converter of JSON blocks
+       * @param checksum_payload - whether binary payloads are written with
+       * CRC-32 and the stored CRC-32 is verified on decode
+       */
+      FlatFileBlockCodec(
+          FlatFileBlockFormat write_format,
+          std::shared_ptr<shared_model::interface::BlockJsonConverter>
+              json_converter,
+          bool checksum_payload = true);
+
+      /**
+       * @return the format used by encode
+       */
+      FlatFileBlockFormat writeFormat() const;
+
+      /**
+       * Serialize block to the write format
+       * @param block - block to serialize
+       * @return bytes to be stored or an error
+       */
+      expected::Result<Bytes, std::string> encode(
+          const shared_model::interface::Block &block) const;
+
+      /**
+       * Deserialize block stored in any of the supported formats
+       * @param data - stored bytes
+       * @return block or an error
+       */
+      expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                       std::string>
+      decode(const Bytes &data) const;
+
+      /**
+       * Deserialize block stored in any of the supported formats. Binary
+       * blocks keep the stored payload as their blob, so the bytes are
+       * copied once and never serialized again.
+       * @param data - stored bytes
+       * @param size - number of stored bytes
+       * @return block or an error
+       */
+      expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                       std::string>
+      decode(const uint8_t *data, size_t size) const;
+
+      /**
+       * Detect format of stored bytes. Anything without a binary header is
+       * considered to be JSON.
+       */
+      static FlatFileBlockFormat detectFormat(const Bytes &data);
+
+      static FlatFileBlockFormat detectFormat(const uint8_t *data, size_t size);
+
+     private:
+      FlatFileBlockFormat write_format_;
+      std::shared_ptr<shared_model::interface::BlockJsonConverter>
+          json_converter_;
+      bool checksum_payload_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_FLAT_FILE_BLOCK_CODEC_HPP
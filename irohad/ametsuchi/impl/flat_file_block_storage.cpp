@@ -8,25 +8,23 @@
 #include <boost/filesystem.hpp>
 
 #include "backend/protobuf/block.hpp"
-#include "common/byteutils.hpp"
 #include "logger/logger.hpp"
 
 using namespace iroha::ametsuchi;
 
 FlatFileBlockStorage::FlatFileBlockStorage(
-    std::unique_ptr<FlatFile> flat_file,
-    std::shared_ptr<shared_model::interface::BlockJsonConverter> json_converter,
+    std::unique_ptr<KeyValueStorage> flat_file,
+    FlatFileBlockCodec codec,
     logger::LoggerPtr log)
     : flat_file_storage_(std::move(flat_file)),
-      json_converter_(std::move(json_converter)),
+      codec_(std::move(codec)),
       log_(std::move(log)) {}
 
 bool FlatFileBlockStorage::insert(
     std::shared_ptr<const shared_model::interface::Block> block) {
-  return json_converter_->serialize(*block).match(
-      [&](const auto &block_json) {
-        return flat_file_storage_->add(block->height(),
-                                       stringToBytes(block_json.value));
+  return codec_.encode(*block).match(
+      [&](const auto &block_data) {
+        return flat_file_storage_->add(block->height(), block_data.value);
       },
       [this](const auto &error) {
         log_->warn("Error while block serialization: {}", error.error);
@@ -37,12 +35,13 @@ bool FlatFileBlockStorage::insert(
 boost::optional<std::unique_ptr<shared_model::interface::Block>>
 FlatFileBlockStorage::fetch(
     shared_model::interface::types::HeightType height) const {
-  auto storage_block = flat_file_storage_->get(height);
+  // the view keeps the stored bytes mapped only until the block is decoded
+  auto storage_block = flat_file_storage_->getView(height);
   if (not storage_block) {
     return boost::none;
   }
 
-  return json_converter_->deserialize(bytesToString(*storage_block))
+  return codec_.decode(storage_block->data, storage_block->size)
       .match(
           [&](auto &&block) {
             return boost::make_optional<
@@ -71,16 +70,47 @@ void FlatFileBlockStorage::clear() {
 
 iroha::expected::Result<void, std::string> FlatFileBlockStorage::forEach(
     iroha::ametsuchi::BlockStorage::FunctionType function) const {
-  for (auto block_id : flat_file_storage_->blockIdentifiers()) {
-    auto maybe_block = fetch(block_id);
-    if (maybe_block) {
-      auto maybe_error = function(std::move(maybe_block).value());
-      if (iroha::expected::hasError(maybe_error)) {
-        return maybe_error.assumeError();
-      }
-    } else {
-      return fmt::format("Failed to fetch block {}", block_id);
-    }
-  }
-  return {};
+  return flat_file_storage_->forEachIdentifier(
+      [this, &function](
+          auto block_id) -> iroha::expected::Result<void, std::string> {
+        auto maybe_block = fetch(block_id);
+        if (not maybe_block) {
+          return fmt::format("Failed to fetch block {}", block_id);
+        }
+        return function(std::move(maybe_block).value());
+      });
+}
+
+iroha::expected::Result<size_t, std::string>
+FlatFileBlockStorage::convertToWriteFormat() {
+  size_t converted = 0;
+  auto result = flat_file_storage_->forEachIdentifier(
+      [this, &converted](
+          auto block_id) -> iroha::expected::Result<void, std::string> {
+        auto storage_block = flat_file_storage_->get(block_id);
+        if (not storage_block) {
+          return fmt::format("Failed to read block {}", block_id);
+        }
+        if (FlatFileBlockCodec::detectFormat(*storage_block)
+            == codec_.writeFormat()) {
+          return {};
+        }
+
+        auto converted_block = codec_.decode(*storage_block) |
+            [this](auto &&block) { return codec_.encode(*block); };
+        if (auto error = expected::resultToOptionalError(converted_block)) {
+          return fmt::format(
+              "Failed to convert block {}: {}", block_id, error.value());
+        }
+        if (not flat_file_storage_->replace(block_id,
+                                            converted_block.assumeValue())) {
+          return fmt::format("Failed to write converted block {}", block_id);
+        }
+        ++converted;
+        return {};
+      });
+  return std::move(result) | [&] {
+    log_->info("Converted {} blocks", converted);
+    return converted;
+  };
 }
@@ -8,19 +8,17 @@
 
 #include "ametsuchi/block_storage.hpp"
 
-#include "ametsuchi/impl/flat_file/flat_file.hpp"
-#include "interfaces/iroha_internal/block_json_converter.hpp"
+#include "ametsuchi/impl/flat_file_block_codec.hpp"
+#include "ametsuchi/key_value_storage.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ametsuchi {
     class FlatFileBlockStorage : public BlockStorage {
      public:
-      FlatFileBlockStorage(
-          std::unique_ptr<FlatFile> flat_file,
-          std::shared_ptr<shared_model::interface::BlockJsonConverter>
-              json_converter,
-          logger::LoggerPtr log);
+      FlatFileBlockStorage(std::unique_ptr<KeyValueStorage> flat_file,
+                           FlatFileBlockCodec codec,
+                           logger::LoggerPtr log);
 
       bool insert(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -37,10 +35,17 @@ namespace iroha {
       expected::Result<void, std::string> forEach(
           FunctionType function) const override;
 
+      /**
+       * Rewrite every stored block which is not in the write format of the
+       * codec. Each block is replaced atomically, so the storage stays
+       * readable if the conversion is interrupted.
+       * @return number of converted blocks or an error
+       */
+      expected::Result<size_t, std::string> convertToWriteFormat();
+
      private:
-      std::unique_ptr<FlatFile> flat_file_storage_;
-      std::shared_ptr<shared_model::interface::BlockJsonConverter>
-          json_converter_;
+      std::unique_ptr<KeyValueStorage> flat_file_storage_;
+      FlatFileBlockCodec codec_;
       logger::LoggerPtr log_;
     };
   }  // namespace ametsuchi
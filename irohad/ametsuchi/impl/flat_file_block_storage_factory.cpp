@@ -6,6 +6,7 @@
 #include "ametsuchi/impl/flat_file_block_storage_factory.hpp"
 
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
+#include "common/result.hpp"
 
 using namespace iroha::ametsuchi;
 
@@ -13,19 +14,24 @@ FlatFileBlockStorageFactory::FlatFileBlockStorageFactory(
     std::function<std::string()> path_provider,
     std::shared_ptr<shared_model::interface::BlockJsonConverter>
         json_block_converter,
+    FlatFileBlockFormat block_format,
+    KeyValueStorageType storage_type,
     logger::LoggerManagerTreePtr log_manager)
     : path_provider_(std::move(path_provider)),
       json_block_converter_(std::move(json_block_converter)),
+      block_format_(block_format),
+      storage_type_(storage_type),
       log_manager_(std::move(log_manager)) {}
 
 iroha::expected::Result<std::unique_ptr<BlockStorage>, std::string>
 FlatFileBlockStorageFactory::create() {
-  return FlatFile::create(path_provider_(),
-                          log_manager_->getChild("FlatFile")->getLogger())
+  return createKeyValueStorage(storage_type_, path_provider_(), log_manager_)
       | [this](auto &&flat_file) {
           return std::make_unique<FlatFileBlockStorage>(
               std::move(flat_file),
-              json_block_converter_,
+              FlatFileBlockCodec(block_format_,
+                                 json_block_converter_,
+                                 not checksumsRecords(storage_type_)),
               log_manager_->getChild("FlatFileBlockFactory")->getLogger());
         };
 }
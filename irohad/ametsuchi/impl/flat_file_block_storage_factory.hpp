@@ -8,6 +8,8 @@
 
 #include "ametsuchi/block_storage_factory.hpp"
 
+#include "ametsuchi/impl/flat_file_block_codec.hpp"
+#include "ametsuchi/impl/key_value_storage_factory.hpp"
 #include "interfaces/iroha_internal/block_json_converter.hpp"
 #include "logger/logger_manager.hpp"
 
@@ -19,6 +21,8 @@ namespace iroha {
           std::function<std::string()> path_provider,
           std::shared_ptr<shared_model::interface::BlockJsonConverter>
               json_block_converter,
+          FlatFileBlockFormat block_format,
+          KeyValueStorageType storage_type,
           logger::LoggerManagerTreePtr log_manager);
 
       iroha::expected::Result<std::unique_ptr<BlockStorage>, std::string>
@@ -28,6 +32,8 @@ namespace iroha {
       std::function<std::string()> path_provider_;
       std::shared_ptr<shared_model::interface::BlockJsonConverter>
           json_block_converter_;
+      FlatFileBlockFormat block_format_;
+      KeyValueStorageType storage_type_;
       logger::LoggerManagerTreePtr log_manager_;
     };
   }  // namespace ametsuchi
@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/key_value_storage_factory.hpp"
+
+#include <algorithm>
+
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+#include "common/result.hpp"
+#include "logger/logger_manager.hpp"
+
+using namespace iroha::ametsuchi;
+
+std::optional<KeyValueStorageType> iroha::ametsuchi::
+    keyValueStorageTypeFromString(std::string_view name) {
+  if (name == "files") {
+    return KeyValueStorageType::kFilePerBlock;
+  }
+  if (name == "segmented") {
+    return KeyValueStorageType::kSegmentedLog;
+  }
+  return std::nullopt;
+}
+
+bool iroha::ametsuchi::checksumsRecords(KeyValueStorageType type) {
+  return type == KeyValueStorageType::kSegmentedLog;
+}
+
+iroha::expected::Result<std::unique_ptr<KeyValueStorage>, std::string>
+iroha::ametsuchi::createKeyValueStorage(
+    KeyValueStorageType type,
+    const std::string &path,
+    logger::LoggerManagerTreePtr log_manager,
+    size_t sync_batch_size) {
+  switch (type) {
+    case KeyValueStorageType::kFilePerBlock:
+      return FlatFile::create(path,
+                              log_manager->getChild("FlatFile")->getLogger());
+    case KeyValueStorageType::kSegmentedLog: {
+      auto options = SegmentedLog::kDefaultOptions;
+      options.sync_batch_size = std::max<size_t>(sync_batch_size, 1);
+      return SegmentedLog::create(
+          path, options, log_manager->getChild("SegmentedLog")->getLogger());
+    }
+  }
+  return "Unknown key value storage type";
+}
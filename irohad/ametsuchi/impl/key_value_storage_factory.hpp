@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_KEY_VALUE_STORAGE_FACTORY_HPP
+#define IROHA_KEY_VALUE_STORAGE_FACTORY_HPP
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "ametsuchi/key_value_storage.hpp"
+#include "common/result_fwd.hpp"
+#include "logger/logger_manager_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Layout of the block storage directory
+     */
+    enum class KeyValueStorageType {
+      /// a file per block, see FlatFile
+      kFilePerBlock,
+      /// blocks appended to segment files, see SegmentedLog
+      kSegmentedLog
+    };
+
+    /**
+     * Parse storage type name as specified in the configuration
+     * @param name - "files" or "segmented"
+     * @return the type or std::nullopt if the name is unknown
+     */
+    std::optional<KeyValueStorageType> keyValueStorageTypeFromString(
+        std::string_view name);
+
+    /**
+     * @param type - storage type
+     * @return true if the storage verifies its records with checksums, so
+     * that the stored data does not need its own ones
+     */
+    bool checksumsRecords(KeyValueStorageType type);
+
+    /**
+     * Create key value storage of the given type in path
+     * @param type - storage type
+     * @param path - storage directory
+     * @param log_manager - log manager for the storage
+     * @param sync_batch_size - number of records written to a segmented log
+     * per fsync. Records which are not synced yet may be lost on a crash of
+     * the host even though they were added successfully. Every block file is
+     * synced when the storage is a file per block
+     * @return created storage or an error
+     */
+    expected::Result<std::unique_ptr<KeyValueStorage>, std::string>
+    createKeyValueStorage(KeyValueStorageType type,
+                          const std::string &path,
+                          logger::LoggerManagerTreePtr log_manager,
+                          size_t sync_batch_size = 1);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_KEY_VALUE_STORAGE_FACTORY_HPP
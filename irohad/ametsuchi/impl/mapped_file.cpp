@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+#include <fmt/core.h>
+#include "common/result.hpp"
+
+using namespace iroha::ametsuchi;
+
+iroha::expected::Result<std::shared_ptr<const MappedFile>, std::string>
+MappedFile::open(const std::string &path) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    return fmt::format("Cannot open {}: {}", path, std::strerror(errno));
+  }
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0) {
+    auto error = fmt::format("Cannot stat {}: {}", path, std::strerror(errno));
+    ::close(fd);
+    return error;
+  }
+  auto result = map(fd, static_cast<size_t>(file_stat.st_size));
+  ::close(fd);
+  return result;
+}
+
+iroha::expected::Result<std::shared_ptr<const MappedFile>, std::string>
+MappedFile::map(int fd, size_t size) {
+  if (size == 0) {
+    // mmap does not accept empty ranges
+    return std::make_shared<const MappedFile>(nullptr, 0, private_tag{});
+  }
+  void *data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) {
+    return fmt::format("Cannot map {} bytes: {}", size, std::strerror(errno));
+  }
+  return std::make_shared<const MappedFile>(data, size, private_tag{});
+}
+
+MappedFile::MappedFile(const void *data, size_t size, private_tag)
+    : data_(data), size_(size) {}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<void *>(data_), size_);
+  }
+}
+
+const uint8_t *MappedFile::data() const {
+  return static_cast<const uint8_t *>(data_);
+}
+
+size_t MappedFile::size() const {
+  return size_;
+}
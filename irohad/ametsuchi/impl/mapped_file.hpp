@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MAPPED_FILE_HPP
+#define IROHA_MAPPED_FILE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "common/result_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Read-only memory mapping of a file. The mapping stays valid after the
+     * file is renamed over or removed, until the object is destroyed.
+     */
+    class MappedFile {
+      struct private_tag {};
+
+     public:
+      /**
+       * Map the whole file
+       * @param path - path to the file
+       * @return mapping or an error
+       */
+      static expected::Result<std::shared_ptr<const MappedFile>, std::string>
+      open(const std::string &path);
+
+      /**
+       * Map first size bytes of an open file
+       * @param fd - file descriptor opened for reading, remains owned by the
+       * caller
+       * @param size - number of bytes to map, must not exceed the file size
+       * @return mapping or an error
+       */
+      static expected::Result<std::shared_ptr<const MappedFile>, std::string>
+      map(int fd, size_t size);
+
+      MappedFile(const void *data, size_t size, private_tag);
+
+      MappedFile(const MappedFile &) = delete;
+      MappedFile &operator=(const MappedFile &) = delete;
+
+      ~MappedFile();
+
+      const uint8_t *data() const;
+
+      size_t size() const;
+
+     private:
+      const void *data_;
+      size_t size_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_MAPPED_FILE_HPP
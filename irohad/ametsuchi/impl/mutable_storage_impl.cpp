@@ -22,6 +22,12 @@
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
+#include "main/impl/pg_connection_init.hpp"
+
+namespace {
+  /// Number of blocks which index is loaded at once in bulk load mode
+  constexpr size_t kBulkLoadBlocksPerFlush = 1000;
+}  // namespace
 
 namespace iroha {
   namespace ametsuchi {
@@ -29,7 +35,9 @@ namespace iroha {
         boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state,
         std::shared_ptr<PostgresCommandExecutor> command_executor,
         std::unique_ptr<BlockStorage> block_storage,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        std::shared_ptr<TxHashFilter> tx_hash_filter,
+        bool bulk_load)
         : ledger_state_(std::move(ledger_state)),
           sql_(command_executor->getSession()),
           wsv_command_(std::make_unique<PostgresWsvCommand>(sql_)),
@@ -37,11 +45,14 @@ namespace iroha {
               std::make_unique<PeerQueryWsv>(std::make_shared<PostgresWsvQuery>(
                   sql_, log_manager->getChild("WsvQuery")->getLogger()))),
           block_index_(std::make_unique<PostgresBlockIndex>(
-              std::make_unique<PostgresIndexer>(sql_),
-              log_manager->getChild("PostgresBlockIndex")->getLogger())),
+              std::make_unique<PostgresIndexer>(sql_,
+                                                std::move(tx_hash_filter)),
+              log_manager->getChild("PostgresBlockIndex")->getLogger(),
+              bulk_load ? kBulkLoadBlocksPerFlush : 1)),
           transaction_executor_(std::make_unique<TransactionExecutor>(
               std::move(command_executor))),
           block_storage_(std::move(block_storage)),
+          bulk_load_(bulk_load),
           committed(false),
           log_(log_manager->getLogger()) {
       sql_ << "BEGIN";
@@ -78,7 +89,6 @@ namespace iroha {
         }
 
         block_storage_->insert(block);
-        block_index_->index(*block);
 
         auto opt_ledger_peers = peer_query_->getLedgerPeers();
         if (not opt_ledger_peers) {
@@ -86,6 +96,10 @@ namespace iroha {
           return false;
         }
 
+        // the index may be kept in memory until commit, so the block must not
+        // be rolled back after indexing
+        block_index_->index(*block);
+
         ledger_state_ = std::make_shared<const LedgerState>(
             std::move(*opt_ledger_peers), block->height(), block->hash());
       }
@@ -152,6 +166,15 @@ namespace iroha {
         assert(ledger_state_);
         return "Tried to commit mutable storage with no blocks applied.";
       }
+      if (auto e = expected::resultToOptionalError(block_index_->flush())) {
+        return fmt::format("Failed to flush block index: {}", e.value());
+      }
+      if (bulk_load_) {
+        if (auto e = expected::resultToOptionalError(
+                PgConnectionInit::createTransactionIndices(sql_))) {
+          return e.value();
+        }
+      }
       return block_storage_->forEach(
                  [&block_storage](
                      auto const &block) -> expected::Result<void, std::string> {
@@ -17,22 +17,32 @@
 
 namespace iroha {
   namespace ametsuchi {
-    class BlockIndex;
     class PeerQuery;
+    class PostgresBlockIndex;
     class PostgresCommandExecutor;
     class PostgresWsvCommand;
     class TransactionExecutor;
+    class TxHashFilter;
 
     class MutableStorageImpl : public MutableStorage {
       friend class StorageImpl;
 
      public:
+      /**
+       * @param tx_hash_filter - filter of known transaction hashes which is
+       * updated with hashes of applied blocks, optional
+       * @param bulk_load - whether the index of applied blocks is loaded in
+       * large chunks, which requires secondary indices of transaction tables
+       * to be dropped before and recreated on commit
+       */
       MutableStorageImpl(
           boost::optional<std::shared_ptr<const iroha::LedgerState>>
               ledger_state,
           std::shared_ptr<PostgresCommandExecutor> command_executor,
           std::unique_ptr<BlockStorage> block_storage,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          std::shared_ptr<TxHashFilter> tx_hash_filter = nullptr,
+          bool bulk_load = false);
 
       bool apply(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -71,10 +81,11 @@ namespace iroha {
       soci::session &sql_;
       std::unique_ptr<PostgresWsvCommand> wsv_command_;
       std::unique_ptr<PeerQuery> peer_query_;
-      std::unique_ptr<BlockIndex> block_index_;
+      std::unique_ptr<PostgresBlockIndex> block_index_;
       std::shared_ptr<TransactionExecutor> transaction_executor_;
       std::unique_ptr<BlockStorage> block_storage_;
 
+      bool bulk_load_;
       bool committed;
 
       logger::LoggerPtr log_;
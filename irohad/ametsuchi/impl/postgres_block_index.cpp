@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/postgres_block_index.hpp"
 
+#include <algorithm>
+
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/transformed.hpp>
@@ -68,8 +70,11 @@ void PostgresBlockIndex::makeAccountAssetIndex(
 }
 
 PostgresBlockIndex::PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
-                                       logger::LoggerPtr log)
-    : indexer_(std::move(indexer)), log_(std::move(log)) {}
+                                       logger::LoggerPtr log,
+                                       size_t blocks_per_flush)
+    : indexer_(std::move(indexer)),
+      blocks_per_flush_(std::max<size_t>(blocks_per_flush, 1)),
+      log_(std::move(log)) {}
 
 void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
   auto height = block.height();
@@ -94,7 +99,15 @@ void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
     indexer_->rejectedTxHash(rejected_tx_hash);
   }
 
-  if (auto e = resultToOptionalError(indexer_->flush())) {
+  if (++unflushed_blocks_ < blocks_per_flush_) {
+    return;
+  }
+  if (auto e = resultToOptionalError(flush())) {
     log_->error(e.value());
   }
 }
+
+iroha::expected::Result<void, std::string> PostgresBlockIndex::flush() {
+  unflushed_blocks_ = 0;
+  return indexer_->flush();
+}
@@ -29,12 +29,22 @@ namespace iroha {
      */
     class PostgresBlockIndex : public BlockIndex {
      public:
+      /**
+       * @param indexer - indexer to write the index with
+       * @param log - logger
+       * @param blocks_per_flush - number of indexed blocks after which the
+       * index is flushed
+       */
       PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
-                         logger::LoggerPtr log);
+                         logger::LoggerPtr log,
+                         size_t blocks_per_flush = 1);
 
       /// Index a block.
       void index(const shared_model::interface::Block &block) override;
 
+      /// Flush the index of blocks which are not flushed yet.
+      iroha::expected::Result<void, std::string> flush();
+
      private:
       /// Index a transaction.
       void makeAccountAssetIndex(
@@ -45,6 +55,8 @@ namespace iroha {
           const shared_model::interface::Transaction::CommandsType &commands);
 
       std::unique_ptr<Indexer> indexer_;
+      size_t blocks_per_flush_;
+      size_t unflushed_blocks_ = 0;
       logger::LoggerPtr log_;
     };
   }  // namespace ametsuchi
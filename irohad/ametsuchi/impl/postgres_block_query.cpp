@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
 
+#include <unordered_map>
+
 #include <boost/format.hpp>
 
 #include "ametsuchi/impl/soci_utils.hpp"
@@ -54,7 +56,8 @@ namespace iroha {
       const auto &hash_str = hash.hex();
 
       try {
-        sql_ << "SELECT status FROM tx_status_by_hash WHERE hash = :hash",
+        sql_ << "SELECT status FROM tx_status_by_hash "
+                "WHERE hash = decode(:hash, 'hex')",
             soci::into(res), soci::use(hash_str);
       } catch (const std::exception &e) {
         log_->error("Failed to execute query: {}", e.what());
@@ -75,5 +78,54 @@ namespace iroha {
           tx_cache_status_responses::Missing{hash});
     }
 
+    std::optional<std::vector<TxCacheStatusType>>
+    PostgresBlockQuery::checkTxPresence(
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      std::vector<TxCacheStatusType> statuses;
+      if (hashes.empty()) {
+        return statuses;
+      }
+
+      // hex strings need no escaping in an array literal
+      std::string hashes_array = "{";
+      for (const auto &hash : hashes) {
+        if (hashes_array.size() > 1) {
+          hashes_array += ',';
+        }
+        hashes_array += hash.hex();
+      }
+      hashes_array += '}';
+
+      std::unordered_map<std::string, int> found;
+      try {
+        using T = boost::tuple<std::string, int>;
+        soci::rowset<T> rows =
+            (sql_.prepare << R"(SELECT encode(hash, 'hex'), status
+                  FROM tx_status_by_hash
+                  WHERE hash IN (SELECT decode(hex, 'hex')
+                      FROM unnest(CAST(:hashes AS text[])) AS hex))",
+             soci::use(hashes_array, "hashes"));
+        for (const auto &row : rows) {
+          found.emplace(row.get<0>(), row.get<1>());
+        }
+      } catch (const std::exception &e) {
+        log_->error("Failed to execute query: {}", e.what());
+        return std::nullopt;
+      }
+
+      statuses.reserve(hashes.size());
+      for (const auto &hash : hashes) {
+        auto it = found.find(hash.hex());
+        if (it == found.end()) {
+          statuses.emplace_back(tx_cache_status_responses::Missing{hash});
+        } else if (it->second > 0) {
+          statuses.emplace_back(tx_cache_status_responses::Committed{hash});
+        } else {
+          statuses.emplace_back(tx_cache_status_responses::Rejected{hash});
+        }
+      }
+      return statuses;
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -38,6 +38,9 @@ namespace iroha {
       std::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) override;
 
+      std::optional<std::vector<TxCacheStatusType>> checkTxPresence(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
+
      private:
       std::unique_ptr<soci::session> psql_;
       soci::session &sql_;
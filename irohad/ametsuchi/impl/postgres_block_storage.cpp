@@ -5,7 +5,11 @@
 
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 
-#include "common/hexutils.hpp"
+#include <algorithm>
+#include <cstring>
+
+#include <soci/postgresql/soci-postgresql.h>
+#include <boost/endian/conversion.hpp>
 #include "common/result.hpp"
 #include "logger/logger.hpp"
 
@@ -13,6 +17,72 @@ using namespace iroha::ametsuchi;
 
 using shared_model::interface::types::HeightType;
 
+namespace {
+  using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  struct BinaryParam {
+    const char *data;
+    int length;
+  };
+
+  /// postgres binary representation of bigint
+  int64_t toBinaryBigint(HeightType height) {
+    return boost::endian::native_to_big(static_cast<int64_t>(height));
+  }
+
+  HeightType fromBinaryBigint(const char *data) {
+    int64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return static_cast<HeightType>(boost::endian::big_to_native(value));
+  }
+
+  /**
+   * Execute query on the connection of the session, passing parameters and
+   * receiving results in binary format. Soci binds bytea only as text, which
+   * requires hex encoding of the whole block on every read and write.
+   * @param sql - session to take the connection from
+   * @param query - query with $N placeholders
+   * @param params - binary parameter values
+   * @param expected_status - status of successful execution
+   * @return query result or an error
+   */
+  iroha::expected::Result<PgResultPtr, std::string> execBinary(
+      soci::session &sql,
+      const std::string &query,
+      std::initializer_list<BinaryParam> params,
+      ExecStatusType expected_status) {
+    auto *conn =
+        static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+            ->conn_;
+
+    std::vector<const char *> values;
+    std::vector<int> lengths;
+    for (const auto &param : params) {
+      values.push_back(param.data);
+      lengths.push_back(param.length);
+    }
+    const std::vector<int> formats(params.size(), 1);
+
+    PgResultPtr result(PQexecParams(conn,
+                                    query.c_str(),
+                                    static_cast<int>(params.size()),
+                                    nullptr,
+                                    values.data(),
+                                    lengths.data(),
+                                    formats.data(),
+                                    1),
+                       &PQclear);
+    if (not result) {
+      return fmt::format("Failed to execute query: {}", PQerrorMessage(conn));
+    }
+    if (PQresultStatus(result.get()) != expected_status) {
+      return fmt::format("Failed to execute query: {}",
+                         PQresultErrorMessage(result.get()));
+    }
+    return std::move(result);
+  }
+}  // namespace
+
 iroha::expected::Result<std::unique_ptr<PostgresBlockStorage>, std::string>
 PostgresBlockStorage::create(
     std::shared_ptr<PoolWrapper> pool_wrapper,
@@ -68,76 +138,113 @@ bool PostgresBlockStorage::insert(
     }
   }
 
-  auto b = block->blob().hex();
+  const auto &block_data = block->blob().blob();
+  const auto height = toBinaryBigint(inserted_height);
 
   soci::session sql(*pool_wrapper_->connection_pool_);
-  soci::statement st = (sql.prepare << "INSERT INTO " << table_name_
-                                    << " (height, block_data) VALUES(:height, "
-                                       ":block_data)",
-                        soci::use(inserted_height),
-                        soci::use(b));
-  log_->debug("insert block {}: {}", inserted_height, b);
-  try {
-    st.execute(true);
-
-    if (block_height_range_) {
-      assert(block_height_range_->max + 1 == inserted_height);
-      ++block_height_range_->max;
-    } else {
-      block_height_range_ = HeightRange{inserted_height, inserted_height};
-    }
-
-    return true;
-  } catch (const std::exception &e) {
-    log_->warn(
-        "Failed to insert block {}, reason {}", inserted_height, e.what());
+  log_->debug("insert block {}, {} bytes", inserted_height, block_data.size());
+  auto result =
+      execBinary(sql,
+                 "INSERT INTO " + table_name_
+                     + " (height, block_data) VALUES($1::bigint, $2::bytea)",
+                 {{reinterpret_cast<const char *>(&height), sizeof(height)},
+                  {reinterpret_cast<const char *>(block_data.data()),
+                   static_cast<int>(block_data.size())}},
+                 PGRES_COMMAND_OK);
+  if (auto error = iroha::expected::resultToOptionalError(result)) {
+    log_->warn("Failed to insert block {}, reason {}", inserted_height, *error);
     return false;
   }
+
+  if (block_height_range_) {
+    assert(block_height_range_->max + 1 == inserted_height);
+    ++block_height_range_->max;
+  } else {
+    block_height_range_ = HeightRange{inserted_height, inserted_height};
+  }
+
+  return true;
 }
 
 boost::optional<std::unique_ptr<shared_model::interface::Block>>
 PostgresBlockStorage::fetch(
     shared_model::interface::types::HeightType height) const {
+  return fetchRange(height, height).match(
+      [](auto &&blocks)
+          -> boost::optional<std::unique_ptr<shared_model::interface::Block>> {
+        if (blocks.value.empty()) {
+          return boost::none;
+        }
+        return std::move(blocks.value.front());
+      },
+      [&](const auto &e)
+          -> boost::optional<std::unique_ptr<shared_model::interface::Block>> {
+        log_->error("Failed to fetch block {}: {}", height, e.error);
+        return boost::none;
+      });
+}
+
+iroha::expected::Result<PostgresBlockStorage::BlockList, std::string>
+PostgresBlockStorage::fetchRange(HeightType from, HeightType to) const {
+  const auto from_param = toBinaryBigint(from);
+  const auto to_param = toBinaryBigint(to);
+
   soci::session sql(*pool_wrapper_->connection_pool_);
-  using QueryTuple = boost::tuple<boost::optional<std::string>>;
-  QueryTuple row;
-  try {
-    sql << "SELECT block_data FROM " << table_name_
-        << " WHERE height = :height",
-        soci::use(height), soci::into(row);
-  } catch (const std::exception &e) {
-    log_->error("Failed to execute query: {}", e.what());
-    return boost::none;
-  }
-  return rebind(viewQuery<QueryTuple>(row)) | [&, this](auto row) {
-    return iroha::ametsuchi::apply(row, [&, this](auto &block_data) {
-      log_->debug("fetched: {}", block_data);
-      return iroha::hexstringToBytestring(block_data) |
-          [&, this](auto byte_block) {
-            iroha::protocol::Block_v1 b1;
-            b1.ParseFromString(byte_block);
-            iroha::protocol::Block block;
-            *block.mutable_block_v1() = b1;
-            return block_factory_->createBlock(std::move(block))
-                .match(
-                    [&](auto &&v) {
-                      return boost::make_optional(
-                          std::unique_ptr<shared_model::interface::Block>(
-                              std::move(v.value)));
-                    },
-                    [&](const auto &e)
-                        -> boost::optional<
-                            std::unique_ptr<shared_model::interface::Block>> {
-                      log_->error("Could not build block at height {}: {}",
-                                  height,
-                                  e.error);
-                      return boost::none;
-                    });
-          };
-    });
+  return execBinary(sql,
+                    "SELECT height, block_data FROM " + table_name_
+                        + " WHERE height BETWEEN $1::bigint AND $2::bigint "
+                          "ORDER BY height",
+                    {{reinterpret_cast<const char *>(&from_param),
+                      sizeof(from_param)},
+                     {reinterpret_cast<const char *>(&to_param),
+                      sizeof(to_param)}},
+                    PGRES_TUPLES_OK)
+             | [this](auto result) -> expected::Result<BlockList, std::string> {
+    const auto rows = PQntuples(result.get());
+    BlockList blocks;
+    blocks.reserve(static_cast<size_t>(rows));
+    for (int row = 0; row < rows; ++row) {
+      const auto height = fromBinaryBigint(PQgetvalue(result.get(), row, 0));
+      auto block = this->parseBlock(
+          height,
+          PQgetvalue(result.get(), row, 1),
+          static_cast<size_t>(PQgetlength(result.get(), row, 1)));
+      if (auto error = expected::resultToOptionalError(block)) {
+        return *error;
+      }
+      blocks.push_back(std::move(block).assumeValue());
+    }
+    return std::move(blocks);
   };
 }
 
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+PostgresBlockStorage::parseBlock(HeightType height,
+                                 const char *data,
+                                 size_t size) const {
+  iroha::protocol::Block block;
+  if (not block.mutable_block_v1()->ParseFromArray(data,
+                                                   static_cast<int>(size))) {
+    return fmt::format("Could not parse block at height {}", height);
+  }
+  return block_factory_->createBlock(std::move(block))
+      .match(
+          [](auto &&v) -> expected::Result<
+                           std::unique_ptr<shared_model::interface::Block>,
+                           std::string> {
+            return std::unique_ptr<shared_model::interface::Block>(
+                std::move(v.value));
+          },
+          [height](const auto &e)
+              -> expected::Result<
+                  std::unique_ptr<shared_model::interface::Block>,
+                  std::string> {
+            return fmt::format(
+                "Could not build block at height {}: {}", height, e.error);
+          });
+}
+
 size_t PostgresBlockStorage::size() const {
   return (block_height_range_ |
           [](auto range) {
@@ -166,18 +273,28 @@ iroha::expected::Result<void, std::string> PostgresBlockStorage::forEach(
   return block_height_range_ |
              [this,
               &function](auto range) -> expected::Result<void, std::string> {
-    soci::session sql(*pool_wrapper_->connection_pool_);
     while (range.min <= range.max) {
-      auto maybe_block = this->fetch(range.min);
-      if (maybe_block) {
-        auto maybe_error = function(std::move(maybe_block).value());
+      const auto batch_max =
+          std::min<HeightType>(range.max, range.min + kFetchBatchSize - 1);
+      auto blocks = this->fetchRange(range.min, batch_max);
+      if (auto error = expected::resultToOptionalError(blocks)) {
+        return fmt::format(
+            "Failed to fetch blocks {}..{}: {}", range.min, batch_max, *error);
+      }
+      auto &batch = blocks.assumeValue();
+      if (batch.size() != batch_max - range.min + 1) {
+        return fmt::format("Failed to fetch blocks {}..{}: {} returned",
+                           range.min,
+                           batch_max,
+                           batch.size());
+      }
+      for (auto &block : batch) {
+        auto maybe_error = function(std::move(block));
         if (iroha::expected::hasError(maybe_error)) {
           return maybe_error.assumeError();
         }
-      } else {
-        return fmt::format("Failed to fetch block {}", range.min);
       }
-      ++range.min;
+      range.min = batch_max + 1;
     }
     return {};
   };
@@ -8,6 +8,8 @@
 
 #include "ametsuchi/block_storage.hpp"
 
+#include <vector>
+
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "backend/protobuf/block.hpp"
@@ -22,6 +24,12 @@ namespace iroha {
      public:
       using BlockTransportFactory = shared_model::proto::ProtoBlockFactory;
 
+      using BlockList =
+          std::vector<std::unique_ptr<shared_model::interface::Block>>;
+
+      /// number of blocks requested per round-trip by forEach
+      static constexpr size_t kFetchBatchSize = 64;
+
       static iroha::expected::Result<std::unique_ptr<PostgresBlockStorage>,
                                      std::string>
       create(std::shared_ptr<PoolWrapper> pool_wrapper,
@@ -39,6 +47,16 @@ namespace iroha {
       boost::optional<std::unique_ptr<shared_model::interface::Block>> fetch(
           shared_model::interface::types::HeightType height) const override;
 
+      /**
+       * Fetch all blocks with heights in [from, to] in a single round-trip
+       * @param from - lowest height to fetch
+       * @param to - highest height to fetch
+       * @return blocks in ascending height order or an error
+       */
+      expected::Result<BlockList, std::string> fetchRange(
+          shared_model::interface::types::HeightType from,
+          shared_model::interface::types::HeightType to) const;
+
       size_t size() const override;
 
       void reload() override;
@@ -64,6 +82,12 @@ namespace iroha {
       static iroha::expected::Result<boost::optional<HeightRange>, std::string>
       queryBlockHeightsRange(soci::session &sql, const std::string &table_name);
 
+      expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                       std::string>
+      parseBlock(shared_model::interface::types::HeightType height,
+                 const char *data,
+                 size_t size) const;
+
       void dropTable();
 
       mutable boost::optional<HeightRange> block_height_range_;
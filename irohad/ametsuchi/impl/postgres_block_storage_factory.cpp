@@ -35,7 +35,7 @@ PostgresBlockStorageFactory::createTable(soci::session &sql,
                                          const std::string &table) {
   soci::statement st =
       (sql.prepare << "CREATE TABLE IF NOT EXISTS " << table
-                   << "(height bigint PRIMARY KEY, block_data text not null)");
+                   << "(height bigint PRIMARY KEY, block_data bytea not null)");
   try {
     st.execute(true);
     return {};
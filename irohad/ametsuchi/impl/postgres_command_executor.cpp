@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 
+#include <chrono>
 #include <exception>
 #include <forward_list>
 #include <memory>
@@ -18,6 +19,7 @@
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 #include "ametsuchi/impl/postgres_burrow_storage.hpp"
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
+#include "ametsuchi/impl/postgres_statement_time.hpp"
 #include "ametsuchi/impl/soci_std_optional.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "ametsuchi/setting_query.hpp"
@@ -380,9 +382,21 @@ namespace iroha {
                                : statement_without_validation;
       }
 
+      /**
+       * @param command_name - name of the command of the statements
+       * @return histogram of the execution time of the statements
+       */
+      metrics::Histogram &executionTime(const std::string &command_name) {
+        if (not execution_time) {
+          execution_time = &postgresStatementTime(command_name);
+        }
+        return *execution_time;
+      }
+
      private:
       soci::statement statement_with_validation;
       soci::statement statement_without_validation;
+      metrics::Histogram *execution_time = nullptr;
     };
 
     class PostgresCommandExecutor::StatementExecutor {
@@ -395,7 +409,8 @@ namespace iroha {
               perm_converter)
           : statement_(statements->getStatement(enable_validation)),
             command_name_(std::move(command_name)),
-            perm_converter_(std::move(perm_converter)) {
+            perm_converter_(std::move(perm_converter)),
+            execution_time_(statements->executionTime(command_name_)) {
         arguments_string_builder_.init(command_name_)
             .appendNamed("Validation", enable_validation);
       }
@@ -474,8 +489,10 @@ namespace iroha {
           soci::row r;
           statement_.define_and_bind();
           statement_.exchange_for_rowset(soci::into(r));
+          const auto start = std::chrono::steady_clock::now();
           statement_.execute();
           auto result = statement_.fetch() ? r.get<int>(0) : 1;
+          execution_time_.observeSince(start);
           statement_.bind_clean_up();
           temp_values_.clear();
           if (result != 0) {
@@ -498,6 +515,7 @@ namespace iroha {
           perm_converter_;
       shared_model::detail::PrettyStringBuilder arguments_string_builder_;
       std::forward_list<std::string> temp_values_;
+      metrics::Histogram &execution_time_;
     };
 
     std::unique_ptr<PostgresCommandExecutor::CommandStatements>
@@ -681,6 +699,15 @@ namespace iroha {
           sql_,
           R"(
           WITH %s
+            current_value AS
+            (
+                SELECT value
+                FROM account_detail
+                WHERE
+                  account_id = :target
+                  AND writer = :creator
+                  AND key = :key
+            ),
             old_value AS
             (
                 SELECT *
@@ -688,10 +715,11 @@ namespace iroha {
                 WHERE
                   account_id = :target
                   AND CASE
-                    WHEN data ? :creator AND data->:creator ?:key
+                    WHEN EXISTS (SELECT * FROM current_value)
                       THEN CASE
                         WHEN :have_expected_value::boolean
-                            THEN data->:creator->:key = :expected_value::jsonb
+                            THEN (SELECT value FROM current_value)
+                                = :expected_value::jsonb
                         ELSE FALSE
                         END
                     ELSE not (:check_empty::boolean and :have_expected_value::boolean)
@@ -699,18 +727,24 @@ namespace iroha {
             ),
             inserted AS
             (
-                UPDATE account
-                SET data = jsonb_set(
-                  CASE
-                    WHEN data ? :creator THEN data
-                    ELSE jsonb_set(data, array[:creator], '{}')
-                  END,
-                  array[:creator, :key], :new_value::jsonb
-                )
+                INSERT INTO account_detail(account_id, writer, key, value)
+                SELECT :target, :creator, :key, :new_value::jsonb
                 WHERE
                   EXISTS (SELECT * FROM old_value)
-                  AND account_id = :target
                   %s
+                ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = EXCLUDED.value
+                RETURNING (1)
+            ),
+            counted AS
+            (
+                INSERT INTO account_detail_count(account_id, writer, count)
+                SELECT :target, :creator, 1
+                WHERE
+                  EXISTS (SELECT * FROM inserted)
+                  AND NOT EXISTS (SELECT * FROM current_value)
+                ON CONFLICT (account_id, writer)
+                  DO UPDATE SET count = account_detail_count.count + 1
                 RETURNING (1)
             )
           SELECT CASE
@@ -774,9 +808,9 @@ namespace iroha {
             ),
             insert_account AS
             (
-                INSERT INTO account(account_id, domain_id, quorum, data)
+                INSERT INTO account(account_id, domain_id, quorum)
                 (
-                    SELECT :account_id, :domain, 1, '{}'
+                    SELECT :account_id, :domain, 1
                     WHERE EXISTS (SELECT * FROM insert_signatory)
                       AND EXISTS (SELECT * FROM get_domain_default_role)
                 ) RETURNING (1)
@@ -1121,12 +1155,35 @@ namespace iroha {
           sql_,
           R"(
           WITH %s
+            current_value AS
+            (
+                SELECT value
+                FROM account_detail
+                WHERE
+                  account_id = :target
+                  AND writer = :creator
+                  AND key = :key
+            ),
             inserted AS
             (
-                UPDATE account SET data = jsonb_set(
-                CASE WHEN data ? :creator THEN data ELSE
-                jsonb_set(data, array[:creator], '{}') END,
-                array[:creator, :key], :value::jsonb) WHERE account_id=:target %s
+                INSERT INTO account_detail(account_id, writer, key, value)
+                SELECT :target, :creator, :key, :value::jsonb
+                WHERE
+                  EXISTS (SELECT * FROM account WHERE account_id = :target)
+                  %s
+                ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = EXCLUDED.value
+                RETURNING (1)
+            ),
+            counted AS
+            (
+                INSERT INTO account_detail_count(account_id, writer, count)
+                SELECT :target, :creator, 1
+                WHERE
+                  EXISTS (SELECT * FROM inserted)
+                  AND NOT EXISTS (SELECT * FROM current_value)
+                ON CONFLICT (account_id, writer)
+                  DO UPDATE SET count = account_detail_count.count + 1
                 RETURNING (1)
             )
           SELECT CASE
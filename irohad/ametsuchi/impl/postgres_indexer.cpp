@@ -5,19 +5,144 @@
 
 #include "ametsuchi/impl/postgres_indexer.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <set>
+#include <string_view>
+#include <type_traits>
+
 #include <fmt/core.h>
+#include <soci/postgresql/soci-postgresql.h>
 #include <soci/soci.h>
-#include <boost/format.hpp>
+#include "ametsuchi/impl/postgres_statement_time.hpp"
+#include "ametsuchi/impl/tx_hash_filter.hpp"
 #include "cryptography/hash.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace shared_model::interface::types;
 
-PostgresIndexer::PostgresIndexer(soci::session &sql) : sql_(sql) {}
+namespace {
+  /// Amount of data passed to the server in one piece during COPY
+  constexpr size_t kCopyPieceSize = 1 << 20;
+
+  /// Signature, flags field and header extension length of binary COPY
+  constexpr char kCopyHeader[] = "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0";
+
+  /// Append the value in network byte order
+  template <typename T>
+  void appendNumber(std::string &rows, T value) {
+    using Unsigned = std::make_unsigned_t<T>;
+    auto bits = static_cast<Unsigned>(value);
+    for (auto shift = (sizeof(T) - 1) * 8; shift > 0; shift -= 8) {
+      rows += static_cast<char>((bits >> shift) & 0xff);
+    }
+    rows += static_cast<char>(bits & 0xff);
+  }
+
+  /// Append the field of binary COPY with the given raw bytes
+  void appendField(std::string &rows, std::string_view bytes) {
+    appendNumber(rows, static_cast<int32_t>(bytes.size()));
+    rows.append(bytes.data(), bytes.size());
+  }
+
+  /// Append the bigint field of binary COPY
+  void appendField(std::string &rows, int64_t value) {
+    appendNumber(rows, int32_t{sizeof(value)});
+    appendNumber(rows, value);
+  }
+
+  /// Append the boolean field of binary COPY
+  void appendField(std::string &rows, bool value) {
+    appendNumber(rows, int32_t{1});
+    rows += static_cast<char>(value ? 1 : 0);
+  }
+
+  /// Append the NULL field of binary COPY
+  void appendNull(std::string &rows) {
+    appendNumber(rows, int32_t{-1});
+  }
+
+  /// Start the binary COPY data, which is followed by the tuples
+  void beginCopy(std::string &rows, size_t tuples, int16_t fields) {
+    rows.assign(kCopyHeader, sizeof(kCopyHeader) - 1);
+    // the most of a tuple are its text fields, the rest is a rough estimate
+    rows.reserve(rows.size() + tuples * (sizeof(int16_t) + fields * 32));
+  }
+
+  /// Start the tuple with the given number of fields
+  void beginTuple(std::string &rows, int16_t fields) {
+    appendNumber(rows, fields);
+  }
+
+  /// Finish the binary COPY data
+  void endCopy(std::string &rows) {
+    appendNumber(rows, int16_t{-1});
+  }
+
+  /**
+   * Load rows to the table with binary COPY, which spares both formatting of
+   * the values on the client and parsing of the statement on the server
+   * @param sql - session to load the rows with
+   * @param target - table name followed by the list of columns
+   * @param rows - rows in the binary format of COPY
+   * @throws std::runtime_error if the loading has failed
+   */
+  void copyRows(soci::session &sql,
+                const std::string &target,
+                const std::string &rows) {
+    using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+    auto *conn =
+        static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+            ->conn_;
+
+    PgResultPtr result(
+        PQexec(conn,
+               ("COPY " + target + " FROM STDIN (FORMAT binary)").c_str()),
+        &PQclear);
+    if (PQresultStatus(result.get()) != PGRES_COPY_IN) {
+      throw std::runtime_error(PQerrorMessage(conn));
+    }
+    bool sent = true;
+    for (size_t offset = 0; sent and offset < rows.size();
+         offset += kCopyPieceSize) {
+      const auto size = std::min(kCopyPieceSize, rows.size() - offset);
+      sent = PQputCopyData(conn, rows.data() + offset, static_cast<int>(size))
+          == 1;
+    }
+    if (PQputCopyEnd(conn, sent ? nullptr : "failed to send rows") != 1) {
+      throw std::runtime_error(PQerrorMessage(conn));
+    }
+    result.reset(PQgetResult(conn));
+    const auto status = PQresultStatus(result.get());
+    std::string error = PQresultErrorMessage(result.get());
+    while (auto *next_result = PQgetResult(conn)) {
+      PQclear(next_result);
+    }
+    if (status != PGRES_COMMAND_OK) {
+      throw std::runtime_error(error);
+    }
+  }
+}  // namespace
+
+PostgresIndexer::PostgresIndexer(soci::session &sql,
+                                 std::shared_ptr<TxHashFilter> tx_hash_filter)
+    : sql_(sql),
+      tx_hash_filter_(std::move(tx_hash_filter)),
+      tx_status_copy_time_(postgresStatementTime("copy_tx_status_by_hash")),
+      tx_positions_copy_time_(postgresStatementTime("copy_tx_positions")),
+      tx_positions_count_time_(
+          postgresStatementTime("upsert_tx_positions_count")) {}
 
 void PostgresIndexer::txHashStatus(const HashType &tx_hash, bool is_committed) {
-  tx_hash_status_.hash.emplace_back(tx_hash.hex());
-  tx_hash_status_.status.emplace_back(is_committed ? "TRUE" : "FALSE");
+  // the filter must know the hash before it can be read from the database
+  if (tx_hash_filter_) {
+    tx_hash_filter_->add(tx_hash);
+  }
+  tx_hash_status_.hash.emplace_back(
+      shared_model::crypto::toBinaryString(tx_hash));
+  tx_hash_status_.status.emplace_back(is_committed);
 }
 
 void PostgresIndexer::committedTxHash(const HashType &committed_tx_hash) {
@@ -35,7 +160,7 @@ void PostgresIndexer::txPositions(
     TimestampType const ts,
     TxPosition const &position) {
   tx_positions_.account.emplace_back(account);
-  tx_positions_.hash.emplace_back(hash.hex());
+  tx_positions_.hash.emplace_back(shared_model::crypto::toBinaryString(hash));
   tx_positions_.asset_id.emplace_back(std::move(asset_id));
   tx_positions_.ts.emplace_back(ts);
   tx_positions_.height.emplace_back(position.height);
@@ -44,20 +169,18 @@ void PostgresIndexer::txPositions(
 
 iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
   try {
-    cache_.clear();
     assert(tx_hash_status_.hash.size() == tx_hash_status_.status.size());
     if (not tx_hash_status_.hash.empty()) {
-      cache_ +=
-          "INSERT INTO tx_status_by_hash"
-          "(hash, status) VALUES ";
+      beginCopy(cache_, tx_hash_status_.hash.size(), 2);
       for (size_t ix = 0; ix < tx_hash_status_.hash.size(); ++ix) {
-        cache_ += fmt::format("('{}','{}')",
-                              tx_hash_status_.hash[ix],
-                              tx_hash_status_.status[ix]);
-        if (ix != tx_hash_status_.hash.size() - 1)
-          cache_ += ',';
+        beginTuple(cache_, 2);
+        appendField(cache_, tx_hash_status_.hash[ix]);
+        appendField(cache_, static_cast<bool>(tx_hash_status_.status[ix]));
       }
-      cache_ += ";\n";
+      endCopy(cache_);
+      auto start = std::chrono::steady_clock::now();
+      copyRows(sql_, "tx_status_by_hash(hash, status)", cache_);
+      tx_status_copy_time_.observeSince(start);
 
       tx_hash_status_.hash.clear();
       tx_hash_status_.status.clear();
@@ -69,30 +192,53 @@ iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
     assert(tx_positions_.account.size() == tx_positions_.height.size());
     assert(tx_positions_.account.size() == tx_positions_.index.size());
     if (!tx_positions_.account.empty()) {
-      cache_ +=
-          "INSERT INTO tx_positions"
-          "(creator_id, hash, asset_id, ts, height, index) VALUES ";
+      beginCopy(cache_, tx_positions_.account.size(), 6);
       for (size_t ix = 0; ix < tx_positions_.account.size(); ++ix) {
+        beginTuple(cache_, 6);
+        appendField(cache_, tx_positions_.account[ix]);
+        appendField(cache_, tx_positions_.hash[ix]);
         if (tx_positions_.asset_id[ix]) {
-          cache_ += fmt::format("('{}','{}','{}',{},{},{})",
-                                tx_positions_.account[ix],
-                                tx_positions_.hash[ix],
-                                *tx_positions_.asset_id[ix],
-                                tx_positions_.ts[ix],
-                                tx_positions_.height[ix],
-                                tx_positions_.index[ix]);
+          appendField(cache_, *tx_positions_.asset_id[ix]);
         } else {
-          cache_ += fmt::format("('{}','{}',NULL,{},{},{})",
-                                tx_positions_.account[ix],
-                                tx_positions_.hash[ix],
-                                tx_positions_.ts[ix],
-                                tx_positions_.height[ix],
-                                tx_positions_.index[ix]);
+          appendNull(cache_);
         }
-        if (ix != tx_positions_.account.size() - 1)
+        appendField(cache_, static_cast<int64_t>(tx_positions_.ts[ix]));
+        appendField(cache_, static_cast<int64_t>(tx_positions_.height[ix]));
+        appendField(cache_, static_cast<int64_t>(tx_positions_.index[ix]));
+      }
+      endCopy(cache_);
+      auto start = std::chrono::steady_clock::now();
+      copyRows(sql_,
+               "tx_positions(creator_id, hash, asset_id, ts, height, index)",
+               cache_);
+      tx_positions_copy_time_.observeSince(start);
+
+      // a transaction is indexed several times for the same account and
+      // asset if it has several transfers of the asset
+      std::map<std::pair<std::string, std::string>, std::set<std::string>>
+          related_txs;
+      for (size_t ix = 0; ix < tx_positions_.account.size(); ++ix) {
+        related_txs[{tx_positions_.account[ix],
+                     tx_positions_.asset_id[ix].value_or("")}]
+            .insert(tx_positions_.hash[ix]);
+      }
+      cache_ =
+          "INSERT INTO tx_positions_count"
+          "(creator_id, asset_id, count) VALUES ";
+      for (auto it = related_txs.begin(); it != related_txs.end(); ++it) {
+        cache_ += fmt::format("('{}','{}',{})",
+                              it->first.first,
+                              it->first.second,
+                              it->second.size());
+        if (std::next(it) != related_txs.end())
           cache_ += ',';
       }
-      cache_ += " ON CONFLICT DO NOTHING;\n";
+      cache_ +=
+          " ON CONFLICT (creator_id, asset_id) DO UPDATE"
+          " SET count = tx_positions_count.count + EXCLUDED.count";
+      start = std::chrono::steady_clock::now();
+      sql_ << cache_;
+      tx_positions_count_time_.observeSince(start);
 
       tx_positions_.account.clear();
       tx_positions_.hash.clear();
@@ -101,9 +247,6 @@ iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
       tx_positions_.height.clear();
       tx_positions_.index.clear();
     }
-
-    if (!cache_.empty())
-      sql_ << cache_;
   } catch (const std::exception &e) {
     return e.what();
   }
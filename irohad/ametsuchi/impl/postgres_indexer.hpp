@@ -8,6 +8,7 @@
 
 #include "ametsuchi/indexer.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -16,11 +17,23 @@ namespace soci {
 }
 
 namespace iroha {
+  namespace metrics {
+    class Histogram;
+  }
+
   namespace ametsuchi {
+    class TxHashFilter;
+
 
     class PostgresIndexer final : public Indexer {
      public:
-      PostgresIndexer(soci::session &sql);
+      /**
+       * @param sql - session to write the index with
+       * @param tx_hash_filter - filter which is updated with indexed
+       * transaction hashes before they are written, optional
+       */
+      PostgresIndexer(soci::session &sql,
+                      std::shared_ptr<TxHashFilter> tx_hash_filter = nullptr);
 
       void committedTxHash(const shared_model::interface::types::HashType
                                &committed_tx_hash) override;
@@ -39,9 +52,10 @@ namespace iroha {
       iroha::expected::Result<void, std::string> flush() override;
 
      private:
+      /// hashes are kept as raw bytes, which are copied to bytea columns
       struct {
         std::vector<std::string> hash;
-        std::vector<std::string> status;
+        std::vector<bool> status;
       } tx_hash_status_;
 
       struct {
@@ -60,7 +74,12 @@ namespace iroha {
                         bool is_committed);
 
       soci::session &sql_;
+      std::shared_ptr<TxHashFilter> tx_hash_filter_;
+      /// buffer for the rows of a table, which is reused between flushes
       std::string cache_;
+      metrics::Histogram &tx_status_copy_time_;
+      metrics::Histogram &tx_positions_copy_time_;
+      metrics::Histogram &tx_positions_count_time_;
     };
 
   }  // namespace ametsuchi
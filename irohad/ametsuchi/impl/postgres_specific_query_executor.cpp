@@ -18,6 +18,7 @@
 #include "ametsuchi/impl/executor_common.hpp"
 #include "ametsuchi/impl/soci_std_optional.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "backend/plain/account_detail_record_id.hpp"
 #include "backend/plain/engine_receipt.hpp"
 #include "backend/plain/peer.hpp"
@@ -55,6 +56,26 @@ namespace {
 
   using namespace iroha;
 
+  /// Number of account details of all or one writer, kept by the commands
+  const char *kAccountDetailsCountSql = R"(
+              select coalesce(sum(count), 0)::bigint total_number
+              from account_detail_count
+              where
+                  account_id = :account_id and
+                  coalesce(writer = :writer, true))";
+
+  /**
+   * Number of account details with the key, which is counted in the query.
+   * Without the writer it takes all details of the account to be read
+   */
+  const char *kAccountDetailsWithKeyCountSql = R"(
+              select count(1) total_number
+              from account_detail
+              where
+                  account_id = :account_id and
+                  coalesce(writer = :writer, true) and
+                  key = :key)";
+
   std::string getAccountRolePermissionCheckSql(
       shared_model::interface::permissions::Role permission,
       const std::string &account_alias = ":role_account_id") {
@@ -83,13 +104,40 @@ namespace {
    * corresponding permissions for target account taken from column `t' of table
    * `target' (should be provided separately).
    * It verifies individual, domain, and global permissions, and returns true in
-   * `perm' column if any of listed permissions is present, and false otherwise
+   * `perm' column if any of listed permissions is present, and false otherwise.
+   * Known permissions of the creator are put into the subquery as constants
+   * instead of being read from the role tables
    */
   auto hasQueryPermissionInternal(
       shared_model::interface::types::AccountIdType const &creator,
       Role indiv_permission_id,
       Role all_permission_id,
-      Role domain_permission_id) {
+      Role domain_permission_id,
+      boost::optional<shared_model::interface::RolePermissionSet> const
+          &creator_permissions = boost::none) {
+    if (creator_permissions) {
+      auto has = [&creator_permissions](Role permission) {
+        return creator_permissions->isSet(Role::kRoot)
+                or creator_permissions->isSet(permission)
+            ? "true"
+            : "false";
+      };
+      return fmt::format(
+          R"(
+        target_domain AS (select split_part(target.t, '@', 2) as td from target),
+        has_perms as (
+          SELECT ('{0}' = (select t from target) AND {1})
+              OR {2}
+              OR ('{3}' = (select td from target_domain) AND {4}) AS perm
+        )
+    )",
+          creator,
+          has(indiv_permission_id),
+          has(all_permission_id),
+          iroha::ametsuchi::getDomainFromName(creator),
+          has(domain_permission_id));
+    }
+
     const auto bits = shared_model::interface::RolePermissionSet::size();
     const auto perm_str =
         shared_model::interface::RolePermissionSet({indiv_permission_id})
@@ -152,13 +200,16 @@ namespace {
       shared_model::interface::types::AccountIdType const &target_account,
       Role indiv_permission_id,
       Role all_permission_id,
-      Role domain_permission_id) {
+      Role domain_permission_id,
+      boost::optional<shared_model::interface::RolePermissionSet> const
+          &creator_permissions = boost::none) {
     return fmt::format("target AS (select '{}'::text as t), {}",
                        target_account,
                        hasQueryPermissionInternal(creator,
                                                   indiv_permission_id,
                                                   all_permission_id,
-                                                  domain_permission_id));
+                                                  domain_permission_id,
+                                                  creator_permissions));
   }
 
   /// Query result is a tuple of optionals, since there could be no entry
@@ -252,6 +303,86 @@ namespace {
     dst.append("index ASC");
     return true;
   }
+
+  /**
+   * Makes the list of transaction position columns which define the response
+   * ordering, and a condition selecting positions which are not before the
+   * one in first_tx table in this ordering. The columns are compared as a row
+   * if all of them have the same direction, so that the condition can be
+   * served by an index.
+   * It APPENDS string data to destinations, but not replaces it.
+   * @param src - source ordering data
+   * @param columns - destination of the columns list
+   * @param condition - destination of the condition
+   * @return true on success, false otherwise
+   */
+  bool formatSeekCondition(shared_model::interface::Ordering const &src,
+                           std::string &columns,
+                           std::string &condition) {
+    OrderingEntry const *ptr = nullptr;
+    size_t count = 0;
+    src.get(ptr, count);
+
+    // column names with flags whether the ordering by them is ascending
+    std::vector<std::pair<std::string, bool>> keys;
+    for (size_t ix = 0; ix < count; ++ix) {
+      auto it_field = kOrderingFieldMapping.find(ptr[ix].field);
+      if (kOrderingFieldMapping.end() == it_field) {
+        BOOST_ASSERT_MSG(false, "Ordering field mapping missed!");
+        return false;
+      }
+      keys.emplace_back(it_field->second,
+                        ptr[ix].direction == OrderingDirection::kAscending);
+    }
+    keys.emplace_back("index", true);
+
+    auto first = [](const std::string &column) {
+      return fmt::format("(SELECT {} FROM first_tx)", column);
+    };
+    auto compare = [](bool ascending, bool strict) {
+      return ascending ? (strict ? ">" : ">=") : (strict ? "<" : "<=");
+    };
+
+    std::vector<std::string> names, first_values;
+    for (const auto &key : keys) {
+      names.push_back(key.first);
+      first_values.push_back(first(key.first));
+    }
+    auto column_list = boost::algorithm::join(names, ", ");
+    columns.append(column_list);
+
+    bool same_direction =
+        std::all_of(keys.begin(), keys.end(), [&keys](const auto &key) {
+          return key.second == keys.front().second;
+        });
+    if (same_direction) {
+      condition.append(
+          fmt::format("AND ({}) {} ({})",
+                      column_list,
+                      compare(keys.front().second, false),
+                      boost::algorithm::join(first_values, ", ")));
+      return true;
+    }
+
+    // lexicographical comparison, the first column bounds the scanned range
+    auto tail = fmt::format("{} {} {}",
+                            keys.back().first,
+                            compare(keys.back().second, false),
+                            first_values.back());
+    for (size_t ix = keys.size() - 1; ix-- > 0;) {
+      tail = fmt::format("({0} {1} {2} OR ({0} = {2} AND {3}))",
+                         keys[ix].first,
+                         compare(keys[ix].second, true),
+                         first_values[ix],
+                         tail);
+    }
+    condition.append(fmt::format("AND {} {} {} AND {}",
+                                 keys.front().first,
+                                 compare(keys.front().second, false),
+                                 first_values.front(),
+                                 tail));
+    return true;
+  }
 }  // namespace
 
 namespace iroha {
@@ -265,13 +396,15 @@ namespace iroha {
             response_factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<WsvCache> wsv_cache)
         : sql_(sql),
           block_store_(block_store),
           pending_txs_storage_(std::move(pending_txs_storage)),
           query_response_factory_{std::move(response_factory)},
           perm_converter_(std::move(perm_converter)),
-          log_(std::move(log)) {
+          log_(std::move(log)),
+          wsv_cache_(std::move(wsv_cache)) {
       for (size_t value = 0; value < (size_t)OrderingField::kMaxValueCount;
            ++value) {
         BOOST_ASSERT_MSG(kOrderingFieldMapping.find((OrderingField)value)
@@ -372,9 +505,41 @@ namespace iroha {
       }
     }
 
+    boost::optional<shared_model::interface::RolePermissionSet>
+    PostgresSpecificQueryExecutor::cachedRolePermissions(
+        const std::string &account_id) const {
+      if (not wsv_cache_) {
+        return boost::none;
+      }
+      if (auto permissions = wsv_cache_->getRolePermissions(account_id)) {
+        return permissions;
+      }
+      auto generation = wsv_cache_->generation();
+      std::string bitstring;
+      try {
+        sql_ << fmt::format(
+            R"(SELECT COALESCE(bit_or(rp.permission), '0'::bit({}))
+               FROM role_has_permissions AS rp
+               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
+               WHERE ar.account_id = :account_id)",
+            shared_model::interface::RolePermissionSet::size()),
+            soci::into(bitstring), soci::use(account_id, "account_id");
+      } catch (const std::exception &e) {
+        log_->error("Failed to read role permissions: {}", e.what());
+        return boost::none;
+      }
+      shared_model::interface::RolePermissionSet permissions{bitstring};
+      wsv_cache_->putRolePermissions(account_id, permissions, generation);
+      return permissions;
+    }
+
     bool PostgresSpecificQueryExecutor::hasAccountRolePermission(
         shared_model::interface::permissions::Role permission,
         const std::string &account_id) const {
+      if (auto permissions = cachedRolePermissions(account_id)) {
+        return permissions->isSet(permission)
+            or permissions->isSet(Role::kRoot);
+      }
       using T = boost::tuple<int>;
       try {
         soci::rowset<T> st =
@@ -435,6 +600,7 @@ namespace iroha {
         const shared_model::interface::types::HashType &query_hash,
         QueryChecker &&qry_checker,
         char const *related_txs,
+        char const *related_txs_count,
         QueryApplier applier,
         Permissions... perms) {
       using QueryTuple = QueryType<shared_model::interface::types::HeightType,
@@ -446,26 +612,36 @@ namespace iroha {
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
+      // the page is looked up by the position of its first transaction, so
+      // that its cost does not depend on the number of preceding ones
       char const *base = R"(WITH
                {0},
+               {1}
                my_txs AS (
-                 SELECT DISTINCT ROW_NUMBER() OVER({1}) AS row, hash, ts, height, index
+                 SELECT DISTINCT {2}
                  FROM tx_positions
                  WHERE
-                 {2} -- related_txs
-                 {1} -- ordering
+                 {3} -- related_txs
+                 {4} -- seek
+                 {5} -- ordering
+                 LIMIT :page_size
                  ),
-               total_size AS (SELECT COUNT(*) FROM my_txs) {3}
+               total_size AS (
+                 SELECT COALESCE(MAX(count), 0) AS count
+                 FROM tx_positions_count
+                 WHERE {6} -- related_txs_count
+                 )
                SELECT my_txs.height, my_txs.index, count, perm FROM my_txs
-               {4}
                RIGHT OUTER JOIN has_perms ON TRUE
                JOIN total_size ON TRUE
-               LIMIT :page_size)";
+               {5})";
 
       auto const &ordering = q.paginationMeta().ordering();
       ordering_str_.clear();
+      std::string columns, seek;
 
-      if (!formatOrderBy(ordering, ordering_str_)) {
+      if (!formatOrderBy(ordering, ordering_str_)
+          or !formatSeekCondition(ordering, columns, seek)) {
         return this->logAndReturnErrorResponse(QueryErrorType::kStatefulFailed,
                                                "Ordering query failed.",
                                                1,
@@ -474,13 +650,23 @@ namespace iroha {
 
       auto query = fmt::format(
           base,
-          hasQueryPermissionTarget(creator_id, q.accountId(), perms...),
-          (ordering_str_.empty() ? "" : ordering_str_.c_str()),
+          hasQueryPermissionTarget(creator_id,
+                                   q.accountId(),
+                                   perms...,
+                                   cachedRolePermissions(creator_id)),
+          (first_hash ? fmt::format(R"(first_tx AS (
+                 SELECT ts, height, index
+                 FROM tx_positions
+                 WHERE {} AND hash = decode(:hash, 'hex')
+                 LIMIT 1
+                 ),)",
+                                    related_txs)
+                      : ""),
+          columns,
           related_txs,
-          (first_hash
-               ? R"(, base_row AS(SELECT row FROM my_txs WHERE hash = lower(:hash) LIMIT 1))"
-               : ""),
-          (first_hash ? R"(JOIN base_row ON my_txs.row >= base_row.row)" : ""));
+          (first_hash ? seek : ""),
+          ordering_str_,
+          related_txs_count);
 
       return executeQuery<QueryTuple, PermissionTuple>(
           applier(query),
@@ -491,13 +677,16 @@ namespace iroha {
             if (not boost::empty(range_without_nulls)) {
               total_size = boost::get<2>(*range_without_nulls.begin());
             }
-            std::map<uint64_t, std::vector<uint64_t>> index;
-            // unpack results to get map from block height to index of tx in
-            // a block
+            std::vector<std::pair<uint64_t, std::vector<uint64_t>>> index;
+            // unpack results to get block heights with indices of txs in the
+            // blocks, keeping the order of the response
             for (auto t : range_without_nulls) {
               iroha::ametsuchi::apply(
                   t, [&index](auto &height, auto &idx, auto &) {
-                    index[height].push_back(idx);
+                    if (index.empty() or index.back().first != height) {
+                      index.emplace_back(height, std::vector<uint64_t>{});
+                    }
+                    index.back().second.push_back(idx);
                   });
             }
 
@@ -571,8 +760,20 @@ namespace iroha {
 
       auto cmd =
           fmt::format(R"(WITH {},
+      account_data AS (
+          SELECT COALESCE(jsonb_object_agg(writer, data_by_writer), '{{}}')
+              AS data
+          FROM (
+              SELECT writer, jsonb_object_agg(key, value) data_by_writer
+              FROM account_detail
+              WHERE account_id = :target_account_id
+              GROUP BY writer
+          ) t
+      ),
       t AS (
-          SELECT a.account_id, a.domain_id, a.quorum, a.data, ARRAY_AGG(ar.role_id) AS roles
+          SELECT a.account_id, a.domain_id, a.quorum,
+              (SELECT data FROM account_data) AS data,
+              ARRAY_AGG(ar.role_id) AS roles
           FROM account AS a, account_has_roles AS ar
           WHERE a.account_id = :target_account_id
           AND ar.account_id = a.account_id
@@ -581,11 +782,13 @@ namespace iroha {
       SELECT account_id, domain_id, quorum, data, roles, perm
       FROM t RIGHT OUTER JOIN has_perms AS p ON TRUE
       )",
-                      hasQueryPermissionTarget(creator_id,
-                                               q.accountId(),
-                                               Role::kGetMyAccount,
-                                               Role::kGetAllAccounts,
-                                               Role::kGetDomainAccounts));
+                      hasQueryPermissionTarget(
+                          creator_id,
+                          q.accountId(),
+                          Role::kGetMyAccount,
+                          Role::kGetAllAccounts,
+                          Role::kGetDomainAccounts,
+                          cachedRolePermissions(creator_id)));
 
       auto query_apply = [this, &query_hash](auto &account_id,
                                              auto &domain_id,
@@ -680,11 +883,13 @@ namespace iroha {
       SELECT public_key, perm FROM t
       RIGHT OUTER JOIN has_perms ON TRUE
       )",
-                      hasQueryPermissionTarget(creator_id,
-                                               q.accountId(),
-                                               Role::kGetMySignatories,
-                                               Role::kGetAllSignatories,
-                                               Role::kGetDomainSignatories));
+                      hasQueryPermissionTarget(
+                          creator_id,
+                          q.accountId(),
+                          Role::kGetMySignatories,
+                          Role::kGetAllSignatories,
+                          Role::kGetDomainSignatories,
+                          cachedRolePermissions(creator_id)));
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] { return (sql_.prepare << cmd, soci::use(q.accountId())); },
@@ -718,6 +923,10 @@ namespace iroha {
           creator_id = :account_id
           AND asset_id IS NULL
       )";
+      char const *related_txs_count = R"(
+          creator_id = :account_id
+          AND asset_id = ''
+      )";
 
       const auto &pagination_info = q.paginationMeta();
       auto first_hash = pagination_info.firstTxHash();
@@ -728,13 +937,13 @@ namespace iroha {
         return [&] {
           if (first_hash) {
             return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(first_hash->hex(), "hash"),
+                    soci::use(query_size, "page_size"));
           } else {
             return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(query_size));
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(query_size, "page_size"));
           }
         };
       };
@@ -753,6 +962,7 @@ namespace iroha {
                                       query_hash,
                                       std::move(check_query),
                                       related_txs,
+                                      related_txs_count,
                                       apply_query,
                                       Role::kGetMyAccTxs,
                                       Role::kGetAllAccTxs,
@@ -766,7 +976,9 @@ namespace iroha {
       std::string hash_str = boost::algorithm::join(
           q.transactionHashes()
               | boost::adaptors::transformed(
-                    [](const auto &h) { return "lower('" + h.hex() + "')"; }),
+                    [](const auto &h) {
+                      return "decode('" + h.hex() + "', 'hex')";
+                    }),
           ", ");
 
       using QueryTuple =
@@ -777,7 +989,8 @@ namespace iroha {
           R"(WITH has_my_perm AS ({}),
       has_all_perm AS ({}),
       t AS (
-          SELECT DISTINCT height, hash FROM tx_positions WHERE hash IN ({})
+          SELECT DISTINCT height, encode(hash, 'hex') AS hash FROM tx_positions
+          WHERE hash IN ({})
       )
       SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
       RIGHT OUTER JOIN has_my_perm ON TRUE
@@ -849,6 +1062,7 @@ namespace iroha {
           creator_id = :account_id
           AND asset_id = :asset_id
       )";
+      char const *related_txs_count = related_txs;
 
       const auto &pagination_info = q.paginationMeta();
       auto first_hash = pagination_info.firstTxHash();
@@ -859,15 +1073,15 @@ namespace iroha {
         return [&] {
           if (first_hash) {
             return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(q.assetId(), "asset_id"),
+                    soci::use(first_hash->hex(), "hash"),
+                    soci::use(query_size, "page_size"));
           } else {
             return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(query_size));
+                    soci::use(q.accountId(), "account_id"),
+                    soci::use(q.assetId(), "asset_id"),
+                    soci::use(query_size, "page_size"));
           }
         };
       };
@@ -892,6 +1106,7 @@ namespace iroha {
                                       query_hash,
                                       std::move(check_query),
                                       related_txs,
+                                      related_txs_count,
                                       apply_query,
                                       Role::kGetMyAccAstTxs,
                                       Role::kGetAllAccAstTxs,
@@ -947,11 +1162,13 @@ namespace iroha {
               page_data
               right join has_perms on true
       )",
-                             hasQueryPermissionTarget(creator_id,
-                                                      q.accountId(),
-                                                      Role::kGetMyAccAst,
-                                                      Role::kGetAllAccAst,
-                                                      Role::kGetDomainAccAst));
+                             hasQueryPermissionTarget(
+                                 creator_id,
+                                 q.accountId(),
+                                 Role::kGetMyAccAst,
+                                 Role::kGetAllAccAst,
+                                 Role::kGetDomainAccAst,
+                                 cachedRolePermissions(creator_id)));
 
       // These must stay alive while soci query is being done.
       const auto pagination_meta{q.paginationMeta()};
@@ -1039,55 +1256,48 @@ namespace iroha {
           fmt::format(R"(
       with {},
       detail AS (
-          with filtered_plain_data as (
-              select row_number() over () rn, *
-              from (
-                  select
-                      data_by_writer.key writer,
-                      plain_data.key as key,
-                      plain_data.value as value
-                  from
-                      jsonb_each((
-                          select data
-                          from account
-                          where account_id = :account_id
-                      )) data_by_writer,
-                  jsonb_each(data_by_writer.value) plain_data
-                  where
-                      coalesce(data_by_writer.key = :writer, true) and
-                      coalesce(plain_data.key = :key, true)
-                  order by data_by_writer.key asc, plain_data.key asc
-              ) t
+          with page_start as (
+              select writer, key
+              from account_detail
+              where
+                  account_id = :account_id and
+                  coalesce(writer = :writer, true) and
+                  coalesce(key = :key, true) and
+                  coalesce(writer = :first_record_writer, true) and
+                  coalesce(key = :first_record_key, true)
+              order by writer, key
+              limit 1
           ),
-          page_limits as (
-              select start.rn as start, start.rn + :page_size as end
-                  from (
-                      select rn
-                      from filtered_plain_data
-                      where
-                          coalesce(writer = :first_record_writer, true) and
-                          coalesce(key = :first_record_key, true)
-                      limit 1
-                  ) start
+          page_data as (
+              select
+                  row_number() over (order by d.writer, d.key) rn,
+                  d.writer,
+                  d.key,
+                  d.value
+              from account_detail d, page_start
+              where
+                  d.account_id = :account_id and
+                  coalesce(d.writer = :writer, true) and
+                  coalesce(d.key = :key, true) and
+                  (d.writer, d.key) >= (page_start.writer, page_start.key)
+              order by d.writer, d.key
+              limit :page_size + 1
           ),
-          total_number as (select count(1) total_number from filtered_plain_data),
+          total_number as ({}),
           next_record as (
               select writer, key
-              from
-                  filtered_plain_data,
-                  page_limits
-              where rn = page_limits.end
+              from page_data
+              where rn = :page_size + 1
           ),
           page as (
-              select json_object_agg(writer, data_by_writer) json
+              select json_object_agg(writer, data_by_writer order by writer)
+                  json
               from (
-                  select writer, json_object_agg(key, value) data_by_writer
-                  from
-                      filtered_plain_data,
-                      page_limits
-                  where
-                      rn >= page_limits.start and
-                      coalesce(rn < page_limits.end, true)
+                  select
+                      writer,
+                      json_object_agg(key, value order by key) data_by_writer
+                  from page_data
+                  where coalesce(rn <= :page_size, true)
                   group by writer
               ) t
           ),
@@ -1111,11 +1321,15 @@ namespace iroha {
       select detail.*, perm from detail
       right join has_perms on true
       )",
-                      hasQueryPermissionTarget(creator_id,
-                                               q.accountId(),
-                                               Role::kGetMyAccDetail,
-                                               Role::kGetAllAccDetail,
-                                               Role::kGetDomainAccDetail));
+                      hasQueryPermissionTarget(
+                          creator_id,
+                          q.accountId(),
+                          Role::kGetMyAccDetail,
+                          Role::kGetAllAccDetail,
+                          Role::kGetDomainAccDetail,
+                          cachedRolePermissions(creator_id)),
+                      q.key() ? kAccountDetailsWithKeyCountSql
+                              : kAccountDetailsCountSql);
 
       const auto writer = q.writer();
       const auto key = q.key();
@@ -1478,13 +1692,16 @@ namespace iroha {
         const shared_model::interface::GetEngineReceipts &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
+      // the hash is normalized, so that malformed hex does not fail decoding
+      const std::string tx_hash =
+          shared_model::crypto::Hash::fromHexString(q.txHash()).hex();
       auto cmd = fmt::format(
           R"(
             with
               target as (
                 select distinct creator_id as t
                 from tx_positions
-                where hash=lower(:tx_hash)
+                where hash=decode(:tx_hash, 'hex')
               ),
               {}
             select
@@ -1509,7 +1726,8 @@ namespace iroha {
           hasQueryPermissionInternal(creator_id,
                                      Role::kGetMyEngineReceipts,
                                      Role::kGetAllEngineReceipts,
-                                     Role::kGetDomainEngineReceipts));
+                                     Role::kGetDomainEngineReceipts,
+                                     cachedRolePermissions(creator_id)));
 
       using QueryTuple =
           QueryType<shared_model::interface::types::CommandIndexType,
@@ -1526,7 +1744,7 @@ namespace iroha {
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
-            return (sql_.prepare << cmd, soci::use(q.txHash(), "tx_hash"));
+            return (sql_.prepare << cmd, soci::use(tx_hash, "tx_hash"));
           },
           query_hash,
           [&](auto range, auto &) {
@@ -9,6 +9,7 @@
 #include "ametsuchi/specific_query_executor.hpp"
 
 #include <soci/soci.h>
+#include <boost/optional.hpp>
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger_fwd.hpp"
@@ -40,6 +41,7 @@ namespace iroha {
   namespace ametsuchi {
 
     class BlockStorage;
+    class WsvCache;
 
     using QueryErrorType =
         shared_model::interface::QueryResponseFactory::ErrorQueryType;
@@ -50,6 +52,10 @@ namespace iroha {
 
     class PostgresSpecificQueryExecutor : public SpecificQueryExecutor {
      public:
+      /**
+       * @param wsv_cache - cache of committed state, optional. Must only be
+       * set when the session does not see uncommitted changes
+       */
       PostgresSpecificQueryExecutor(
           soci::session &sql,
           BlockStorage &block_store,
@@ -58,7 +64,8 @@ namespace iroha {
               response_factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<WsvCache> wsv_cache = nullptr);
 
       QueryExecutorResult execute(
           const shared_model::interface::Query &qry) override;
@@ -138,6 +145,15 @@ namespace iroha {
           const shared_model::interface::types::HashType &query_hash);
 
      private:
+      /**
+       * @param account_id - account to look up
+       * @return union of permissions of the account roles from the cache,
+       * read and cached if missing, or none if there is no cache or the
+       * permissions cannot be read
+       */
+      boost::optional<shared_model::interface::RolePermissionSet>
+      cachedRolePermissions(const std::string &account_id) const;
+
       /**
        * Get transactions from block using range from range_gen and filtered by
        * predicate pred and store them in dest_it
@@ -198,8 +214,10 @@ namespace iroha {
        * @param query_hash - hash of query
        * @param qry_checker - fallback checker of the query, needed if paging
        * hash is not specified and 0 transaction are returned as a query result
-       * @param related_txs - SQL query which returns transaction relevant
-       * to this query
+       * @param related_txs - SQL condition which selects positions of
+       * transactions relevant to this query
+       * @param related_txs_count - SQL condition which selects the counter of
+       * transactions relevant to this query
        * @param applier - function which accepts SQL
        * and returns another function which executes that query
        * @param perms - permissions, necessary to execute the query
@@ -215,6 +233,7 @@ namespace iroha {
           const shared_model::interface::types::HashType &query_hash,
           QueryChecker &&qry_checker,
           char const *related_txs,
+          char const *related_txs_count,
           QueryApplier applier,
           Permissions... perms);
 
@@ -268,6 +287,7 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
       logger::LoggerPtr log_;
+      std::shared_ptr<WsvCache> wsv_cache_;
       std::string ordering_str_;
     };
 
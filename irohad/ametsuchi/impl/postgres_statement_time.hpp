@@ -0,0 +1,31 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_POSTGRES_STATEMENT_TIME_HPP
+#define IROHA_AMETSUCHI_POSTGRES_STATEMENT_TIME_HPP
+
+#include <string>
+
+#include "metrics/metrics.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * @param statement - name of a Postgres statement executed by the peer
+     * @return histogram of the execution time of the statement
+     */
+    inline metrics::Histogram &postgresStatementTime(
+        const std::string &statement) {
+      return metrics::registry().histogram(
+          "iroha_postgres_statement_microseconds",
+          "Execution time of Postgres statements",
+          {{"statement", statement}});
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_POSTGRES_STATEMENT_TIME_HPP
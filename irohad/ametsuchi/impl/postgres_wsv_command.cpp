@@ -179,9 +179,21 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::insertAccount(
         const shared_model::interface::Account &account) {
+      // details are inserted and counted after the account in the same
+      // statement
       soci::statement st = sql_.prepare
-          << "INSERT INTO account(account_id, domain_id, quorum,"
-             "data) VALUES (:id, :domain_id, :quorum, :data)";
+          << "WITH inserted AS ("
+             "INSERT INTO account(account_id, domain_id, quorum) "
+             "VALUES (:id, :domain_id, :quorum) RETURNING account_id), "
+             "details AS ("
+             "INSERT INTO account_detail(account_id, writer, key, value) "
+             "SELECT inserted.account_id, data_by_writer.key, plain_data.key, "
+             "plain_data.value FROM inserted, "
+             "jsonb_each(COALESCE(NULLIF(:data, ''), '{}')::jsonb) "
+             "data_by_writer, jsonb_each(data_by_writer.value) plain_data "
+             "RETURNING account_id, writer) "
+             "INSERT INTO account_detail_count(account_id, writer, count) "
+             "SELECT account_id, writer, count(*) FROM details GROUP BY 1, 2";
       uint32_t quorum = account.quorum();
       st.exchange(soci::use(account.accountId()));
       st.exchange(soci::use(account.domainId()));
@@ -382,21 +394,26 @@ namespace iroha {
         const shared_model::interface::types::AccountIdType &creator_account_id,
         const std::string &key,
         const std::string &val) {
+      // a new key is counted in the same statement
       soci::statement st = sql_.prepare
-          << "UPDATE account SET data = jsonb_set("
-             "CASE WHEN data ?:creator_account_id THEN data ELSE "
-             "jsonb_set(data, :json, :empty_json) END, "
-             " :filled_json, :val) WHERE account_id=:account_id";
-      std::string json = "{" + creator_account_id + "}";
-      std::string empty_json = "{}";
-      std::string filled_json = "{" + creator_account_id + ", " + key + "}";
+          << "WITH current_value AS ("
+             "SELECT 1 FROM account_detail WHERE account_id = :account_id "
+             "AND writer = :creator_account_id AND key = :key), "
+             "inserted AS ("
+             "INSERT INTO account_detail(account_id, writer, key, value) "
+             "VALUES (:account_id, :creator_account_id, :key, :val::jsonb) "
+             "ON CONFLICT (account_id, writer, key) "
+             "DO UPDATE SET value = EXCLUDED.value) "
+             "INSERT INTO account_detail_count(account_id, writer, count) "
+             "SELECT :account_id, :creator_account_id, 1 "
+             "WHERE NOT EXISTS (SELECT * FROM current_value) "
+             "ON CONFLICT (account_id, writer) "
+             "DO UPDATE SET count = account_detail_count.count + 1";
       std::string value = "\"" + val + "\"";
-      st.exchange(soci::use(creator_account_id));
-      st.exchange(soci::use(json));
-      st.exchange(soci::use(empty_json));
-      st.exchange(soci::use(filled_json));
-      st.exchange(soci::use(value));
-      st.exchange(soci::use(account_id));
+      st.exchange(soci::use(account_id, "account_id"));
+      st.exchange(soci::use(creator_account_id, "creator_account_id"));
+      st.exchange(soci::use(key, "key"));
+      st.exchange(soci::use(value, "val"));
 
       auto msg = [&] {
         return (boost::format(
@@ -0,0 +1,686 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+
+#include <fmt/core.h>
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include "common/files.hpp"
+#include "common/result.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using Identifier = SegmentedLog::Identifier;
+
+namespace {
+  /// "IRSL" in little-endian
+  constexpr uint32_t kRecordMagic = 0x4C535249;
+  constexpr size_t kRecordHeaderSize = 16;
+  constexpr size_t kIndexEntrySize = 16;
+
+  void writeUint32(uint8_t *dest, uint32_t value) {
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      dest[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  }
+
+  void writeUint64(uint8_t *dest, uint64_t value) {
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      dest[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  }
+
+  uint32_t readUint32(const uint8_t *src) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      value |= static_cast<uint32_t>(src[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  uint64_t readUint64(const uint8_t *src) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      value |= static_cast<uint64_t>(src[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  uint32_t checksum(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  bool writeAll(int fd, const uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto written = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      data += written;
+      size -= static_cast<size_t>(written);
+      offset += static_cast<uint64_t>(written);
+    }
+    return true;
+  }
+
+  bool readAll(int fd, uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto read = ::pread(fd, data, size, static_cast<off_t>(offset));
+      if (read < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      if (read == 0) {
+        return false;
+      }
+      data += read;
+      size -= static_cast<size_t>(read);
+      offset += static_cast<uint64_t>(read);
+    }
+    return true;
+  }
+
+  bool syncDirectory(const std::string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return false;
+    }
+    bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+    return synced;
+  }
+}  // namespace
+
+const SegmentedLog::Options SegmentedLog::kDefaultOptions{256 * 1024 * 1024,
+                                                          1};
+const std::string SegmentedLog::kSegmentExtension = ".log";
+const std::string SegmentedLog::kIndexExtension = ".idx";
+const std::regex SegmentedLog::kSegmentFilenameRegex =
+    std::regex("[0-9]{16}\\.log");
+
+// ----------| public API |----------
+
+iroha::expected::Result<std::unique_ptr<SegmentedLog>, std::string>
+SegmentedLog::create(const std::string &path,
+                     Options options,
+                     logger::LoggerPtr log) {
+  boost::system::error_code err;
+  if (not boost::filesystem::is_directory(path, err)
+      and not boost::filesystem::create_directory(path, err)) {
+    return fmt::format(
+        "Cannot create storage dir '{}': {}", path, err.message());
+  }
+
+  auto storage = std::make_unique<SegmentedLog>(
+      path, options, private_tag{}, std::move(log));
+  return storage->load() | [&] { return std::move(storage); };
+}
+
+bool SegmentedLog::add(Identifier id, const Bytes &blob) {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  if (not index_.empty() and id != first_id_ + index_.size()) {
+    log_->warn("insertion for {} failed, because next expected id is {}",
+               id,
+               first_id_ + index_.size());
+    return false;
+  }
+  if (index_.empty()) {
+    first_id_ = id;
+  }
+  return append(id, blob);
+}
+
+bool SegmentedLog::replace(Identifier id, const Bytes &blob) {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  if (index_.empty() or id < first_id_ or id - first_id_ >= index_.size()) {
+    log_->warn("replacement for {} failed, because it does not exist", id);
+    return false;
+  }
+  const auto replaced_segment = index_[id - first_id_].segment;
+  if (not append(id, blob)) {
+    return false;
+  }
+  auto &segment = segments_[replaced_segment];
+  if (segment.number + 1 < segments_.size()
+      and segment.live_size * 2 <= segment.size) {
+    // the record is replaced anyway, failed compaction only wastes space
+    compactSegment(segment);
+  }
+  return true;
+}
+
+boost::optional<SegmentedLog::Bytes> SegmentedLog::get(Identifier id) const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  if (index_.empty() or id < first_id_ or id - first_id_ >= index_.size()) {
+    log_->info("get({}) record not found", id);
+    return boost::none;
+  }
+  const auto &location = index_[id - first_id_];
+  const auto &segment = segments_[location.segment];
+
+  Bytes record(kRecordHeaderSize + location.length);
+  if (not readAll(segment.fd, record.data(), record.size(), location.offset)) {
+    log_->error("get({}) cannot read segment {}: {}",
+                id,
+                location.segment,
+                std::strerror(errno));
+    return boost::none;
+  }
+  const auto *payload = record.data() + kRecordHeaderSize;
+  if (readUint32(record.data()) != kRecordMagic
+      or readUint32(record.data() + 4) != id
+      or readUint32(record.data() + 12)
+          != checksum(payload, location.length)) {
+    log_->error("get({}) record in segment {} is corrupted",
+                id,
+                location.segment);
+    return boost::none;
+  }
+  record.erase(record.begin(),
+               record.begin() + static_cast<std::ptrdiff_t>(kRecordHeaderSize));
+  return record;
+}
+
+boost::optional<SegmentedLog::BytesView> SegmentedLog::getView(
+    Identifier id) const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  if (index_.empty() or id < first_id_ or id - first_id_ >= index_.size()) {
+    log_->info("getView({}) record not found", id);
+    return boost::none;
+  }
+  const auto &location = index_[id - first_id_];
+  const auto &segment = segments_[location.segment];
+  const auto record_end = location.offset + kRecordHeaderSize + location.length;
+
+  std::shared_ptr<const MappedFile> mapping;
+  {
+    std::lock_guard<std::mutex> mapping_lock(mapping_mutex_);
+    if (not segment.mapping or segment.mapping->size() < record_end) {
+      auto mapped = MappedFile::map(segment.fd, segment.size);
+      if (auto error = iroha::expected::resultToOptionalError(mapped)) {
+        log_->error(
+            "getView({}) segment {}: {}", id, location.segment, *error);
+        return boost::none;
+      }
+      segment.mapping = std::move(mapped).assumeValue();
+    }
+    mapping = segment.mapping;
+  }
+
+  const auto *record = mapping->data() + location.offset;
+  const auto *payload = record + kRecordHeaderSize;
+  if (readUint32(record) != kRecordMagic or readUint32(record + 4) != id
+      or readUint32(record + 12) != checksum(payload, location.length)) {
+    log_->error("getView({}) record in segment {} is corrupted",
+                id,
+                location.segment);
+    return boost::none;
+  }
+  return BytesView{std::move(mapping), payload, location.length};
+}
+
+std::string SegmentedLog::directory() const {
+  return dump_dir_;
+}
+
+Identifier SegmentedLog::last_id() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return index_.empty() ? 0 : first_id_ + index_.size() - 1;
+}
+
+iroha::expected::Result<void, std::string> SegmentedLog::forEachIdentifier(
+    IdentifierFunction function) const {
+  Identifier first, count;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    first = first_id_;
+    count = index_.size();
+  }
+  for (Identifier i = 0; i < count; ++i) {
+    auto maybe_error = function(first + i);
+    if (iroha::expected::hasError(maybe_error)) {
+      return maybe_error;
+    }
+  }
+  return {};
+}
+
+void SegmentedLog::reload() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  closeSegments();
+  if (auto error = iroha::expected::resultToOptionalError(load())) {
+    log_->error("Failed to reload segmented log: {}", error.value());
+  }
+}
+
+void SegmentedLog::dropAll() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  closeSegments();
+  iroha::remove_dir_contents(dump_dir_, log_);
+}
+
+bool SegmentedLog::sync() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  return syncActiveSegment();
+}
+
+SegmentedLog::SegmentedLog(std::string path,
+                           Options options,
+                           SegmentedLog::private_tag,
+                           logger::LoggerPtr log)
+    : dump_dir_(std::move(path)),
+      options_(options),
+      first_id_(0),
+      unsynced_records_(0),
+      log_{std::move(log)} {}
+
+SegmentedLog::~SegmentedLog() {
+  syncActiveSegment();
+  closeSegments();
+}
+
+// ----------| private API |----------
+
+std::string SegmentedLog::segmentPath(uint32_t number,
+                                      const std::string &extension) const {
+  return (boost::filesystem::path{dump_dir_}
+          / fmt::format("{:016}{}", number, extension))
+      .string();
+}
+
+iroha::expected::Result<void, std::string> SegmentedLog::load() {
+  std::vector<uint32_t> numbers;
+  for (auto it = boost::filesystem::directory_iterator{dump_dir_};
+       it != boost::filesystem::directory_iterator{};
+       ++it) {
+    auto name = it->path().filename().string();
+    if (std::regex_match(name, kSegmentFilenameRegex)) {
+      numbers.push_back(static_cast<uint32_t>(std::stoul(name)));
+    }
+  }
+  std::sort(numbers.begin(), numbers.end());
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    if (numbers[i] != i) {
+      return fmt::format("Segment {} is missing", i);
+    }
+  }
+
+  for (auto number : numbers) {
+    const bool is_last = number + 1 == numbers.size();
+    const auto path = segmentPath(number, kSegmentExtension);
+    int fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+    if (fd < 0) {
+      return fmt::format(
+          "Cannot open segment {}: {}", number, std::strerror(errno));
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      return fmt::format(
+          "Cannot stat segment {}: {}", number, std::strerror(errno));
+    }
+    segments_.push_back(
+        Segment{number, fd, static_cast<uint64_t>(st.st_size), 0, nullptr});
+    auto &segment = segments_.back();
+
+    const auto index_path = segmentPath(number, kIndexExtension);
+    if (is_last) {
+      // the last segment is active, its index may be stale if the node
+      // stopped between sealing it and creating the next one
+      boost::system::error_code ignored;
+      boost::filesystem::remove(index_path, ignored);
+    }
+    auto entries = (not is_last and boost::filesystem::exists(index_path))
+        ? readIndex(segment)
+        : scanSegment(segment, is_last);
+    if (auto error = iroha::expected::resultToOptionalError(entries)) {
+      return error.value();
+    }
+    if (auto error = iroha::expected::resultToOptionalError(
+            applyEntries(entries.assumeValue()))) {
+      return error.value();
+    }
+    if (is_last) {
+      active_entries_ = std::move(entries).assumeValue();
+    }
+  }
+
+  for (const auto &location : index_) {
+    segments_[location.segment].live_size +=
+        kRecordHeaderSize + location.length;
+  }
+
+  log_->info("Loaded {} records from {} segments",
+             index_.size(),
+             segments_.size());
+  return {};
+}
+
+iroha::expected::Result<std::vector<SegmentedLog::IndexEntry>, std::string>
+SegmentedLog::readIndex(const Segment &segment) const {
+  auto data = iroha::readBinaryFile(segmentPath(segment.number, kIndexExtension));
+  if (auto error = iroha::expected::resultToOptionalError(data)) {
+    return error.value();
+  }
+  const auto &bytes = data.assumeValue();
+  if (bytes.size() % kIndexEntrySize != 0) {
+    return fmt::format("Index of segment {} is corrupted", segment.number);
+  }
+
+  std::vector<IndexEntry> entries;
+  entries.reserve(bytes.size() / kIndexEntrySize);
+  for (size_t pos = 0; pos < bytes.size(); pos += kIndexEntrySize) {
+    IndexEntry entry{readUint32(bytes.data() + pos),
+                     Location{segment.number,
+                              readUint32(bytes.data() + pos + 4),
+                              readUint64(bytes.data() + pos + 8)}};
+    if (entry.location.offset + kRecordHeaderSize + entry.location.length
+        > segment.size) {
+      return fmt::format("Index of segment {} points past its end",
+                         segment.number);
+    }
+    entries.push_back(entry);
+  }
+  return entries;
+}
+
+iroha::expected::Result<std::vector<SegmentedLog::IndexEntry>, std::string>
+SegmentedLog::scanSegment(Segment &segment, bool truncate_tail) const {
+  std::vector<IndexEntry> entries;
+  uint8_t header[kRecordHeaderSize];
+  Bytes payload;
+  uint64_t offset = 0;
+  while (offset + kRecordHeaderSize <= segment.size) {
+    if (not readAll(segment.fd, header, kRecordHeaderSize, offset)
+        or readUint32(header) != kRecordMagic) {
+      break;
+    }
+    const auto length = readUint32(header + 8);
+    if (offset + kRecordHeaderSize + length > segment.size) {
+      break;
+    }
+    payload.resize(length);
+    if (not readAll(
+            segment.fd, payload.data(), length, offset + kRecordHeaderSize)
+        or readUint32(header + 12) != checksum(payload.data(), length)) {
+      break;
+    }
+    entries.push_back(IndexEntry{readUint32(header + 4),
+                                 Location{segment.number, length, offset}});
+    offset += kRecordHeaderSize + length;
+  }
+
+  if (offset != segment.size) {
+    if (not truncate_tail) {
+      return fmt::format("Segment {} is corrupted at offset {}",
+                         segment.number,
+                         offset);
+    }
+    log_->warn("Truncating {} bytes of incomplete record in segment {}",
+               segment.size - offset,
+               segment.number);
+    if (::ftruncate(segment.fd, static_cast<off_t>(offset)) != 0) {
+      return fmt::format(
+          "Cannot truncate segment {}: {}", segment.number, std::strerror(errno));
+    }
+    segment.size = offset;
+  }
+  return entries;
+}
+
+iroha::expected::Result<void, std::string> SegmentedLog::applyEntries(
+    const std::vector<IndexEntry> &entries) {
+  for (const auto &entry : entries) {
+    if (index_.empty()) {
+      first_id_ = entry.id;
+    }
+    if (entry.id == first_id_ + index_.size()) {
+      index_.push_back(entry.location);
+    } else if (entry.id >= first_id_ and entry.id - first_id_ < index_.size()) {
+      index_[entry.id - first_id_] = entry.location;
+    } else {
+      return fmt::format("Record {} in segment {} is out of sequence",
+                         entry.id,
+                         entry.location.segment);
+    }
+  }
+  return {};
+}
+
+bool SegmentedLog::append(Identifier id, const Bytes &blob) {
+  const auto record_size = kRecordHeaderSize + blob.size();
+  if (segments_.empty()) {
+    if (not openSegment(0)) {
+      return false;
+    }
+  } else if (segments_.back().size > 0
+             and segments_.back().size + record_size
+                 > options_.max_segment_size) {
+    if (not sealActiveSegment() or not openSegment(segments_.size())) {
+      return false;
+    }
+  }
+  auto &segment = segments_.back();
+
+  Bytes record(record_size);
+  writeUint32(record.data(), kRecordMagic);
+  writeUint32(record.data() + 4, id);
+  writeUint32(record.data() + 8, static_cast<uint32_t>(blob.size()));
+  writeUint32(record.data() + 12, checksum(blob.data(), blob.size()));
+  std::copy(blob.begin(),
+            blob.end(),
+            record.begin() + static_cast<std::ptrdiff_t>(kRecordHeaderSize));
+
+  if (not writeAll(segment.fd, record.data(), record.size(), segment.size)) {
+    log_->warn("Cannot write record {} to segment {}: {}",
+               id,
+               segment.number,
+               std::strerror(errno));
+    // drop partially written record
+    if (::ftruncate(segment.fd, static_cast<off_t>(segment.size)) != 0) {
+      log_->error("Cannot truncate segment {}", segment.number);
+    }
+    return false;
+  }
+
+  Location location{
+      segment.number, static_cast<uint32_t>(blob.size()), segment.size};
+  segment.size += record_size;
+  segment.live_size += record_size;
+  active_entries_.push_back(IndexEntry{id, location});
+  if (id == first_id_ + index_.size()) {
+    index_.push_back(location);
+  } else {
+    auto &replaced = index_[id - first_id_];
+    segments_[replaced.segment].live_size -=
+        kRecordHeaderSize + replaced.length;
+    replaced = location;
+  }
+
+  if (++unsynced_records_ >= options_.sync_batch_size) {
+    return syncActiveSegment();
+  }
+  return true;
+}
+
+bool SegmentedLog::openSegment(uint32_t number) {
+  const auto path = segmentPath(number, kSegmentExtension);
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    log_->error("Cannot create segment {}: {}", number, std::strerror(errno));
+    return false;
+  }
+  segments_.push_back(Segment{number, fd, 0, 0, nullptr});
+  if (not syncDirectory(dump_dir_)) {
+    log_->warn("Cannot fsync storage dir '{}'", dump_dir_);
+  }
+  return true;
+}
+
+bool SegmentedLog::sealActiveSegment() {
+  if (not syncActiveSegment()) {
+    return false;
+  }
+  if (not writeIndex(segments_.back().number, active_entries_)) {
+    return false;
+  }
+  active_entries_.clear();
+  return true;
+}
+
+bool SegmentedLog::writeIndex(uint32_t number,
+                              const std::vector<IndexEntry> &entries) {
+  Bytes index(entries.size() * kIndexEntrySize);
+  auto *pos = index.data();
+  for (const auto &entry : entries) {
+    writeUint32(pos, entry.id);
+    writeUint32(pos + 4, entry.location.length);
+    writeUint64(pos + 8, entry.location.offset);
+    pos += kIndexEntrySize;
+  }
+
+  const auto index_path = segmentPath(number, kIndexExtension);
+  const auto tmp_index_path = index_path + ".tmp";
+  int fd = ::open(
+      tmp_index_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    log_->error(
+        "Cannot create index of segment {}: {}", number, std::strerror(errno));
+    return false;
+  }
+  bool written =
+      writeAll(fd, index.data(), index.size(), 0) and ::fsync(fd) == 0;
+  ::close(fd);
+  if (not written) {
+    log_->error("Cannot write index of segment {}", number);
+    return false;
+  }
+
+  boost::system::error_code error_code;
+  boost::filesystem::rename(tmp_index_path, index_path, error_code);
+  if (error_code != boost::system::errc::success) {
+    log_->error(
+        "Cannot write index of segment {}: {}", number, error_code.message());
+    return false;
+  }
+  return true;
+}
+
+bool SegmentedLog::compactSegment(Segment &segment) {
+  const auto path = segmentPath(segment.number, kSegmentExtension);
+  const auto tmp_path = path + ".tmp";
+  int fd =
+      ::open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    log_->error("Cannot create compacted segment {}: {}",
+                segment.number,
+                std::strerror(errno));
+    return false;
+  }
+  auto fail = [&](const char *step) {
+    log_->error("Cannot compact segment {}, {} failed: {}",
+                segment.number,
+                step,
+                std::strerror(errno));
+    ::close(fd);
+    boost::system::error_code ignored;
+    boost::filesystem::remove(tmp_path, ignored);
+    return false;
+  };
+
+  // the records which are not replaced are copied with their headers
+  std::vector<IndexEntry> entries;
+  Bytes record;
+  uint64_t size = 0;
+  for (size_t i = 0; i < index_.size(); ++i) {
+    const auto &location = index_[i];
+    if (location.segment != segment.number) {
+      continue;
+    }
+    record.resize(kRecordHeaderSize + location.length);
+    if (not readAll(segment.fd, record.data(), record.size(), location.offset)
+        or not writeAll(fd, record.data(), record.size(), size)) {
+      return fail("copying");
+    }
+    entries.push_back(
+        IndexEntry{static_cast<Identifier>(first_id_ + i),
+                   Location{segment.number, location.length, size}});
+    size += record.size();
+  }
+  if (::fdatasync(fd) != 0) {
+    return fail("fsync");
+  }
+
+  // a segment without index is scanned on load, which is valid both for the
+  // old and the compacted segment, so the index is written after the rename
+  boost::system::error_code error_code;
+  boost::filesystem::remove(segmentPath(segment.number, kIndexExtension),
+                            error_code);
+  if (error_code != boost::system::errc::success
+      or not syncDirectory(dump_dir_)) {
+    return fail("index removal");
+  }
+  if (::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    return fail("rename");
+  }
+  if (not syncDirectory(dump_dir_)) {
+    log_->warn("Cannot fsync storage dir '{}'", dump_dir_);
+  }
+
+  log_->info("Compacted segment {} from {} to {} bytes",
+             segment.number,
+             segment.size,
+             size);
+  ::close(segment.fd);
+  segment.fd = fd;
+  segment.size = size;
+  segment.live_size = size;
+  segment.mapping.reset();
+  for (const auto &entry : entries) {
+    index_[entry.id - first_id_] = entry.location;
+  }
+  return writeIndex(segment.number, entries);
+}
+
+bool SegmentedLog::syncActiveSegment() {
+  if (unsynced_records_ == 0 or segments_.empty()) {
+    return true;
+  }
+  if (::fdatasync(segments_.back().fd) != 0) {
+    log_->error("Cannot fsync segment {}: {}",
+                segments_.back().number,
+                std::strerror(errno));
+    return false;
+  }
+  unsynced_records_ = 0;
+  return true;
+}
+
+void SegmentedLog::closeSegments() {
+  for (auto &segment : segments_) {
+    ::close(segment.fd);
+  }
+  segments_.clear();
+  index_.clear();
+  active_entries_.clear();
+  first_id_ = 0;
+  unsynced_records_ = 0;
+}
@@ -0,0 +1,196 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENTED_LOG_HPP
+#define IROHA_SEGMENTED_LOG_HPP
+
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <shared_mutex>
+
+#include "ametsuchi/impl/mapped_file.hpp"
+#include "ametsuchi/key_value_storage.hpp"
+#include "common/result_fwd.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Append-only storage which writes entities as records to large segment
+     * files instead of a file per entity.
+     *
+     * Every record consists of a 16-byte header (magic, id, payload length and
+     * CRC-32 of the payload) followed by the payload. A segment is sealed when
+     * it grows over the configured size, and an index file with the locations
+     * of its records is written next to it, so that startup reads only the
+     * index files and scans the last (active) segment. A torn record at the
+     * tail of the active segment is truncated during the scan.
+     *
+     * Keys must be added sequentially. Replacing an entity appends a new
+     * record for the same key; the latest record wins. A sealed segment is
+     * rewritten without the replaced records once they take half of it, so
+     * that replacing all entities does not double the size of the log.
+     */
+    class SegmentedLog : public KeyValueStorage {
+      /**
+       * Private tag used to construct unique and shared pointers
+       * without new operator
+       */
+      struct private_tag {};
+
+     public:
+      struct Options {
+        /// segment is sealed once its size reaches this value
+        uint64_t max_segment_size;
+        /// number of appended records per fsync; 1 syncs every record
+        size_t sync_batch_size;
+      };
+
+      static const Options kDefaultOptions;
+
+      static const std::string kSegmentExtension;
+
+      static const std::string kIndexExtension;
+
+      static const std::regex kSegmentFilenameRegex;
+
+      /**
+       * Create storage in path, recovering records written before
+       * @param path - target path for creating
+       * @param options - segment size and sync policy
+       * @param log - logger
+       * @return created storage or an error if the existing log is corrupted
+       */
+      static iroha::expected::Result<std::unique_ptr<SegmentedLog>,
+                                     std::string>
+      create(const std::string &path, Options options, logger::LoggerPtr log);
+
+      bool add(Identifier id, const Bytes &blob) override;
+
+      bool replace(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      boost::optional<BytesView> getView(Identifier id) const override;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      expected::Result<void, std::string> forEachIdentifier(
+          IdentifierFunction function) const override;
+
+      void reload() override;
+
+      void dropAll() override;
+
+      /**
+       * Force fsync of records appended since the last sync
+       * @return true on success
+       */
+      bool sync();
+
+      SegmentedLog(const SegmentedLog &rhs) = delete;
+
+      SegmentedLog(SegmentedLog &&rhs) = delete;
+
+      SegmentedLog &operator=(const SegmentedLog &rhs) = delete;
+
+      SegmentedLog &operator=(SegmentedLog &&rhs) = delete;
+
+      SegmentedLog(std::string path,
+                   Options options,
+                   SegmentedLog::private_tag,
+                   logger::LoggerPtr log);
+
+      ~SegmentedLog() override;
+
+     private:
+      /// position of a record payload
+      struct Location {
+        uint32_t segment;
+        uint32_t length;
+        uint64_t offset;
+      };
+
+      /// entry of a segment index file
+      struct IndexEntry {
+        Identifier id;
+        Location location;
+      };
+
+      struct Segment {
+        uint32_t number;
+        int fd;
+        uint64_t size;
+        /// size of the records which are not replaced by later ones
+        uint64_t live_size;
+        /// read-only mapping of the segment, remapped when it grows
+        mutable std::shared_ptr<const MappedFile> mapping;
+      };
+
+      std::string segmentPath(uint32_t number,
+                              const std::string &extension) const;
+
+      /// read segment list and indices from disk
+      expected::Result<void, std::string> load();
+
+      /// collect records of a sealed segment from its index file
+      expected::Result<std::vector<IndexEntry>, std::string> readIndex(
+          const Segment &segment) const;
+
+      /// collect records of a segment by scanning it, truncate a torn tail
+      expected::Result<std::vector<IndexEntry>, std::string> scanSegment(
+          Segment &segment, bool truncate_tail) const;
+
+      /// add entries to the in-memory index
+      expected::Result<void, std::string> applyEntries(
+          const std::vector<IndexEntry> &entries);
+
+      bool append(Identifier id, const Bytes &blob);
+
+      bool openSegment(uint32_t number);
+
+      bool sealActiveSegment();
+
+      /// write the index file of a segment
+      bool writeIndex(uint32_t number, const std::vector<IndexEntry> &entries);
+
+      /// rewrite a sealed segment without the replaced records
+      bool compactSegment(Segment &segment);
+
+      bool syncActiveSegment();
+
+      void closeSegments();
+
+      const std::string dump_dir_;
+
+      const Options options_;
+
+      mutable std::shared_timed_mutex mutex_;
+
+      /// guards creation of segment mappings under the shared lock
+      mutable std::mutex mapping_mutex_;
+
+      std::vector<Segment> segments_;
+
+      /// key of the first stored entity, index_[i] describes first_id_ + i
+      Identifier first_id_;
+
+      std::vector<Location> index_;
+
+      /// records of the active segment, written to its index when sealed
+      std::vector<IndexEntry> active_entries_;
+
+      size_t unsynced_records_;
+
+      logger::LoggerPtr log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENTED_LOG_HPP
@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include <chrono>
 #include <utility>
 
 #include <soci/callbacks.h>
@@ -27,15 +28,67 @@
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
+#include "ametsuchi/impl/tx_hash_filter.hpp"
+#include "ametsuchi/impl/wsv_snapshot.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "common/bind.hpp"
 #include "common/byteutils.hpp"
 #include "common/result.hpp"
+#include "common/thread_pool.hpp"
+#include "cryptography/hash.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "main/impl/pg_connection_init.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/transaction_stages.hpp"
+
+namespace {
+  /**
+   * Add hashes of all the indexed transactions to the filter
+   * @return error description if the hashes could not be read
+   */
+  iroha::expected::Result<void, std::string> loadTxHashFilter(
+      soci::session &sql, iroha::ametsuchi::TxHashFilter &tx_hash_filter) {
+    try {
+      soci::rowset<std::string> hashes =
+          (sql.prepare
+           << "SELECT encode(hash, 'hex') FROM tx_status_by_hash");
+      for (const auto &hash : hashes) {
+        tx_hash_filter.add(shared_model::crypto::Hash::fromHexString(hash));
+      }
+    } catch (const std::exception &e) {
+      return fmt::format("Failed to load transaction hashes: {}", e.what());
+    }
+    return {};
+  }
+
+  /**
+   * Read the ledger state from WSV
+   * @return ledger state or boost::none if WSV is empty
+   */
+  boost::optional<std::shared_ptr<const iroha::LedgerState>> loadLedgerState(
+      soci::session &sql, const logger::LoggerManagerTreePtr &log_manager) {
+    using iroha::operator|;
+    iroha::ametsuchi::PostgresWsvQuery wsv_query(
+        sql, log_manager->getChild("WsvQuery")->getLogger());
+
+    return iroha::expected::resultToOptionalValue(wsv_query.getTopBlockInfo())
+               | [&](auto &&top_block_info) {
+                   return wsv_query.getPeers() |
+                       [&top_block_info](auto &&ledger_peers) {
+                         return boost::make_optional(
+                             std::make_shared<const iroha::LedgerState>(
+                                 std::move(ledger_peers),
+                                 top_block_info.height,
+                                 top_block_info.top_hash));
+                       };
+                 };
+  }
+}  // namespace
 
 namespace iroha {
   namespace ametsuchi {
@@ -57,6 +110,8 @@ namespace iroha {
         std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
         size_t pool_size,
         std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
+        std::shared_ptr<WsvCache> wsv_cache,
+        std::shared_ptr<TxHashFilter> tx_hash_filter,
         logger::LoggerManagerTreePtr log_manager)
         : block_store_(std::move(block_store)),
           pool_wrapper_(std::move(pool_wrapper)),
@@ -68,6 +123,8 @@ namespace iroha {
           temporary_block_storage_factory_(
               std::move(temporary_block_storage_factory)),
           vm_caller_ref_(std::move(vm_caller_ref)),
+          wsv_cache_(std::move(wsv_cache)),
+          tx_hash_filter_(std::move(tx_hash_filter)),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()),
           pool_size_(pool_size),
@@ -75,7 +132,19 @@ namespace iroha {
               pool_wrapper_->enable_prepared_transactions_),
           block_is_prepared_(false),
           prepared_block_name_(postgres_options.preparedBlockName()),
-          ledger_state_(std::move(ledger_state)) {}
+          preparation_pool_(std::make_unique<ThreadPool>(1)),
+          ledger_state_(std::move(ledger_state)),
+          block_height_(metrics::registry().gauge(
+              "iroha_ledger_block_height", "Height of the top block")),
+          block_size_(metrics::registry().histogram(
+              "iroha_ledger_block_bytes", "Size of committed blocks")),
+          preparation_time_(metrics::registry().histogram(
+              "iroha_ledger_block_preparation_microseconds",
+              "Time of writing the state of a block during consensus")),
+          preparation_wait_time_(metrics::registry().histogram(
+              "iroha_ledger_prepared_commit_wait_microseconds",
+              "Time the commit of a block waited for its state to be "
+              "prepared")) {}
 
     std::unique_ptr<TemporaryWsv> StorageImpl::createTemporaryWsv(
         std::shared_ptr<CommandExecutor> command_executor) {
@@ -90,7 +159,8 @@ namespace iroha {
       tryRollback(postgres_command_executor->getSession());
       return std::make_unique<TemporaryWsvImpl>(
           std::move(postgres_command_executor),
-          log_manager_->getChild("TemporaryWorldStateView"));
+          log_manager_->getChild("TemporaryWorldStateView"),
+          wsv_cache_);
     }
 
     expected::Result<std::unique_ptr<MutableStorage>, std::string>
@@ -139,7 +209,8 @@ namespace iroha {
               std::move(pending_txs_storage),
               response_factory,
               perm_converter_,
-              log_manager->getChild("SpecificQueryExecutor")->getLogger()),
+              log_manager->getChild("SpecificQueryExecutor")->getLogger(),
+              wsv_cache_),
           log_manager->getLogger());
     }
 
@@ -205,7 +276,105 @@ namespace iroha {
           ledger_state_,
           std::move(postgres_command_executor),
           storage_factory.create().assumeValue(),
-          log_manager_->getChild("MutableStorageImpl"));
+          log_manager_->getChild("MutableStorageImpl"),
+          tx_hash_filter_);
+    }
+
+    expected::Result<std::unique_ptr<MutableStorage>, std::string>
+    StorageImpl::createBulkMutableStorage(
+        std::shared_ptr<CommandExecutor> command_executor,
+        BlockStorageFactory &storage_factory) {
+      auto postgres_command_executor =
+          std::dynamic_pointer_cast<PostgresCommandExecutor>(command_executor);
+      if (postgres_command_executor == nullptr) {
+        throw std::runtime_error("Bad PostgresCommandExecutor cast!");
+      }
+      tryRollback(postgres_command_executor->getSession());
+      auto mutable_storage = std::make_unique<MutableStorageImpl>(
+          ledger_state_,
+          std::move(postgres_command_executor),
+          storage_factory.create().assumeValue(),
+          log_manager_->getChild("MutableStorageImpl"),
+          tx_hash_filter_,
+          true);
+      // indices are dropped inside the transaction of the mutable storage, so
+      // they are restored if it is not committed
+      auto dropped =
+          PgConnectionInit::dropTransactionIndices(mutable_storage->sql_);
+      if (auto e = expected::resultToOptionalError(dropped)) {
+        return e.value();
+      }
+      return std::unique_ptr<MutableStorage>(std::move(mutable_storage));
+    }
+
+    expected::Result<void, std::string> StorageImpl::exportWsvSnapshot(
+        std::ostream &snapshot) {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      if (not connection_) {
+        return "exportWsvSnapshot: connection to database is not initialised";
+      }
+      if (not ledger_state_) {
+        return "WSV is empty";
+      }
+      const auto height = ledger_state_.value()->top_block_info.height;
+      auto top_block = block_store_->fetch(height);
+      if (not top_block) {
+        return fmt::format("Failed to fetch WSV top block {}", height);
+      }
+      soci::session sql(*connection_);
+      return writeWsvSnapshot(sql, **top_block, snapshot);
+    }
+
+    expected::Result<void, std::string> StorageImpl::importWsvSnapshot(
+        std::istream &snapshot) {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      if (not connection_) {
+        return "importWsvSnapshot: connection to database is not initialised";
+      }
+      if (ledger_state_ or block_store_->size() != 0) {
+        return "WSV snapshot can only be imported into empty storage";
+      }
+
+      soci::session sql(*connection_);
+      try {
+        sql << "BEGIN";
+        auto top_block = readWsvSnapshot(sql, snapshot);
+        if (auto e = expected::resultToOptionalError(top_block)) {
+          sql << "ROLLBACK";
+          return e.value();
+        }
+        auto block = std::shared_ptr<const shared_model::interface::Block>(
+            std::move(top_block).assumeValue());
+        // block storages which count blocks instead of tracking the top
+        // height cannot start from the snapshot
+        if (not block_store_->insert(block)
+            or block_store_->size() != block->height()) {
+          block_store_->clear();
+          sql << "ROLLBACK";
+          return fmt::format(
+              "Block storage cannot start from WSV snapshot height {}",
+              block->height());
+        }
+        sql << "COMMIT";
+        log_->info("Imported WSV snapshot at height {}", block->height());
+      } catch (const std::exception &e) {
+        block_store_->clear();
+        try {
+          sql << "ROLLBACK";
+        } catch (const std::exception &) {
+          // the transaction is already finished
+        }
+        return fmt::format("Failed to import WSV snapshot: {}", e.what());
+      }
+
+      if (tx_hash_filter_) {
+        if (auto e = expected::resultToOptionalError(
+                loadTxHashFilter(sql, *tx_hash_filter_))) {
+          return e.value();
+        }
+      }
+      ledger_state_ = loadLedgerState(sql, log_manager_);
+      return {};
     }
 
     void StorageImpl::resetPeers() {
@@ -259,26 +428,20 @@ namespace iroha {
         std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
         std::shared_ptr<BlockStorage> persistent_block_storage,
         std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
+        std::shared_ptr<WsvCache> wsv_cache,
+        std::shared_ptr<TxHashFilter> tx_hash_filter,
         logger::LoggerManagerTreePtr log_manager,
         size_t pool_size) {
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state;
       {
         soci::session sql{*pool_wrapper->connection_pool_};
-        PostgresWsvQuery wsv_query(
-            sql, log_manager->getChild("WsvQuery")->getLogger());
-
-        ledger_state =
-            expected::resultToOptionalValue(wsv_query.getTopBlockInfo()) |
-            [&](auto &&top_block_info) {
-              return wsv_query.getPeers() |
-                  [&top_block_info](auto &&ledger_peers) {
-                    return boost::make_optional(
-                        std::make_shared<const iroha::LedgerState>(
-                            std::move(ledger_peers),
-                            top_block_info.height,
-                            top_block_info.top_hash));
-                  };
-            };
+        if (tx_hash_filter) {
+          if (auto e = expected::resultToOptionalError(
+                  loadTxHashFilter(sql, *tx_hash_filter))) {
+            return e.value();
+          }
+        }
+        ledger_state = loadLedgerState(sql, log_manager);
       }
 
       return expected::makeValue(std::shared_ptr<StorageImpl>(
@@ -292,6 +455,8 @@ namespace iroha {
                           std::move(temporary_block_storage_factory),
                           pool_size,
                           std::move(vm_caller_ref),
+                          std::move(wsv_cache),
+                          std::move(tx_hash_filter),
                           std::move(log_manager))));
     }
 
@@ -305,8 +470,15 @@ namespace iroha {
         for (auto height = old_height + 1; height <= new_height; ++height) {
           auto maybe_block = block_store_->fetch(height);
           if (not maybe_block) {
+            if (wsv_cache_) {
+              wsv_cache_->clear();
+            }
             return fmt::format("Failed to fetch block {}", height);
           }
+          if (wsv_cache_) {
+            wsv_cache_->applyBlock(**maybe_block);
+          }
+          observeCommittedBlock(**maybe_block);
           notifier_.get_subscriber().on_next(*std::move(maybe_block));
         }
         return expected::makeValue(std::move(commit_result.ledger_state));
@@ -324,9 +496,17 @@ namespace iroha {
             std::string{"prepared blocks are not enabled"});
       }
 
+      auto wait_start = std::chrono::steady_clock::now();
+      waitForPreparation();
+      preparation_wait_time_.observeSince(wait_start);
       if (not block_is_prepared_) {
         return expected::makeError("there are no prepared blocks");
       }
+      shared_model::interface::types::HashType prepared_block_hash;
+      {
+        std::lock_guard<std::mutex> lock(preparation_mutex_);
+        prepared_block_hash = prepared_block_hash_;
+      }
 
       log_->info("applying prepared block");
 
@@ -338,41 +518,37 @@ namespace iroha {
           return expected::makeError(std::move(msg));
         }
 
+        soci::session sql(*connection_);
+        if (block->hash() != prepared_block_hash) {
+          // the prepared state holds locks which the block being applied
+          // instead would wait for
+          tryRollback(sql);
+          return fmt::format("prepared state was created for block {}",
+                             prepared_block_hash.hex());
+        }
+
         if (not block_store_->insert(block)) {
           return fmt::format("Failed to insert block {}", *block);
         }
 
-        soci::session sql(*connection_);
+        // indices and top block info were written to the prepared state
         sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
-        PostgresBlockIndex block_index(
-            std::make_unique<PostgresIndexer>(sql),
-            log_manager_->getChild("BlockIndex")->getLogger());
-        block_index.index(*block);
         block_is_prepared_ = false;
-
-        if (auto e = expected::resultToOptionalError(
-                PostgresWsvCommand{sql}.setTopBlockInfo(
-                    TopBlockInfo{block->height(), block->hash()}))) {
-          throw std::runtime_error(e.value());
+        if (wsv_cache_) {
+          wsv_cache_->applyBlock(*block);
         }
+        observeCommittedBlock(*block);
 
         notifier_.get_subscriber().on_next(block);
 
-        decltype(std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
-        {
-          auto peer_query = PostgresWsvQuery(
-              sql, this->log_manager_->getChild("WsvQuery")->getLogger());
-          if (not(opt_ledger_peers = peer_query.getPeers())) {
-            return expected::makeError(
-                std::string{"Failed to get ledger peers! Will retry."});
-          }
-        }
-        assert(opt_ledger_peers);
-
         ledger_state_ = std::make_shared<const LedgerState>(
-            std::move(*opt_ledger_peers), block->height(), block->hash());
+            std::move(prepared_ledger_peers_), block->height(), block->hash());
         return expected::makeValue(ledger_state_.value());
       } catch (const std::exception &e) {
+        if (wsv_cache_) {
+          // the state is unknown after a partial commit
+          wsv_cache_->clear();
+        }
         std::string msg((boost::format("failed to apply prepared block %s: %s")
                          % block->hash().hex() % e.what())
                             .str());
@@ -380,6 +556,16 @@ namespace iroha {
       }
     }
 
+    void StorageImpl::observeCommittedBlock(
+        const shared_model::interface::Block &block) {
+      block_height_.set(block.height());
+      block_size_.observe(block.blob().size());
+      for (const auto &tx : block.transactions()) {
+        metrics::transactionStages().finished(
+            tx.hash(), metrics::TransactionStages::kCommit);
+      }
+    }
+
     std::shared_ptr<WsvQuery> StorageImpl::getWsvQuery() const {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
       if (not connection_) {
@@ -423,31 +609,98 @@ namespace iroha {
       return notifier_.get_observable();
     }
 
-    void StorageImpl::prepareBlock(std::unique_ptr<TemporaryWsv> wsv) {
-      auto &wsv_impl = static_cast<TemporaryWsvImpl &>(*wsv);
+    void StorageImpl::prepareBlock(
+        std::unique_ptr<TemporaryWsv> wsv,
+        std::shared_ptr<const shared_model::interface::Block> block) {
       if (not prepared_blocks_enabled_) {
         log_->warn("prepared blocks are not enabled");
         return;
       }
+      waitForPreparation();
       if (block_is_prepared_) {
         log_->warn(
             "Refusing to add new prepared state, because there already is one. "
             "Multiple prepared states are not yet supported.");
-      } else {
-        soci::session &sql = wsv_impl.sql_;
-        try {
-          sql << "PREPARE TRANSACTION '" + prepared_block_name_ + "';";
-          block_is_prepared_ = true;
-        } catch (const std::exception &e) {
-          log_->warn("failed to prepare state: {}", e.what());
+        return;
+      }
+
+      // the state is reserved before the block is passed to consensus, so
+      // that the block is not applied while its state holds the locks
+      std::lock_guard<std::mutex> lock(preparation_mutex_);
+      prepared_block_hash_ = block->hash();
+      block_is_prepared_ = true;
+      preparation_ =
+          preparation_pool_
+              ->submit([this, wsv = std::move(wsv), block = std::move(block)] {
+                auto start = std::chrono::steady_clock::now();
+                if (not writePreparedState(*wsv, *block)) {
+                  block_is_prepared_ = false;
+                }
+                preparation_time_.observeSince(start);
+              })
+              .share();
+    }
+
+    bool StorageImpl::writePreparedState(
+        TemporaryWsv &wsv, const shared_model::interface::Block &block) {
+      soci::session &sql = static_cast<TemporaryWsvImpl &>(wsv).sql_;
+      try {
+        // everything the commit of the block writes besides the block store
+        // is written now, while consensus on the block is in progress
+        PostgresBlockIndex block_index(
+            std::make_unique<PostgresIndexer>(sql, tx_hash_filter_),
+            log_manager_->getChild("BlockIndex")->getLogger());
+        block_index.index(block);
+
+        if (auto e = expected::resultToOptionalError(
+                PostgresWsvCommand{sql}.setTopBlockInfo(
+                    TopBlockInfo{block.height(), block.hash()}))) {
+          throw std::runtime_error(e.value());
         }
 
-        log_->info("state prepared successfully");
+        auto opt_ledger_peers =
+            PostgresWsvQuery(
+                sql, log_manager_->getChild("WsvQuery")->getLogger())
+                .getPeers();
+        if (not opt_ledger_peers) {
+          throw std::runtime_error("failed to get ledger peers");
+        }
+
+        sql << "PREPARE TRANSACTION '" + prepared_block_name_ + "';";
+
+        // an aborted transaction is rolled back by PREPARE without an error
+        int prepared = 0;
+        sql << "SELECT count(*) FROM pg_prepared_xacts WHERE gid = :name",
+            soci::use(prepared_block_name_), soci::into(prepared);
+        if (prepared == 0) {
+          log_->warn("failed to prepare state of block {}", block.hash().hex());
+          return false;
+        }
+
+        prepared_ledger_peers_ = std::move(*opt_ledger_peers);
+      } catch (const std::exception &e) {
+        log_->warn("failed to prepare state: {}", e.what());
+        return false;
+      }
+
+      log_->info("state prepared successfully");
+      return true;
+    }
+
+    void StorageImpl::waitForPreparation() {
+      std::shared_future<void> preparation;
+      {
+        std::lock_guard<std::mutex> lock(preparation_mutex_);
+        preparation = preparation_;
+      }
+      if (preparation.valid()) {
+        preparation.wait();
       }
     }
 
     StorageImpl::~StorageImpl() {
       notifier_lifetime_.unsubscribe();
+      waitForPreparation();
       freeConnections();
     }
 
@@ -461,6 +714,7 @@ namespace iroha {
     }
 
     void StorageImpl::tryRollback(soci::session &session) {
+      waitForPreparation();
       // TODO 17.06.2019 luckychess IR-568 split connection and schema
       // initialisation
       if (block_is_prepared_) {
@@ -9,6 +9,8 @@
 #include "ametsuchi/storage.hpp"
 
 #include <atomic>
+#include <future>
+#include <mutex>
 #include <shared_mutex>
 
 #include <soci/soci.h>
@@ -31,12 +33,20 @@ namespace shared_model {
 namespace iroha {
 
   class PendingTransactionStorage;
+  class ThreadPool;
+
+  namespace metrics {
+    class Gauge;
+    class Histogram;
+  }  // namespace metrics
 
   namespace ametsuchi {
 
     class AmetsuchiTest;
     class PostgresOptions;
+    class TxHashFilter;
     class VmCaller;
+    class WsvCache;
 
     class StorageImpl : public Storage {
      public:
@@ -51,6 +61,8 @@ namespace iroha {
           std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
           std::shared_ptr<BlockStorage> persistent_block_storage,
           std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
+          std::shared_ptr<WsvCache> wsv_cache,
+          std::shared_ptr<TxHashFilter> tx_hash_filter,
           logger::LoggerManagerTreePtr log_manager,
           size_t pool_size = 10);
 
@@ -89,6 +101,17 @@ namespace iroha {
       createMutableStorage(std::shared_ptr<CommandExecutor> command_executor,
                            BlockStorageFactory &storage_factory) override;
 
+      iroha::expected::Result<std::unique_ptr<MutableStorage>, std::string>
+      createBulkMutableStorage(
+          std::shared_ptr<CommandExecutor> command_executor,
+          BlockStorageFactory &storage_factory) override;
+
+      expected::Result<void, std::string> exportWsvSnapshot(
+          std::ostream &snapshot) override;
+
+      expected::Result<void, std::string> importWsvSnapshot(
+          std::istream &snapshot) override;
+
       void resetPeers() override;
 
       expected::Result<void, std::string> dropBlockStorage() override;
@@ -113,7 +136,9 @@ namespace iroha {
       rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
       on_commit() override;
 
-      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) override;
+      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv,
+                        std::shared_ptr<const shared_model::interface::Block>
+                            block) override;
 
       ~StorageImpl() override;
 
@@ -132,6 +157,8 @@ namespace iroha {
           std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
           size_t pool_size,
           std::optional<std::reference_wrapper<const VmCaller>> vm_caller,
+          std::shared_ptr<WsvCache> wsv_cache,
+          std::shared_ptr<TxHashFilter> tx_hash_filter,
           logger::LoggerManagerTreePtr log_manager);
 
      private:
@@ -150,6 +177,25 @@ namespace iroha {
        */
       void tryRollback(soci::session &session);
 
+      /**
+       * Write the indices and the top block info of the block to the state
+       * and prepare it
+       * @return true if the state is prepared
+       */
+      bool writePreparedState(TemporaryWsv &wsv,
+                              const shared_model::interface::Block &block);
+
+      /**
+       * Wait until the state which is being prepared in the background is
+       * either prepared or rolled back
+       */
+      void waitForPreparation();
+
+      /**
+       * Update the metrics of the ledger with a committed block
+       */
+      void observeCommittedBlock(const shared_model::interface::Block &block);
+
       std::shared_ptr<BlockStorage> block_store_;
 
       std::shared_ptr<PoolWrapper> pool_wrapper_;
@@ -174,6 +220,12 @@ namespace iroha {
 
       std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref_;
 
+      /// cache of committed state, optional
+      std::shared_ptr<WsvCache> wsv_cache_;
+
+      /// filter of committed and rejected transaction hashes, optional
+      std::shared_ptr<TxHashFilter> tx_hash_filter_;
+
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
 
@@ -183,11 +235,39 @@ namespace iroha {
 
       bool prepared_blocks_enabled_;
 
+      /// a state is prepared, or is being prepared, for prepared_block_hash_
       std::atomic<bool> block_is_prepared_;
 
       std::string prepared_block_name_;
 
+      /// hash of the prepared block, guarded by preparation_mutex_
+      shared_model::interface::types::HashType prepared_block_hash_;
+
+      /**
+       * Runs preparation of the state, so that it overlaps with consensus.
+       * Only one state is prepared at a time: a prepared transaction is not
+       * visible to other sessions, so the next proposal cannot be validated
+       * on top of it before it is committed.
+       */
+      std::unique_ptr<ThreadPool> preparation_pool_;
+
+      /// guards prepared_block_hash_ and preparation_
+      std::mutex preparation_mutex_;
+
+      /// preparation in progress or the last finished one
+      std::shared_future<void> preparation_;
+
+      /// peers of the ledger after the prepared block
+      shared_model::interface::types::PeerList prepared_ledger_peers_;
+
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
+
+      metrics::Gauge &block_height_;
+      metrics::Histogram &block_size_;
+      /// time of writing a prepared state in the background
+      metrics::Histogram &preparation_time_;
+      /// time the commit of a prepared block waited for its preparation
+      metrics::Histogram &preparation_wait_time_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -5,10 +5,14 @@
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 
+#include <soci/boost-tuple.h>
+#include <boost/algorithm/string/case_conv.hpp>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <boost/range/algorithm/count_if.hpp>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/soci_std_optional.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "interfaces/commands/command.hpp"
 #include "interfaces/permission_to_string.hpp"
@@ -20,26 +24,114 @@ namespace iroha {
   namespace ametsuchi {
     TemporaryWsvImpl::TemporaryWsvImpl(
         std::shared_ptr<PostgresCommandExecutor> command_executor,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        std::shared_ptr<WsvCache> wsv_cache)
         : sql_(command_executor->getSession()),
           transaction_executor_(std::make_unique<TransactionExecutor>(
               std::move(command_executor))),
+          wsv_cache_(std::move(wsv_cache)),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()) {
       sql_ << "BEGIN";
     }
 
+    expected::Result<boost::optional<WsvCache::AccountSignatories>,
+                     std::string>
+    TemporaryWsvImpl::getCommittedSignatories(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      if (auto signatories = wsv_cache_->getSignatories(account_id)) {
+        return std::move(signatories);
+      }
+
+      auto generation = wsv_cache_->generation();
+      boost::optional<WsvCache::AccountSignatories> signatories;
+      try {
+        using T = boost::tuple<int, std::optional<std::string>>;
+        soci::rowset<T> rows =
+            (sql_.prepare << R"(SELECT account.quorum, public_key
+                  FROM account
+                  LEFT JOIN account_has_signatory
+                      ON account_has_signatory.account_id = account.account_id
+                  WHERE account.account_id = :account_id)",
+             soci::use(account_id, "account_id"));
+        for (const auto &row : rows) {
+          if (not signatories) {
+            signatories = WsvCache::AccountSignatories{
+                static_cast<shared_model::interface::types::QuorumType>(
+                    row.get<0>()),
+                {}};
+          }
+          if (row.get<1>()) {
+            signatories->public_keys.insert(*row.get<1>());
+          }
+        }
+      } catch (const std::exception &e) {
+        return e.what();
+      }
+
+      if (signatories) {
+        wsv_cache_->putSignatories(account_id, *signatories, generation);
+      }
+      return std::move(signatories);
+    }
+
+    bool TemporaryWsvImpl::isCachedStateActual(
+        const shared_model::interface::types::AccountIdType &account_id)
+        const {
+      return wsv_cache_ and not all_accounts_modified_
+          and modified_accounts_.count(account_id) == 0;
+    }
+
+    void TemporaryWsvImpl::markModifiedAccounts(
+        const shared_model::interface::Transaction &transaction) {
+      if (not wsv_cache_ or all_accounts_modified_) {
+        return;
+      }
+      if (auto accounts = WsvCache::modifiedAccounts(transaction)) {
+        modified_accounts_.insert(accounts->begin(), accounts->end());
+      } else {
+        all_accounts_modified_ = true;
+      }
+    }
+
     expected::Result<void, validation::CommandError>
     TemporaryWsvImpl::validateSignatures(
         const shared_model::interface::Transaction &transaction) {
       auto keys_range = transaction.signatures()
           | boost::adaptors::transformed(
                             [](const auto &s) { return s.publicKey(); });
-      auto keys = boost::algorithm::join(keys_range, "'), ('");
+      auto keys_range_size = boost::size(keys_range);
       // not using bool since it is not supported by SOCI
       boost::optional<uint8_t> signatories_valid;
 
-      boost::format query(R"(SELECT sum(count) = :signatures_count
+      auto db_error = [&transaction](const std::string &what) {
+        auto error_str = "Transaction " + transaction.toString()
+            + " failed signatures validation with db error: " + what;
+        // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
+        // with named constant
+        return expected::makeError(validation::CommandError{
+            "signatures validation", 1, error_str, false});
+      };
+
+      if (isCachedStateActual(transaction.creatorAccountId())) {
+        auto signatories =
+            getCommittedSignatories(transaction.creatorAccountId());
+        if (auto error = expected::resultToOptionalError(signatories)) {
+          return db_error(error.value());
+        }
+        if (auto &account = signatories.assumeValue()) {
+          size_t matched = boost::count_if(keys_range, [&](const auto &key) {
+            return account->public_keys.count(
+                       boost::algorithm::to_lower_copy(key))
+                > 0;
+          });
+          signatories_valid = matched == keys_range_size
+              and account->quorum <= keys_range_size;
+        }
+      } else {
+        auto keys = boost::algorithm::join(keys_range, "'), ('");
+
+        boost::format query(R"(SELECT sum(count) = :signatures_count
                           AND sum(quorum) <= :signatures_count
                   FROM
                       (SELECT count(public_key)
@@ -52,18 +144,13 @@ namespace iroha {
                           FROM account
                           WHERE account_id = :account_id) AS CTE3(quorum))");
 
-      try {
-        auto keys_range_size = boost::size(keys_range);
-        sql_ << (query % keys).str(), soci::into(signatories_valid),
-            soci::use(keys_range_size, "signatures_count"),
-            soci::use(transaction.creatorAccountId(), "account_id");
-      } catch (const std::exception &e) {
-        auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation with db error: " + e.what();
-        // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
-        // with named constant
-        return expected::makeError(validation::CommandError{
-            "signatures validation", 1, error_str, false});
+        try {
+          sql_ << (query % keys).str(), soci::into(signatories_valid),
+              soci::use(keys_range_size, "signatures_count"),
+              soci::use(transaction.creatorAccountId(), "account_id");
+        } catch (const std::exception &e) {
+          return db_error(e.what());
+        }
       }
 
       if (signatories_valid and *signatories_valid) {
@@ -87,6 +174,7 @@ namespace iroha {
                   savepoint = std::move(savepoint_wrapper),
                   &transaction]()
                  -> expected::Result<void, validation::CommandError> {
+        markModifiedAccounts(transaction);
         if (auto error = expected::resultToOptionalError(
                 transaction_executor_->execute(transaction, true))) {
           return expected::makeError(
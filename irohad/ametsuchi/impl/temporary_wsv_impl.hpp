@@ -8,8 +8,11 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <unordered_set>
+
 #include <soci/soci.h>
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 
@@ -45,9 +48,15 @@ namespace iroha {
         logger::LoggerPtr log_;
       };
 
+      /**
+       * @param command_executor - executor to apply transactions with
+       * @param log_manager - log manager
+       * @param wsv_cache - cache of committed state, optional
+       */
       TemporaryWsvImpl(
           std::shared_ptr<PostgresCommandExecutor> command_executor,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          std::shared_ptr<WsvCache> wsv_cache = nullptr);
 
       expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) override;
@@ -65,9 +74,34 @@ namespace iroha {
       expected::Result<void, validation::CommandError> validateSignatures(
           const shared_model::interface::Transaction &transaction);
 
+      /**
+       * Get committed quorum and signatories of the account from the cache,
+       * or read them from the database and put to the cache
+       * @return signatories, none if the account does not exist, or an error
+       */
+      expected::Result<boost::optional<WsvCache::AccountSignatories>,
+                       std::string>
+      getCommittedSignatories(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /// Whether committed state of the account is the same as in this WSV
+      bool isCachedStateActual(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      /// Remember the accounts, whose state in this WSV may diverge from the
+      /// committed one after the transaction is applied
+      void markModifiedAccounts(
+          const shared_model::interface::Transaction &transaction);
+
       soci::session &sql_;
       std::unique_ptr<TransactionExecutor> transaction_executor_;
 
+      std::shared_ptr<WsvCache> wsv_cache_;
+      std::unordered_set<shared_model::interface::types::AccountIdType>
+          modified_accounts_;
+      bool all_accounts_modified_ = false;
+
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
     };
@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/tx_hash_filter.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+#include "cryptography/hash.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  /**
+   * 7 probes give the first stage a false positive rate of 1/128. Each next
+   * stage takes one more probe, which halves its rate, so the rate of the
+   * whole filter stays below 1/64 regardless of the number of stages
+   */
+  constexpr size_t kFirstStageProbes = 7;
+  /// optimal number of bits per hash is probes / ln 2, in thousandths of bit
+  constexpr size_t kMilliBitsPerProbe = 1443;
+  constexpr size_t kWordBits = 64;
+}  // namespace
+
+TxHashFilter::Stage::Stage(size_t capacity, size_t probes)
+    : capacity(capacity),
+      probes(probes),
+      bits((capacity * probes * kMilliBitsPerProbe / 1000 + kWordBits - 1)
+           / kWordBits) {}
+
+bool TxHashFilter::Stage::test(const Probe &probe) const {
+  const auto size = bits.size() * kWordBits;
+  for (size_t i = 0; i < probes; ++i) {
+    auto bit = (probe.h1 + i * probe.h2) % size;
+    if ((bits[bit / kWordBits] & (uint64_t{1} << (bit % kWordBits))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TxHashFilter::Stage::set(const Probe &probe) {
+  const auto size = bits.size() * kWordBits;
+  for (size_t i = 0; i < probes; ++i) {
+    auto bit = (probe.h1 + i * probe.h2) % size;
+    bits[bit / kWordBits] |= uint64_t{1} << (bit % kWordBits);
+  }
+  ++this->size;
+}
+
+TxHashFilter::TxHashFilter(size_t capacity) {
+  stages_.emplace_back(std::max<size_t>(capacity, 1), kFirstStageProbes);
+}
+
+void TxHashFilter::add(const shared_model::crypto::Hash &hash) {
+  auto probe = makeProbe(hash);
+  std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+  if (std::any_of(stages_.begin(), stages_.end(), [&probe](const auto &stage) {
+        return stage.test(probe);
+      })) {
+    return;
+  }
+  if (stages_.back().size >= stages_.back().capacity) {
+    stages_.emplace_back(stages_.back().capacity * 2,
+                         stages_.back().probes + 1);
+  }
+  stages_.back().set(probe);
+}
+
+bool TxHashFilter::mayContain(const shared_model::crypto::Hash &hash) const {
+  auto probe = makeProbe(hash);
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return std::any_of(
+      stages_.begin(), stages_.end(), [&probe](const auto &stage) {
+        return stage.test(probe);
+      });
+}
+
+TxHashFilter::Probe TxHashFilter::makeProbe(
+    const shared_model::crypto::Hash &hash) {
+  // transaction hashes are uniformly distributed, so their bytes are used
+  // directly; short hashes only come from tests
+  const auto &blob = hash.blob();
+  Probe probe{shared_model::crypto::Hash::Hasher{}(hash), 0};
+  if (blob.size() >= sizeof(probe.h1) + sizeof(probe.h2)) {
+    std::memcpy(&probe.h1, blob.data(), sizeof(probe.h1));
+    std::memcpy(&probe.h2, blob.data() + sizeof(probe.h1), sizeof(probe.h2));
+  } else {
+    probe.h2 = probe.h1 * 0x9e3779b97f4a7c15ull;
+  }
+  // odd step visits different bits for each probe
+  probe.h2 |= 1;
+  return probe;
+}
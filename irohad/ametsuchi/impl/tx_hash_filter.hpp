@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TX_HASH_FILTER_HPP
+#define IROHA_TX_HASH_FILTER_HPP
+
+#include <cstdint>
+#include <shared_mutex>
+#include <vector>
+
+namespace shared_model {
+  namespace crypto {
+    class Hash;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * In-memory Bloom filter over hashes of committed and rejected
+     * transactions, which lets presence checks of new transactions skip
+     * database requests. A hash which was added is always reported as
+     * possibly present; a hash which was not added is reported as possibly
+     * present with a small probability.
+     *
+     * The filter grows by adding a twice larger stage each time the current
+     * one reaches its capacity. Each stage halves the false positive rate of
+     * the previous one, so the total rate, which is the sum of stage rates,
+     * stays bounded with the ledger size.
+     */
+    class TxHashFilter {
+     public:
+      /**
+       * @param capacity - number of hashes the first stage is sized for
+       */
+      explicit TxHashFilter(size_t capacity);
+
+      /// Add hash of a transaction which is committed or rejected
+      void add(const shared_model::crypto::Hash &hash);
+
+      /**
+       * @param hash - hash to look up
+       * @return false if the hash was definitely not added, true otherwise
+       */
+      bool mayContain(const shared_model::crypto::Hash &hash) const;
+
+     private:
+      /// Positions of hash bits, derived from the hash with double hashing
+      struct Probe {
+        uint64_t h1;
+        uint64_t h2;
+      };
+
+      struct Stage {
+        Stage(size_t capacity, size_t probes);
+
+        bool test(const Probe &probe) const;
+        void set(const Probe &probe);
+
+        size_t capacity;
+        size_t probes;
+        size_t size = 0;
+        std::vector<uint64_t> bits;
+      };
+
+      static Probe makeProbe(const shared_model::crypto::Hash &hash);
+
+      mutable std::shared_timed_mutex mutex_;
+      std::vector<Stage> stages_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_TX_HASH_FILTER_HPP
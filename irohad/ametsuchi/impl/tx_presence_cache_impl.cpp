@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 
+#include "ametsuchi/impl/tx_hash_filter.hpp"
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -12,8 +13,11 @@
 
 namespace iroha {
   namespace ametsuchi {
-    TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage)
-        : storage_(std::move(storage)) {}
+    TxPresenceCacheImpl::TxPresenceCacheImpl(
+        std::shared_ptr<Storage> storage,
+        std::shared_ptr<TxHashFilter> tx_hash_filter)
+        : storage_(std::move(storage)),
+          tx_hash_filter_(std::move(tx_hash_filter)) {}
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::check(
         const shared_model::crypto::Hash &hash) const {
@@ -21,21 +25,61 @@ namespace iroha {
       if (res) {
         return *res;
       }
+      // the filter is updated before hashes are written to the storage
+      if (tx_hash_filter_ and not tx_hash_filter_->mayContain(hash)) {
+        return TxCacheStatusType{tx_cache_status_responses::Missing{hash}};
+      }
       return checkInStorage(hash);
     }
 
     boost::optional<TxPresenceCache::BatchStatusCollectionType>
     TxPresenceCacheImpl::check(
         const shared_model::interface::TransactionBatch &batch) const {
-      TxPresenceCache::BatchStatusCollectionType batch_statuses;
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(batch.transactions().size());
       for (const auto &tx : batch.transactions()) {
-        if (auto status = check(tx->hash())) {
-          batch_statuses.emplace_back(*status);
-        } else {
-          return boost::none;
+        hashes.push_back(tx->hash());
+      }
+      return check(hashes);
+    }
+
+    boost::optional<TxPresenceCache::BatchStatusCollectionType>
+    TxPresenceCacheImpl::check(
+        const std::vector<shared_model::crypto::Hash> &hashes) const {
+      TxPresenceCache::BatchStatusCollectionType statuses;
+      statuses.reserve(hashes.size());
+      // positions of statuses which are resolved by the storage
+      std::vector<size_t> unknown_positions;
+      std::vector<shared_model::crypto::Hash> unknown_hashes;
+      for (const auto &hash : hashes) {
+        if (auto res = memory_cache_.findItem(hash)) {
+          statuses.emplace_back(*res);
+          continue;
+        }
+        statuses.emplace_back(tx_cache_status_responses::Missing{hash});
+        if (not tx_hash_filter_ or tx_hash_filter_->mayContain(hash)) {
+          unknown_positions.push_back(statuses.size() - 1);
+          unknown_hashes.push_back(hash);
         }
       }
-      return batch_statuses;
+      if (unknown_hashes.empty()) {
+        return statuses;
+      }
+
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        return boost::none;
+      }
+      auto storage_statuses = block_query->checkTxPresence(unknown_hashes);
+      if (not storage_statuses) {
+        return boost::none;
+      }
+      for (size_t i = 0; i < unknown_positions.size(); ++i) {
+        const auto &status = storage_statuses->at(i);
+        cacheStatus(unknown_hashes[i], status);
+        statuses[unknown_positions[i]] = status;
+      }
+      return statuses;
     }
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::checkInStorage(
@@ -46,17 +90,23 @@ namespace iroha {
       }
       return block_query->checkTxPresence(hash) |
           [this, &hash](const auto &status) {
-            std::visit(make_visitor(
-                           [](const tx_cache_status_responses::Missing &) {
-                             // don't put this hash into cache since "Missing"
-                             // can become "Committed" or "Rejected" later
-                           },
-                           [this, &hash](const auto &status) {
-                             memory_cache_.addItem(hash, status);
-                           }),
-                       status);
+            cacheStatus(hash, status);
             return status;
           };
     }
+
+    void TxPresenceCacheImpl::cacheStatus(
+        const shared_model::crypto::Hash &hash,
+        const TxCacheStatusType &status) const {
+      std::visit(make_visitor(
+                     [](const tx_cache_status_responses::Missing &) {
+                       // don't put this hash into cache since "Missing"
+                       // can become "Committed" or "Rejected" later
+                     },
+                     [this, &hash](const auto &status) {
+                       memory_cache_.addItem(hash, status);
+                     }),
+                 status);
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -12,10 +12,19 @@
 
 namespace iroha {
   namespace ametsuchi {
+    class TxHashFilter;
 
     class TxPresenceCacheImpl : public TxPresenceCache {
      public:
-      explicit TxPresenceCacheImpl(std::shared_ptr<Storage> storage);
+      /**
+       * @param storage - storage to look hashes up in
+       * @param tx_hash_filter - filter of hashes known to the storage, which
+       * answers for hashes it does not contain without storage requests,
+       * optional
+       */
+      explicit TxPresenceCacheImpl(
+          std::shared_ptr<Storage> storage,
+          std::shared_ptr<TxHashFilter> tx_hash_filter = nullptr);
 
       boost::optional<TxCacheStatusType> check(
           const shared_model::crypto::Hash &hash) const override;
@@ -24,6 +33,10 @@ namespace iroha {
           const shared_model::interface::TransactionBatch &batch)
           const override;
 
+      boost::optional<BatchStatusCollectionType> check(
+          const std::vector<shared_model::crypto::Hash> &hashes)
+          const override;
+
      private:
       /**
        * Performs an actual storage request about hash status
@@ -34,7 +47,16 @@ namespace iroha {
       boost::optional<TxCacheStatusType> checkInStorage(
           const shared_model::crypto::Hash &hash) const;
 
+      /**
+       * Puts final status of a transaction to the memory cache
+       * @param hash - hash of the transaction
+       * @param status - status of the transaction from the storage
+       */
+      void cacheStatus(const shared_model::crypto::Hash &hash,
+                       const TxCacheStatusType &status) const;
+
       std::shared_ptr<Storage> storage_;
+      std::shared_ptr<TxHashFilter> tx_hash_filter_;
       mutable cache::Cache<shared_model::crypto::Hash,
                            TxCacheStatusType,
                            shared_model::crypto::Hash::Hasher>
@@ -0,0 +1,196 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/call_engine.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::AccountIdType;
+
+WsvCache::WsvCache(size_t capacity) : capacity_(capacity) {}
+
+WsvCache::Generation WsvCache::generation() const {
+  return generation_.load();
+}
+
+boost::optional<WsvCache::AccountSignatories> WsvCache::getSignatories(
+    const AccountIdType &account_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto entry = find(account_id);
+  return entry ? entry->signatories : boost::none;
+}
+
+void WsvCache::putSignatories(const AccountIdType &account_id,
+                              AccountSignatories signatories,
+                              Generation read_generation) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // the state might have been read before the last commit
+  if (generation_.load() != read_generation) {
+    return;
+  }
+  if (auto entry = emplace(account_id)) {
+    entry->signatories = std::move(signatories);
+  }
+}
+
+boost::optional<shared_model::interface::RolePermissionSet>
+WsvCache::getRolePermissions(const AccountIdType &account_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto entry = find(account_id);
+  return entry ? entry->role_permissions : boost::none;
+}
+
+void WsvCache::putRolePermissions(
+    const AccountIdType &account_id,
+    shared_model::interface::RolePermissionSet permissions,
+    Generation read_generation) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // the state might have been read before the last commit
+  if (generation_.load() != read_generation) {
+    return;
+  }
+  if (auto entry = emplace(account_id)) {
+    entry->role_permissions = std::move(permissions);
+  }
+}
+
+void WsvCache::applyBlock(const shared_model::interface::Block &block) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // changes of the state do not count as usage
+  auto cached = [this](const AccountIdType &account_id) {
+    auto it = entries_.find(account_id);
+    return it == entries_.end() ? nullptr : &it->second;
+  };
+  auto cached_signatories = [&cached](const AccountIdType &account_id) {
+    auto entry = cached(account_id);
+    return entry and entry->signatories ? &*entry->signatories : nullptr;
+  };
+
+  for (const auto &tx : block.transactions()) {
+    for (const auto &command : tx.commands()) {
+      iroha::visit_in_place(
+          command.get(),
+          [&](const shared_model::interface::CreateAccount &c) {
+            if (auto entry = emplace(c.accountName() + "@" + c.domainId())) {
+              entry->signatories = AccountSignatories{
+                  1, {boost::algorithm::to_lower_copy(c.pubkey())}};
+              // the account gets the default role of the domain
+              entry->role_permissions = boost::none;
+            }
+          },
+          [&](const shared_model::interface::AddSignatory &c) {
+            if (auto signatories = cached_signatories(c.accountId())) {
+              signatories->public_keys.insert(
+                  boost::algorithm::to_lower_copy(c.pubkey()));
+            }
+          },
+          [&](const shared_model::interface::RemoveSignatory &c) {
+            if (auto signatories = cached_signatories(c.accountId())) {
+              signatories->public_keys.erase(
+                  boost::algorithm::to_lower_copy(c.pubkey()));
+            }
+          },
+          [&](const shared_model::interface::SetQuorum &c) {
+            if (auto signatories = cached_signatories(c.accountId())) {
+              signatories->quorum = c.newQuorum();
+            }
+          },
+          [&](const shared_model::interface::AppendRole &c) {
+            if (auto entry = cached(c.accountId())) {
+              entry->role_permissions = boost::none;
+            }
+          },
+          [&](const shared_model::interface::DetachRole &c) {
+            if (auto entry = cached(c.accountId())) {
+              entry->role_permissions = boost::none;
+            }
+          },
+          [&](const shared_model::interface::CallEngine &) {
+            // the engine may execute any commands
+            entries_.clear();
+            usage_.clear();
+          },
+          [](const auto &) {});
+    }
+  }
+  ++generation_;
+}
+
+void WsvCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  usage_.clear();
+  ++generation_;
+}
+
+boost::optional<std::vector<AccountIdType>> WsvCache::modifiedAccounts(
+    const shared_model::interface::Transaction &tx) {
+  std::vector<AccountIdType> accounts;
+  for (const auto &command : tx.commands()) {
+    bool known = iroha::visit_in_place(
+        command.get(),
+        [&](const shared_model::interface::CreateAccount &c) {
+          accounts.push_back(c.accountName() + "@" + c.domainId());
+          return true;
+        },
+        [&](const shared_model::interface::AddSignatory &c) {
+          accounts.push_back(c.accountId());
+          return true;
+        },
+        [&](const shared_model::interface::RemoveSignatory &c) {
+          accounts.push_back(c.accountId());
+          return true;
+        },
+        [&](const shared_model::interface::SetQuorum &c) {
+          accounts.push_back(c.accountId());
+          return true;
+        },
+        [](const shared_model::interface::CallEngine &) { return false; },
+        [](const auto &) { return true; });
+    if (not known) {
+      return boost::none;
+    }
+  }
+  return accounts;
+}
+
+WsvCache::Entry *WsvCache::find(const AccountIdType &account_id) {
+  auto it = entries_.find(account_id);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  usage_.splice(usage_.begin(), usage_, it->second.position);
+  return &it->second;
+}
+
+WsvCache::Entry *WsvCache::emplace(const AccountIdType &account_id) {
+  if (capacity_ == 0) {
+    return nullptr;
+  }
+  if (auto entry = find(account_id)) {
+    return entry;
+  }
+  if (entries_.size() >= capacity_) {
+    entries_.erase(usage_.back());
+    usage_.pop_back();
+  }
+  usage_.push_front(account_id);
+  return &entries_
+              .emplace(account_id,
+                       Entry{boost::none, boost::none, usage_.begin()})
+              .first->second;
+}
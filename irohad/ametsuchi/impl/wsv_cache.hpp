@@ -0,0 +1,161 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_CACHE_HPP
+#define IROHA_WSV_CACHE_HPP
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/permissions.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * In-memory cache of committed world state, which lets signature
+     * validation of transactions and role permission checks of queries skip
+     * database requests. Entries are populated on read and updated with
+     * committed blocks. Uncommitted changes are never stored.
+     *
+     * Balances and command permissions are not cached: commands check and
+     * update them in single statements against the uncommitted state of the
+     * block being built, which a cache of committed state cannot serve.
+     */
+    class WsvCache {
+     public:
+      /// Quorum and signatories of an account
+      struct AccountSignatories {
+        shared_model::interface::types::QuorumType quorum;
+        /// public keys in lower case
+        std::set<std::string> public_keys;
+      };
+
+      /// Counter of commits, used to discard entries read before a commit
+      using Generation = uint64_t;
+
+      /**
+       * @param capacity - maximal number of cached accounts
+       */
+      explicit WsvCache(size_t capacity);
+
+      /**
+       * @return current generation, which must be taken before reading the
+       * state to be put to the cache
+       */
+      Generation generation() const;
+
+      /**
+       * @param account_id - account to look up
+       * @return cached quorum and signatories, or none if not cached
+       */
+      boost::optional<AccountSignatories> getSignatories(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /**
+       * Put committed quorum and signatories of an account. The entry is
+       * ignored if a block was committed since the given generation
+       * @param account_id - account
+       * @param signatories - state read from the database
+       * @param read_generation - generation taken before the state was read
+       */
+      void putSignatories(
+          const shared_model::interface::types::AccountIdType &account_id,
+          AccountSignatories signatories,
+          Generation read_generation);
+
+      /**
+       * @param account_id - account to look up
+       * @return cached union of permissions of the account roles, or none if
+       * not cached
+       */
+      boost::optional<shared_model::interface::RolePermissionSet>
+      getRolePermissions(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /**
+       * Put committed union of permissions of the account roles. The entry is
+       * ignored if a block was committed since the given generation
+       * @param account_id - account
+       * @param permissions - state read from the database
+       * @param read_generation - generation taken before the state was read
+       */
+      void putRolePermissions(
+          const shared_model::interface::types::AccountIdType &account_id,
+          shared_model::interface::RolePermissionSet permissions,
+          Generation read_generation);
+
+      /**
+       * Update cached entries with changes of a committed block
+       * @param block - block which has been committed to the database
+       */
+      void applyBlock(const shared_model::interface::Block &block);
+
+      /// Drop all entries
+      void clear();
+
+      /**
+       * @param tx - transaction
+       * @return accounts whose quorum or signatories are changed by the
+       * transaction if it is applied, or none if any account may be changed
+       */
+      static boost::optional<
+          std::vector<shared_model::interface::types::AccountIdType>>
+      modifiedAccounts(const shared_model::interface::Transaction &tx);
+
+     private:
+      using AccountList =
+          std::list<shared_model::interface::types::AccountIdType>;
+
+      /// Cached state of an account, each part is read separately
+      struct Entry {
+        boost::optional<AccountSignatories> signatories;
+        /// roles are only changed by role commands, and permissions of a
+        /// role never change after it is created
+        boost::optional<shared_model::interface::RolePermissionSet>
+            role_permissions;
+        AccountList::iterator position;
+      };
+
+      /**
+       * Find an entry and mark it as the most recently used one
+       * @return the entry or nullptr if the account is not cached
+       */
+      Entry *find(const shared_model::interface::types::AccountIdType &id);
+
+      /**
+       * Get an entry, inserting an empty one and evicting the least recently
+       * used one if needed
+       * @return the entry or nullptr if the cache is disabled
+       */
+      Entry *emplace(const shared_model::interface::types::AccountIdType &id);
+
+      const size_t capacity_;
+      std::atomic<Generation> generation_{0};
+
+      std::mutex mutex_;
+      std::unordered_map<shared_model::interface::types::AccountIdType, Entry>
+          entries_;
+      /// accounts from the most to the least recently used
+      AccountList usage_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_CACHE_HPP
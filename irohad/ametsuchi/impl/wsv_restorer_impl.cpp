@@ -5,7 +5,15 @@
 
 #include "wsv_restorer_impl.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 
 #include "ametsuchi/block_query.hpp"
@@ -87,73 +95,236 @@ namespace {
     }
   };
 
+  using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+  using Clock = std::chrono::steady_clock;
+
+  /// Period of logging the restoration progress
+  static constexpr std::chrono::seconds kProgressLogPeriod = 10s;
+
+  /// Number of blocks loaded ahead of the applied one by each prefetch thread
+  static constexpr HeightType kPrefetchBlocksPerThread = 16;
+
   /**
-   * Reapply blocks from existing storage to WSV
-   * @param storage - current storage
-   * @param mutable_storage - mutable storage without blocks
+   * Load block from existing storage and validate it
    * @param block_query - current block storage
    * @param interface_validator - block interface validator
    * @param proto_validator - block proto backend validator
-   * @param validator - chain validator
-   * @param starting_height - the first block to apply
-   * @param ending_height - the last block to apply (inclusive)
-   * @return commit status after applying the blocks
+   * @param height - height of the block
+   * @return the block or error description
    */
-  iroha::ametsuchi::CommitResult reindexBlocks(
-      iroha::ametsuchi::Storage &storage,
-      std::unique_ptr<iroha::ametsuchi::MutableStorage> &mutable_storage,
+  iroha::expected::Result<BlockPtr, std::string> loadBlock(
       iroha::ametsuchi::BlockQuery &block_query,
-      shared_model::validation::AbstractValidator<
+      const shared_model::validation::AbstractValidator<
           shared_model::interface::Block> &interface_validator,
-      shared_model::validation::AbstractValidator<iroha::protocol::Block_v1>
-          &proto_validator,
-      iroha::validation::ChainValidator &validator,
+      const shared_model::validation::AbstractValidator<
+          iroha::protocol::Block_v1> &proto_validator,
+      HeightType height) {
+    auto result = block_query.getBlock(height);
+    if (auto e = iroha::expected::resultToOptionalError(result)) {
+      return std::move(e).value().message;
+    }
+
+    BlockPtr block = std::move(result).assumeValue();
+    if (height != block->height()) {
+      return "inconsistent block height in block storage";
+    }
+
+    // do not validate genesis block - transactions may not have creators,
+    // block is not signed
+    if (height != 1) {
+      if (auto error = proto_validator.validate(
+              static_cast<shared_model::proto::Block *>(block.get())
+                  ->getTransport())) {
+        return error->toString();
+      }
+
+      if (auto error = interface_validator.validate(*block)) {
+        return error->toString();
+      }
+    }
+    return block;
+  }
+
+  /**
+   * Logs the number of restored blocks and the restoration speed
+   */
+  class ProgressReporter {
+   public:
+    ProgressReporter(HeightType total_blocks, logger::LoggerPtr log)
+        : total_blocks_(total_blocks),
+          log_(std::move(log)),
+          start_(Clock::now()),
+          last_report_(start_) {}
+
+    void blockRestored() {
+      ++restored_blocks_;
+      auto now = Clock::now();
+      if (now - last_report_ < kProgressLogPeriod
+          and restored_blocks_ != total_blocks_) {
+        return;
+      }
+      last_report_ = now;
+      std::chrono::duration<double> elapsed = now - start_;
+      log_->info("Restored {} of {} blocks, {:.1f} blocks/s",
+                 restored_blocks_,
+                 total_blocks_,
+                 restored_blocks_ / std::max(elapsed.count(), 1e-3));
+    }
+
+   private:
+    HeightType total_blocks_;
+    HeightType restored_blocks_ = 0;
+    logger::LoggerPtr log_;
+    Clock::time_point start_;
+    Clock::time_point last_report_;
+  };
+
+  /**
+   * Load blocks one by one on the subscribing thread
+   * @param starting_height - the first block to load
+   * @param ending_height - the last block to load (inclusive)
+   * @return observable of validated blocks
+   */
+  rxcpp::observable<BlockPtr> loadBlocks(
+      iroha::ametsuchi::BlockQuery &block_query,
+      const shared_model::validation::AbstractValidator<
+          shared_model::interface::Block> &interface_validator,
+      const shared_model::validation::AbstractValidator<
+          iroha::protocol::Block_v1> &proto_validator,
       HeightType starting_height,
-      HeightType ending_height) {
-    auto blocks = rxcpp::observable<>::create<
-        std::shared_ptr<shared_model::interface::Block>>([&block_query,
-                                                          &interface_validator,
-                                                          &proto_validator,
-                                                          starting_height,
-                                                          ending_height](
-                                                             auto s) {
-      for (auto height = starting_height; height <= ending_height; ++height) {
-        auto result = block_query.getBlock(height);
-        if (auto e = iroha::expected::resultToOptionalError(result)) {
-          s.on_error(std::make_exception_ptr(
-              std::runtime_error(std::move(e).value().message)));
-          return;
-        }
+      HeightType ending_height,
+      const logger::LoggerPtr &log) {
+    return rxcpp::observable<BlockPtr>(rxcpp::observable<>::create<BlockPtr>(
+        [&block_query,
+         &interface_validator,
+         &proto_validator,
+         starting_height,
+         ending_height,
+         log](auto s) {
+          ProgressReporter progress(ending_height - starting_height + 1, log);
+          for (auto height = starting_height;
+               height <= ending_height and s.is_subscribed();
+               ++height) {
+            auto result = loadBlock(
+                block_query, interface_validator, proto_validator, height);
+            if (auto e = iroha::expected::resultToOptionalError(result)) {
+              s.on_error(
+                  std::make_exception_ptr(std::runtime_error(e.value())));
+              return;
+            }
+            s.on_next(std::move(result).assumeValue());
+            progress.blockRestored();
+          }
+          s.on_completed();
+        }));
+  }
 
-        auto block = std::move(result).assumeValue();
-        if (height != block->height()) {
-          s.on_error(std::make_exception_ptr(std::runtime_error(
-              "inconsistent block height in block storage")));
-          return;
-        }
+  /**
+   * Load blocks on several threads ahead of the subscriber. Blocks are
+   * fetched, parsed and validated in parallel and emitted in the order of
+   * their heights on the subscribing thread.
+   * @param threads - number of loading threads
+   * @param starting_height - the first block to load
+   * @param ending_height - the last block to load (inclusive)
+   * @return observable of validated blocks
+   */
+  rxcpp::observable<BlockPtr> prefetchBlocks(
+      iroha::ametsuchi::BlockQuery &block_query,
+      const shared_model::validation::AbstractValidator<
+          shared_model::interface::Block> &interface_validator,
+      const shared_model::validation::AbstractValidator<
+          iroha::protocol::Block_v1> &proto_validator,
+      size_t threads,
+      HeightType starting_height,
+      HeightType ending_height,
+      const logger::LoggerPtr &log) {
+    return rxcpp::observable<BlockPtr>(rxcpp::observable<>::create<BlockPtr>(
+        [&block_query,
+         &interface_validator,
+         &proto_validator,
+         threads,
+         starting_height,
+         ending_height,
+         log](auto s) {
+          const HeightType window = threads * kPrefetchBlocksPerThread;
+          std::mutex mutex;
+          std::condition_variable cv;
+          std::map<HeightType, iroha::expected::Result<BlockPtr, std::string>>
+              loaded;
+          HeightType next_to_load = starting_height;
+          HeightType next_to_emit = starting_height;
+          bool stopped = false;
 
-        // do not validate genesis block - transactions may not have creators,
-        // block is not signed
-        if (height != 1) {
-          if (auto error = proto_validator.validate(
-                  static_cast<shared_model::proto::Block *>(block.get())
-                      ->getTransport())) {
-            s.on_error(
-                std::make_exception_ptr(std::runtime_error(error->toString())));
-            return;
+          auto load = [&] {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+              cv.wait(lock, [&] {
+                return stopped or next_to_load > ending_height
+                    or next_to_load < next_to_emit + window;
+              });
+              if (stopped or next_to_load > ending_height) {
+                return;
+              }
+              auto height = next_to_load++;
+              lock.unlock();
+              auto result = loadBlock(
+                  block_query, interface_validator, proto_validator, height);
+              lock.lock();
+              loaded.emplace(height, std::move(result));
+              cv.notify_all();
+            }
+          };
+          std::vector<std::thread> loaders;
+          for (size_t i = 0; i < threads; ++i) {
+            loaders.emplace_back(load);
           }
 
-          if (auto error = interface_validator.validate(*block)) {
-            s.on_error(
-                std::make_exception_ptr(std::runtime_error(error->toString())));
+          ProgressReporter progress(ending_height - starting_height + 1, log);
+          boost::optional<std::string> error;
+          std::unique_lock<std::mutex> lock(mutex);
+          while (next_to_emit <= ending_height and s.is_subscribed()) {
+            cv.wait(lock, [&] { return loaded.count(next_to_emit) != 0; });
+            auto result = std::move(loaded.extract(next_to_emit).mapped());
+            ++next_to_emit;
+            cv.notify_all();
+            lock.unlock();
+            if (auto e = iroha::expected::resultToOptionalError(result)) {
+              error = std::move(e).value();
+              lock.lock();
+              break;
+            }
+            s.on_next(std::move(result).assumeValue());
+            progress.blockRestored();
+            lock.lock();
+          }
+          stopped = true;
+          cv.notify_all();
+          lock.unlock();
+          for (auto &loader : loaders) {
+            loader.join();
+          }
+
+          if (error) {
+            s.on_error(std::make_exception_ptr(std::runtime_error(*error)));
             return;
           }
-        }
+          s.on_completed();
+        }));
+  }
 
-        s.on_next(std::move(block));
-      }
-      s.on_completed();
-    });
+  /**
+   * Reapply blocks to WSV and commit them
+   * @param storage - current storage
+   * @param mutable_storage - mutable storage without blocks
+   * @param validator - chain validator
+   * @param blocks - blocks to apply
+   * @return commit status after applying the blocks
+   */
+  iroha::ametsuchi::CommitResult reindexBlocks(
+      iroha::ametsuchi::Storage &storage,
+      std::unique_ptr<iroha::ametsuchi::MutableStorage> &mutable_storage,
+      iroha::validation::ChainValidator &validator,
+      rxcpp::observable<BlockPtr> blocks) {
     if (validator.validateAndApply(blocks, *mutable_storage)) {
       return storage.commit(std::move(mutable_storage));
     } else {
@@ -169,11 +340,15 @@ namespace iroha::ametsuchi {
       std::unique_ptr<shared_model::validation::AbstractValidator<
           iroha::protocol::Block_v1>> proto_validator,
       std::shared_ptr<validation::ChainValidator> validator,
-      logger::LoggerPtr log)
+      logger::LoggerPtr log,
+      size_t replay_threads,
+      size_t bulk_load_min_blocks)
       : interface_validator_{std::move(interface_validator)},
         proto_validator_{std::move(proto_validator)},
         validator_{std::move(validator)},
-        log_{std::move(log)} {}
+        log_{std::move(log)},
+        replay_threads_{replay_threads},
+        bulk_load_min_blocks_{bulk_load_min_blocks} {}
 
   CommitResult WsvRestorerImpl::restoreWsv(Storage &storage,
                                            bool wait_for_new_blocks) {
@@ -188,11 +363,22 @@ namespace iroha::ametsuchi {
       auto last_block_in_storage = block_query->getTopBlockHeight();
 
       do {
-        res = storage.createMutableStorage(command_executor, storage_factory) |
+        const auto ledger_state = storage.getLedgerState();
+        const HeightType ledger_height =
+            ledger_state ? ledger_state.value()->top_block_info.height : 0;
+        const bool bulk_load = replay_threads_ > 0
+            and last_block_in_storage
+                >= ledger_height + bulk_load_min_blocks_;
+        auto created_storage = bulk_load
+            ? storage.createBulkMutableStorage(command_executor,
+                                               storage_factory)
+            : storage.createMutableStorage(command_executor, storage_factory);
+        res = std::move(created_storage) |
             [this,
              &storage,
              &block_query,
              &last_block_in_storage,
+             bulk_load,
              wait_for_new_blocks](auto &&mutable_storage) -> CommitResult {
           if (not block_query) {
             return expected::makeError("Cannot create BlockQuery");
@@ -247,14 +433,28 @@ namespace iroha::ametsuchi {
             wsv_ledger_height = 0;
           }
 
-          return reindexBlocks(storage,
-                               mutable_storage,
-                               *block_query,
+          const auto starting_height = wsv_ledger_height + 1;
+          if (bulk_load) {
+            log_->info("Restoring blocks from {} to {} in bulk mode",
+                       starting_height,
+                       last_block_in_storage);
+          }
+          auto blocks = replay_threads_ > 0
+              ? prefetchBlocks(*block_query,
                                *interface_validator_,
                                *proto_validator_,
-                               *validator_,
-                               wsv_ledger_height + 1,
-                               last_block_in_storage);
+                               replay_threads_,
+                               starting_height,
+                               last_block_in_storage,
+                               log_)
+              : loadBlocks(*block_query,
+                           *interface_validator_,
+                           *proto_validator_,
+                           starting_height,
+                           last_block_in_storage,
+                           log_);
+          return reindexBlocks(
+              storage, mutable_storage, *validator_, std::move(blocks));
         };
         if (hasError(res)) {
           break;
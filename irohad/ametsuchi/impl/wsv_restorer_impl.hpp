@@ -36,13 +36,29 @@ namespace iroha {
      */
     class WsvRestorerImpl : public WsvRestorer {
      public:
+      /// Minimal number of blocks to replay which pays off bulk loading
+      static constexpr size_t kDefaultBulkLoadMinBlocks = 1000;
+
+      /**
+       * @param interface_validator - block interface validator
+       * @param proto_validator - block proto backend validator
+       * @param validator - chain validator
+       * @param log - logger
+       * @param replay_threads - number of threads which load and validate
+       * blocks ahead of the applied one. 0 loads blocks one by one, otherwise
+       * long chains are also restored in bulk mode
+       * @param bulk_load_min_blocks - minimal number of blocks to replay in
+       * bulk mode
+       */
       WsvRestorerImpl(
           std::unique_ptr<shared_model::validation::AbstractValidator<
               shared_model::interface::Block>> interface_validator,
           std::unique_ptr<shared_model::validation::AbstractValidator<
               iroha::protocol::Block_v1>> proto_validator,
           std::shared_ptr<validation::ChainValidator> validator,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t replay_threads = 0,
+          size_t bulk_load_min_blocks = kDefaultBulkLoadMinBlocks);
 
       virtual ~WsvRestorerImpl() = default;
       /**
@@ -66,6 +82,8 @@ namespace iroha {
           proto_validator_;
       std::shared_ptr<validation::ChainValidator> validator_;
       logger::LoggerPtr log_;
+      size_t replay_threads_;
+      size_t bulk_load_min_blocks_;
     };
 
   }  // namespace ametsuchi
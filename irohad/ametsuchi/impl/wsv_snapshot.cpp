@@ -0,0 +1,308 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_snapshot.hpp"
+
+#include <array>
+#include <istream>
+#include <ostream>
+
+#include <fmt/core.h>
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include "backend/protobuf/block.hpp"
+#include "common/irohad_version.hpp"
+#include "cryptography/hash.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  constexpr char kMagic[] = "IROHAWSV";
+  constexpr uint64_t kFormatVersion = 4;
+
+  /// Amount of table data written to the snapshot in one chunk
+  constexpr size_t kChunkSize = 1 << 20;
+
+  /// Chunk size limit, which protects from allocations for corrupted lengths
+  constexpr uint64_t kMaxChunkSize = uint64_t{1} << 30;
+
+  /// World state tables in the order which satisfies their foreign keys
+  const std::array<const char *, 21> kSnapshotTables{
+      "top_block_info",
+      "role",
+      "domain",
+      "signatory",
+      "account",
+      "account_detail",
+      "account_detail_count",
+      "account_has_signatory",
+      "peer",
+      "asset",
+      "account_has_asset",
+      "role_has_permissions",
+      "account_has_roles",
+      "account_has_grantable_permissions",
+      "setting",
+      "tx_status_by_hash",
+      "engine_calls",
+      "burrow_account_data",
+      "burrow_account_key_value",
+      "burrow_tx_logs",
+      "burrow_tx_logs_topics"};
+
+  /// Serial columns which sequences must follow the imported values
+  const std::array<std::pair<const char *, const char *>, 2> kSerialColumns{
+      {{"engine_calls", "call_id"}, {"burrow_tx_logs", "log_idx"}}};
+
+  PGconn *connection(soci::session &sql) {
+    return static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+        ->conn_;
+  }
+
+  void writeNumber(std::ostream &out, uint64_t value) {
+    std::array<char, sizeof(value)> bytes;
+    for (auto it = bytes.rbegin(); it != bytes.rend(); ++it) {
+      *it = static_cast<char>(value & 0xff);
+      value >>= 8;
+    }
+    out.write(bytes.data(), bytes.size());
+  }
+
+  void writeBytes(std::ostream &out, const std::string &bytes) {
+    writeNumber(out, bytes.size());
+    out.write(bytes.data(), bytes.size());
+  }
+
+  uint64_t readNumber(std::istream &in) {
+    std::array<char, sizeof(uint64_t)> bytes;
+    if (not in.read(bytes.data(), bytes.size())) {
+      throw std::runtime_error("unexpected end of snapshot");
+    }
+    uint64_t value = 0;
+    for (auto byte : bytes) {
+      value = (value << 8) | static_cast<unsigned char>(byte);
+    }
+    return value;
+  }
+
+  void readBytes(std::istream &in, std::string &bytes) {
+    const auto size = readNumber(in);
+    if (size > kMaxChunkSize) {
+      throw std::runtime_error("corrupted snapshot chunk size");
+    }
+    bytes.resize(size);
+    if (not in.read(bytes.data(), size)) {
+      throw std::runtime_error("unexpected end of snapshot");
+    }
+  }
+
+  void writeTable(soci::session &sql,
+                  const std::string &table,
+                  std::ostream &out) {
+    auto *conn = connection(sql);
+    PgResultPtr result(
+        PQexec(conn, ("COPY " + table + " TO STDOUT (FORMAT binary)").c_str()),
+        &PQclear);
+    if (PQresultStatus(result.get()) != PGRES_COPY_OUT) {
+      throw std::runtime_error(PQerrorMessage(conn));
+    }
+
+    writeBytes(out, table);
+    std::string chunk;
+    chunk.reserve(kChunkSize);
+    char *row;
+    int size;
+    while ((size = PQgetCopyData(conn, &row, 0)) > 0) {
+      chunk.append(row, size);
+      PQfreemem(row);
+      if (chunk.size() >= kChunkSize) {
+        writeBytes(out, chunk);
+        chunk.clear();
+      }
+    }
+    if (not chunk.empty()) {
+      writeBytes(out, chunk);
+    }
+    // empty chunk ends the table
+    writeNumber(out, 0);
+
+    result.reset(PQgetResult(conn));
+    if (size == -2 or PQresultStatus(result.get()) != PGRES_COMMAND_OK) {
+      throw std::runtime_error(PQerrorMessage(conn));
+    }
+    while (auto *next_result = PQgetResult(conn)) {
+      PQclear(next_result);
+    }
+  }
+
+  void readTable(soci::session &sql,
+                 const std::string &table,
+                 std::istream &in) {
+    std::string chunk;
+    readBytes(in, chunk);
+    if (chunk != table) {
+      throw std::runtime_error(
+          fmt::format("expected table {} in snapshot, got {}", table, chunk));
+    }
+
+    auto *conn = connection(sql);
+    PgResultPtr result(
+        PQexec(conn,
+               ("COPY " + table + " FROM STDIN (FORMAT binary)").c_str()),
+        &PQclear);
+    if (PQresultStatus(result.get()) != PGRES_COPY_IN) {
+      throw std::runtime_error(PQerrorMessage(conn));
+    }
+    bool sent = true;
+    std::string error;
+    try {
+      while (sent) {
+        readBytes(in, chunk);
+        if (chunk.empty()) {
+          break;
+        }
+        sent = PQputCopyData(conn, chunk.data(), static_cast<int>(chunk.size()))
+            == 1;
+      }
+    } catch (const std::exception &e) {
+      error = e.what();
+    }
+    if (PQputCopyEnd(conn, error.empty() and sent ? nullptr : "aborted") != 1) {
+      throw std::runtime_error(PQerrorMessage(conn));
+    }
+    result.reset(PQgetResult(conn));
+    const auto status = PQresultStatus(result.get());
+    if (error.empty()) {
+      error = PQresultErrorMessage(result.get());
+    }
+    while (auto *next_result = PQgetResult(conn)) {
+      PQclear(next_result);
+    }
+    if (status != PGRES_COMMAND_OK) {
+      throw std::runtime_error(
+          fmt::format("failed to load table {}: {}", table, error));
+    }
+  }
+
+  /**
+   * Check that the world state in the session corresponds to the block
+   * @throws std::runtime_error if it does not
+   */
+  void checkTopBlock(soci::session &sql,
+                     const shared_model::interface::Block &block) {
+    shared_model::interface::types::HeightType height = 0;
+    std::string hash;
+    sql << "SELECT height, hash FROM top_block_info", soci::into(height),
+        soci::into(hash);
+    if (not sql.got_data()) {
+      throw std::runtime_error("world state has no top block");
+    }
+    if (height != block.height() or hash != block.hash().hex()) {
+      throw std::runtime_error(
+          fmt::format("world state top block (height {}, hash {}) does not "
+                      "match block (height {}, hash {})",
+                      height,
+                      hash,
+                      block.height(),
+                      block.hash().hex()));
+    }
+  }
+}  // namespace
+
+iroha::expected::Result<void, std::string> iroha::ametsuchi::writeWsvSnapshot(
+    soci::session &sql,
+    const shared_model::interface::Block &top_block,
+    std::ostream &snapshot) {
+  try {
+    // all the tables are read from the same state
+    sql << "BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY";
+    try {
+      checkTopBlock(sql, top_block);
+
+      const auto version = iroha::getIrohadVersion();
+      snapshot.write(kMagic, sizeof(kMagic) - 1);
+      writeNumber(snapshot, kFormatVersion);
+      writeNumber(snapshot, version.major);
+      writeNumber(snapshot, version.minor);
+      writeNumber(snapshot, version.patch);
+      writeBytes(snapshot,
+                 static_cast<const shared_model::proto::Block &>(top_block)
+                     .getTransport()
+                     .SerializeAsString());
+      for (const auto &table : kSnapshotTables) {
+        writeTable(sql, table, snapshot);
+      }
+      sql << "COMMIT";
+    } catch (...) {
+      sql << "ROLLBACK";
+      throw;
+    }
+    if (not snapshot.flush()) {
+      return "Failed to write WSV snapshot";
+    }
+  } catch (const std::exception &e) {
+    return fmt::format("Failed to write WSV snapshot: {}", e.what());
+  }
+  return {};
+}
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+iroha::ametsuchi::readWsvSnapshot(soci::session &sql, std::istream &snapshot) {
+  try {
+    std::array<char, sizeof(kMagic) - 1> magic;
+    if (not snapshot.read(magic.data(), magic.size())
+        or std::string(magic.data(), magic.size()) != kMagic) {
+      return "Not a WSV snapshot";
+    }
+    if (auto format_version = readNumber(snapshot);
+        format_version != kFormatVersion) {
+      return fmt::format("Unsupported WSV snapshot format version {}",
+                         format_version);
+    }
+    const auto version = iroha::getIrohadVersion();
+    const auto major = readNumber(snapshot);
+    const auto minor = readNumber(snapshot);
+    const auto patch = readNumber(snapshot);
+    if (major != version.major or minor != version.minor
+        or patch != version.patch) {
+      return fmt::format(
+          "WSV snapshot was written by irohad {}.{}.{}, which schema is not "
+          "compatible with irohad {}.{}.{}",
+          major,
+          minor,
+          patch,
+          version.major,
+          version.minor,
+          version.patch);
+    }
+
+    std::string block_data;
+    readBytes(snapshot, block_data);
+    iroha::protocol::Block_v1 transport;
+    if (not transport.ParseFromString(block_data)) {
+      return "Could not parse the top block of WSV snapshot";
+    }
+    auto block = std::make_unique<shared_model::proto::Block>(
+        std::move(transport));
+
+    for (const auto &table : kSnapshotTables) {
+      readTable(sql, table, snapshot);
+    }
+    for (const auto &column : kSerialColumns) {
+      sql << fmt::format(
+          "SELECT setval(pg_get_serial_sequence('{0}', '{1}'), "
+          "COALESCE(MAX({1}), 0) + 1, false) FROM {0}",
+          column.first,
+          column.second);
+    }
+    checkTopBlock(sql, *block);
+    return std::unique_ptr<shared_model::interface::Block>(std::move(block));
+  } catch (const std::exception &e) {
+    return fmt::format("Failed to read WSV snapshot: {}", e.what());
+  }
+}
@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_HPP
+#define IROHA_WSV_SNAPSHOT_HPP
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+#include "common/result.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Write world state tables to the snapshot stream. The snapshot contains
+     * the top block, so that a peer which imports it can check the state and
+     * continue the chain from its height. Indices of transaction positions are
+     * not included, since they refer to the blocks which are not transferred
+     * with the snapshot.
+     * @param sql - session to the working database, which must not be inside a
+     * transaction
+     * @param top_block - block which the world state corresponds to
+     * @param snapshot - stream to write the snapshot to
+     * @return error description if the state does not correspond to the block
+     * or writing has failed
+     */
+    expected::Result<void, std::string> writeWsvSnapshot(
+        soci::session &sql,
+        const shared_model::interface::Block &top_block,
+        std::ostream &snapshot);
+
+    /**
+     * Load world state tables from the snapshot stream into an empty schema.
+     * Transaction is not committed, so the caller can complete the import
+     * before the state becomes visible.
+     * @param sql - session to the working database inside a transaction
+     * @param snapshot - stream to read the snapshot from
+     * @return top block of the snapshot or error description
+     */
+    expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                     std::string>
+    readWsvSnapshot(soci::session &sql, std::istream &snapshot);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_HPP
@@ -7,9 +7,13 @@
 #define IROHA_KV_STORAGE_HPP
 
 #include <boost/optional.hpp>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "common/result_fwd.hpp"
+
 namespace iroha {
 
   namespace ametsuchi {
@@ -25,6 +29,17 @@ namespace iroha {
       using Identifier = uint32_t;
       using Bytes = std::vector<uint8_t>;
 
+      /// read-only bytes of a stored entity, kept valid by the owner
+      struct BytesView {
+        std::shared_ptr<const void> owner;
+        const uint8_t *data;
+        size_t size;
+      };
+
+      /// type of function which can be applied to the stored keys
+      using IdentifierFunction =
+          std::function<expected::Result<void, std::string>(Identifier)>;
+
       /**
        * Add entity with binary data
        * @param id - reference key
@@ -32,6 +47,14 @@ namespace iroha {
        */
       virtual bool add(Identifier id, const Bytes &blob) = 0;
 
+      /**
+       * Replace data of an existing entity
+       * @param id - reference key
+       * @param blob - new data associated with key
+       * @return true if the entity existed and was replaced
+       */
+      virtual bool replace(Identifier id, const Bytes &blob) = 0;
+
       /**
        * Get data associated with
        * @param id - reference key
@@ -39,6 +62,13 @@ namespace iroha {
        */
       virtual boost::optional<Bytes> get(Identifier id) const = 0;
 
+      /**
+       * Get data associated with key without copying it to a buffer
+       * @param id - reference key
+       * @return - view of the blob, if exists
+       */
+      virtual boost::optional<BytesView> getView(Identifier id) const = 0;
+
       /**
        * @return folder of storage
        */
@@ -49,6 +79,13 @@ namespace iroha {
        */
       virtual Identifier last_id() const = 0;
 
+      /**
+       * Iterates through the keys of stored entities in ascending order until
+       * the function returns an error
+       */
+      virtual expected::Result<void, std::string> forEachIdentifier(
+          IdentifierFunction function) const = 0;
+
       /**
        * Reloads data in case it was modified externally
        */
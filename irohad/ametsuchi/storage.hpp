@@ -6,6 +6,7 @@
 #ifndef IROHA_AMETSUCHI_H
 #define IROHA_AMETSUCHI_H
 
+#include <iosfwd>
 #include <vector>
 
 #include <rxcpp/rx-observable-fwd.hpp>
@@ -80,6 +81,18 @@ namespace iroha {
       createMutableStorage(std::shared_ptr<CommandExecutor> command_executor,
                            BlockStorageFactory &storage_factory) = 0;
 
+      /**
+       * Creates a mutable storage for replaying blocks which are already
+       * committed. Index of the applied blocks is loaded in large chunks and
+       * secondary indices of transaction tables are rebuilt on commit.
+       * @return Created mutable storage.
+       */
+      virtual iroha::expected::Result<std::unique_ptr<MutableStorage>,
+                                      std::string>
+      createBulkMutableStorage(
+          std::shared_ptr<CommandExecutor> command_executor,
+          BlockStorageFactory &storage_factory) = 0;
+
       /**
        * method called when block is written to the storage
        * @return observable with the Block committed
@@ -88,6 +101,24 @@ namespace iroha {
           std::shared_ptr<const shared_model::interface::Block>>
       on_commit() = 0;
 
+      /**
+       * Write WSV at the top block to the snapshot
+       * @param snapshot - stream to write the snapshot to
+       * @return error description if the snapshot could not be written
+       */
+      virtual expected::Result<void, std::string> exportWsvSnapshot(
+          std::ostream &snapshot) = 0;
+
+      /**
+       * Load WSV from the snapshot into empty storage. Block storage gets
+       * the top block of the snapshot, so the chain continues from its
+       * height without the blocks below it.
+       * @param snapshot - stream to read the snapshot from
+       * @return error description if the snapshot could not be imported
+       */
+      virtual expected::Result<void, std::string> importWsvSnapshot(
+          std::istream &snapshot) = 0;
+
       /**
        * Removes all peers from WSV
        */
@@ -9,6 +9,12 @@
 #include <memory>
 #include "common/result.hpp"
 
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
 namespace iroha {
   namespace ametsuchi {
 
@@ -28,12 +34,21 @@ namespace iroha {
           std::shared_ptr<CommandExecutor> command_executor) = 0;
 
       /**
-       * Prepare state which was accumulated in temporary WSV.
-       * After preparation, this state is not visible until commited.
+       * Prepare state which was accumulated in temporary WSV, together with
+       * the indices of the block created from it, so that committing the
+       * block takes only the commit of the prepared state.
+       * The state is reserved for the block at once, and may be written in
+       * the background, so that the block can be passed to consensus while
+       * its state is prepared. Committing the block waits for the
+       * preparation. After preparation, this state is not visible until
+       * commited, and only the given block can commit it.
        *
        * @param wsv - state which will be prepared.
+       * @param block - block created from the state
        */
-      virtual void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) = 0;
+      virtual void prepareBlock(
+          std::unique_ptr<TemporaryWsv> wsv,
+          std::shared_ptr<const shared_model::interface::Block> block) = 0;
 
       virtual ~TemporaryFactory() = default;
     };
@@ -17,6 +17,7 @@
 #include "consensus/yac/yac_crypto_provider.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
 
 // TODO: 2019-03-04 @muratovv refactor std::vector<VoteMessage> with a
 // separate class IR-374
@@ -63,7 +64,16 @@ namespace iroha {
             vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
-            timer_(std::move(timer)) {}
+            timer_(std::move(timer)),
+            received_votes_(metrics::registry().counter(
+                "iroha_yac_votes_received_total",
+                "Votes received from other peers")),
+            rejected_states_(metrics::registry().counter(
+                "iroha_yac_states_rejected_total",
+                "States with votes which failed signature verification")),
+            verification_time_(metrics::registry().histogram(
+                "iroha_yac_verification_microseconds",
+                "Time of verifying signatures of the votes of a state")) {}
 
       Yac::~Yac() {
         notifier_lifetime_.unsubscribe();
@@ -139,8 +149,12 @@ namespace iroha {
           log_->debug("No votes left in the message.");
           return;
         }
+        received_votes_.increment(state.size());
 
-        if (crypto_->verify(state)) {
+        auto start = std::chrono::steady_clock::now();
+        auto verified = crypto_->verify(state);
+        verification_time_.observeSince(start);
+        if (verified) {
           auto &proposal_round = getRound(state);
 
           if (proposal_round.block_round > round_.block_round) {
@@ -171,6 +185,7 @@ namespace iroha {
 
           applyState(state, guard);
         } else {
+          rejected_states_.increment();
           log_->warn(
               "Crypto verification failed for message. Votes: [{}]",
               boost::algorithm::join(
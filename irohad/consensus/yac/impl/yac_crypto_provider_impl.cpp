@@ -10,35 +10,100 @@
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
 #include "interfaces/common_objects/string_view_types.hpp"
 #include "logger/logger.hpp"
 
+namespace {
+  /**
+   * @param vote - signed vote
+   * @param payload - serialized hash of the vote, which is signed
+   * @return key of the vote in the cache of verified votes
+   */
+  shared_model::crypto::HashKey makeVoteKey(
+      const iroha::consensus::yac::VoteMessage &vote,
+      const std::string &payload) {
+    // hex signature and public key never contain the separator, so different
+    // votes do not share the hashed data
+    return shared_model::crypto::HashKey{
+        shared_model::crypto::Sha3_256::makeHash(shared_model::crypto::Blob{
+            vote.signature->signedData() + ":" + vote.signature->publicKey()
+            + ":" + payload})};
+  }
+}  // namespace
+
 namespace iroha {
   namespace consensus {
     namespace yac {
       CryptoProviderImpl::CryptoProviderImpl(
-          const shared_model::crypto::Keypair &keypair, logger::LoggerPtr log)
-          : keypair_(keypair), log_(std::move(log)) {}
+          const shared_model::crypto::Keypair &keypair,
+          logger::LoggerPtr log,
+          std::shared_ptr<iroha::ThreadPool> verification_pool,
+          size_t verified_votes_cache_size)
+          : keypair_(keypair),
+            log_(std::move(log)),
+            verification_pool_(std::move(verification_pool)),
+            verified_votes_cache_size_(verified_votes_cache_size) {}
 
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
-        return std::all_of(
-            std::begin(msg), std::end(msg), [this](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
+        struct PendingVote {
+          const VoteMessage &vote;
+          shared_model::crypto::Blob payload;
+          VoteKey key;
+        };
+        std::vector<PendingVote> pending;
+        pending.reserve(msg.size());
+        for (const auto &vote : msg) {
+          auto serialized = PbConverters::serializeVotePayload(vote)
+                                .hash()
+                                .SerializeAsString();
+          auto key = makeVoteKey(vote, serialized);
+          if (not isVerified(key)) {
+            pending.push_back(
+                {vote, shared_model::crypto::Blob{serialized}, key});
+          }
+        }
+        if (pending.empty()) {
+          return true;
+        }
+
+        using namespace shared_model::interface::types;
+        std::vector<shared_model::crypto::CryptoVerifier::BatchEntry> entries;
+        entries.reserve(pending.size());
+        for (const auto &vote : pending) {
+          entries.push_back(
+              {SignedHexStringView{vote.vote.signature->signedData()},
+               vote.payload,
+               PublicKeyHexStringView{vote.vote.signature->publicKey()}});
+        }
+        auto errors =
+            iroha::expected::resultToOptionalError(verifySignatures(entries))
+                .value_or(shared_model::crypto::CryptoVerifier::BatchErrors{});
+
+        // failed entries are ordered by index
+        auto error = errors.begin();
+        for (size_t i = 0; i < pending.size(); ++i) {
+          if (error != errors.end() and error->first == i) {
+            log_->debug("Vote signature verification failed: {}",
+                        error->second);
+            ++error;
+          } else {
+            setVerified(pending[i].key);
+          }
+        }
+        return errors.empty();
+      }
 
-              using namespace shared_model::interface::types;
-              return shared_model::crypto::CryptoVerifier::verify(
-                         SignedHexStringView{vote.signature->signedData()},
-                         blob,
-                         PublicKeyHexStringView{vote.signature->publicKey()})
-                  .match([](const auto &) { return true; },
-                         [this](const auto &error) {
-                           log_->debug("Vote signature verification failed: {}",
-                                       error.error);
-                           return false;
-                         });
-            });
+      iroha::expected::Result<
+          void,
+          shared_model::crypto::CryptoVerifier::BatchErrors>
+      CryptoProviderImpl::verifySignatures(
+          const std::vector<shared_model::crypto::CryptoVerifier::BatchEntry>
+              &entries) {
+        // states of a usual network are smaller than a batch chunk, so they
+        // are verified inline without passing tasks to the pool
+        return shared_model::crypto::CryptoVerifier::verifyBatch(
+            entries, verification_pool_.get());
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
@@ -60,9 +125,32 @@ namespace iroha {
         vote.signature = std::make_shared<shared_model::plain::Signature>(
             SignedHexStringView{signature}, PublicKeyHexStringView{pubkey});
 
+        // own votes come back with the states of other peers
+        setVerified(makeVoteKey(vote, serialized));
+
         return vote;
       }
 
+      bool CryptoProviderImpl::isVerified(const VoteKey &key) {
+        std::lock_guard<std::mutex> lock(verified_votes_mutex_);
+        return verified_votes_.count(key) != 0;
+      }
+
+      void CryptoProviderImpl::setVerified(const VoteKey &key) {
+        if (verified_votes_cache_size_ == 0) {
+          return;
+        }
+        std::lock_guard<std::mutex> lock(verified_votes_mutex_);
+        if (not verified_votes_.insert(key).second) {
+          return;
+        }
+        verified_votes_order_.push_back(key);
+        if (verified_votes_order_.size() > verified_votes_cache_size_) {
+          verified_votes_.erase(verified_votes_order_.front());
+          verified_votes_order_.pop_front();
+        }
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
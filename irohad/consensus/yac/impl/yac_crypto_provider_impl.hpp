@@ -8,25 +8,83 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "cryptography/hash_key.hpp"
 #include "cryptography/keypair.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
+  class ThreadPool;
+
   namespace consensus {
     namespace yac {
       class CryptoProviderImpl : public YacCryptoProvider {
        public:
-        CryptoProviderImpl(const shared_model::crypto::Keypair &keypair,
-                           logger::LoggerPtr log);
+        /// Default number of remembered votes with verified signatures
+        static constexpr size_t kDefaultVerifiedVotesCacheSize = 10000;
+
+        /**
+         * @param keypair - keypair of the peer to sign its votes
+         * @param log - logger
+         * @param verification_pool - threads verifying large sets of votes
+         * concurrently, all votes are verified by the calling thread if not set
+         * @param verified_votes_cache_size - number of votes with verified
+         * signatures, which are not verified again when they are received
+         */
+        CryptoProviderImpl(
+            const shared_model::crypto::Keypair &keypair,
+            logger::LoggerPtr log,
+            std::shared_ptr<iroha::ThreadPool> verification_pool = nullptr,
+            size_t verified_votes_cache_size = kDefaultVerifiedVotesCacheSize);
 
+        virtual ~CryptoProviderImpl() = default;
+
+        /**
+         * Verify signatures of the votes which have not been verified yet.
+         * Small sets of votes are verified inline, large ones are split
+         * between the verification pool threads.
+         */
         // TODO 18.04.2020 IR-710 @mboldyrev: make it return Result
         bool verify(const std::vector<VoteMessage> &msg) override;
 
         VoteMessage getVote(YacHash hash) override;
 
+       protected:
+        /**
+         * Verify signatures of the votes missing in the cache
+         * @param entries - signatures with the signed vote payloads
+         * @return indices of failed entries with error messages, if any
+         */
+        virtual iroha::expected::Result<
+            void,
+            shared_model::crypto::CryptoVerifier::BatchErrors>
+        verifySignatures(
+            const std::vector<shared_model::crypto::CryptoVerifier::BatchEntry>
+                &entries);
+
        private:
+        using VoteKey = shared_model::crypto::HashKey;
+
+        /// @return whether the vote is in the cache of verified votes
+        bool isVerified(const VoteKey &key);
+
+        /// Put the vote to the cache, evicting the oldest one if it is full
+        void setVerified(const VoteKey &key);
+
         shared_model::crypto::Keypair keypair_;
         logger::LoggerPtr log_;
+        std::shared_ptr<iroha::ThreadPool> verification_pool_;
+
+        const size_t verified_votes_cache_size_;
+        std::mutex verified_votes_mutex_;
+        std::unordered_set<VoteKey, VoteKey::Hasher> verified_votes_;
+        /// verified votes from the oldest to the newest one
+        std::deque<VoteKey> verified_votes_order_;
       };
     }  // namespace yac
   }    // namespace consensus
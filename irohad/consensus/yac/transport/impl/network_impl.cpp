@@ -26,9 +26,11 @@ namespace iroha {
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
           std::unique_ptr<ClientFactory> client_factory,
-          logger::LoggerPtr log)
+          logger::LoggerPtr log,
+          bool send_commit_certificates)
           : async_call_(async_call),
             client_factory_(std::move(client_factory)),
+            send_commit_certificates_(send_commit_certificates),
             log_(std::move(log)) {}
 
       void NetworkImpl::subscribe(
@@ -50,9 +52,17 @@ namespace iroha {
         }
 
         proto::State request;
-        for (const auto &vote : state) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
+        boost::optional<proto::CommitCertificate> certificate;
+        if (send_commit_certificates_ and state.size() > 1) {
+          certificate = PbConverters::serializeCertificate(state);
+        }
+        if (certificate) {
+          *request.mutable_certificate() = *std::move(certificate);
+        } else {
+          for (const auto &vote : state) {
+            auto pb_vote = request.add_votes();
+            *pb_vote = PbConverters::serializeVote(vote);
+          }
         }
 
         client_factory_->createClient(to).match(
@@ -78,10 +88,16 @@ namespace iroha {
           const ::iroha::consensus::yac::proto::State *request,
           ::google::protobuf::Empty *response) {
         std::vector<VoteMessage> state;
-        for (const auto &pb_vote : request->votes()) {
-          if (auto vote = PbConverters::deserializeVote(pb_vote, log_)) {
-            state.push_back(*vote);
+        auto deserialize = [&](const auto &pb_votes) {
+          for (const auto &pb_vote : pb_votes) {
+            if (auto vote = PbConverters::deserializeVote(pb_vote, log_)) {
+              state.push_back(*vote);
+            }
           }
+        };
+        deserialize(request->votes());
+        if (request->has_certificate()) {
+          deserialize(PbConverters::expandCertificate(request->certificate()));
         }
         if (state.empty()) {
           log_->info("Received an empty votes collection");
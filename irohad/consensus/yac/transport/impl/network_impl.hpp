@@ -34,12 +34,21 @@ namespace iroha {
         using Service = proto::Yac;
         using ClientFactory = iroha::network::ClientFactory<Service>;
 
-        explicit NetworkImpl(
+        /**
+         * @param async_call - asynchronous gRPC client
+         * @param client_factory - factory of clients to other peers
+         * @param log - logger
+         * @param send_commit_certificates - whether states of votes for the
+         * same hash are sent as commit certificates, which peers older than
+         * the certificates do not accept
+         */
+        NetworkImpl(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::unique_ptr<iroha::network::ClientFactory<
                 ::iroha::consensus::yac::proto::Yac>> client_factory,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            bool send_commit_certificates);
 
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
@@ -76,6 +85,8 @@ namespace iroha {
          */
         std::unique_ptr<ClientFactory> client_factory_;
 
+        const bool send_commit_certificates_;
+
         std::mutex stop_mutex_;
         bool stop_requested_{false};
 
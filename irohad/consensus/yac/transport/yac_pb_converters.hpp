@@ -6,6 +6,8 @@
 #ifndef IROHA_YAC_PB_CONVERTERS_HPP
 #define IROHA_YAC_PB_CONVERTERS_HPP
 
+#include <algorithm>
+
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "common/byteutils.hpp"
 #include "consensus/yac/outcome_messages.hpp"
@@ -91,6 +93,82 @@ namespace iroha {
           return pb_vote;
         }
 
+        /**
+         * Serialize votes as a commit certificate, which keeps the round and
+         * the hashes once for all the votes
+         * @param votes - votes to serialize
+         * @return certificate, or none if the votes are not for the same hash
+         */
+        static boost::optional<proto::CommitCertificate> serializeCertificate(
+            const std::vector<VoteMessage> &votes) {
+          if (votes.empty()) {
+            return boost::none;
+          }
+          const auto &hash = votes.front().hash;
+          if (std::any_of(votes.begin(), votes.end(), [&hash](const auto &v) {
+                return v.hash != hash;
+              })) {
+            return boost::none;
+          }
+
+          proto::CommitCertificate certificate;
+          auto pb_hash = serializeRoundAndHashes(votes.front()).hash();
+          *certificate.mutable_vote_round() = pb_hash.vote_round();
+          *certificate.mutable_vote_hashes() = pb_hash.vote_hashes();
+          for (const auto &vote : votes) {
+            auto signature = certificate.add_signatures();
+            auto public_key =
+                hexstringToBytestringResult(vote.signature->publicKey())
+                    .assumeValue();
+            signature->set_signature(
+                hexstringToBytestringResult(vote.signature->signedData())
+                    .assumeValue());
+            if (vote.hash.block_signature) {
+              signature->set_block_signature(
+                  hexstringToBytestringResult(
+                      vote.hash.block_signature->signedData())
+                      .assumeValue());
+              auto block_public_key =
+                  hexstringToBytestringResult(
+                      vote.hash.block_signature->publicKey())
+                      .assumeValue();
+              if (block_public_key != public_key) {
+                signature->set_block_pubkey(std::move(block_public_key));
+              }
+            }
+            signature->set_pubkey(std::move(public_key));
+          }
+          return certificate;
+        }
+
+        /**
+         * Restore votes from a commit certificate
+         * @param certificate - certificate to restore the votes from
+         * @return votes in the order they were put to the certificate
+         */
+        static std::vector<proto::Vote> expandCertificate(
+            const proto::CommitCertificate &certificate) {
+          std::vector<proto::Vote> votes;
+          votes.reserve(certificate.signatures_size());
+          for (const auto &signature : certificate.signatures()) {
+            votes.emplace_back();
+            auto hash = votes.back().mutable_hash();
+            *hash->mutable_vote_round() = certificate.vote_round();
+            *hash->mutable_vote_hashes() = certificate.vote_hashes();
+            if (not signature.block_signature().empty()) {
+              auto block_signature = hash->mutable_block_signature();
+              block_signature->set_pubkey(signature.block_pubkey().empty()
+                                              ? signature.pubkey()
+                                              : signature.block_pubkey());
+              block_signature->set_signature(signature.block_signature());
+            }
+            auto vote_signature = votes.back().mutable_signature();
+            vote_signature->set_pubkey(signature.pubkey());
+            vote_signature->set_signature(signature.signature());
+          }
+          return votes;
+        }
+
         static boost::optional<VoteMessage> deserializeVote(
             const proto::Vote &pb_vote, logger::LoggerPtr log) {
           // TODO IR-428 igor-egorov refactor PbConverters - do the class
@@ -22,6 +22,10 @@
 #include <rxcpp/operators/rx-observe_on.hpp>
 
 namespace iroha {
+  namespace metrics {
+    class Counter;
+    class Histogram;
+  }  // namespace metrics
   namespace consensus {
     namespace yac {
 
@@ -131,6 +135,11 @@ namespace iroha {
         std::shared_ptr<YacNetwork> network_;
         std::shared_ptr<YacCryptoProvider> crypto_;
         std::shared_ptr<Timer> timer_;
+
+        // ------|Metrics|------
+        metrics::Counter &received_votes_;
+        metrics::Counter &rejected_states_;
+        metrics::Histogram &verification_time_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -6,11 +6,15 @@
 #include "main/application.hpp"
 
 #include <boost/filesystem.hpp>
+#include <fstream>
 #include <optional>
 #include <rxcpp/operators/rx-map.hpp>
 
+#include "ametsuchi/impl/flat_file_block_codec.hpp"
+#include "ametsuchi/impl/key_value_storage_factory.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
+#include "ametsuchi/impl/tx_hash_filter.hpp"
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "ametsuchi/vm_caller.hpp"
@@ -22,6 +26,7 @@
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "common/bind.hpp"
 #include "common/files.hpp"
+#include "common/thread_pool.hpp"
 #include "consensus/yac/consensus_outcome_type.hpp"
 #include "consensus/yac/consistency_model.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
@@ -37,6 +42,9 @@
 #include "main/impl/pg_connection_init.hpp"
 #include "main/impl/storage_init.hpp"
 #include "main/server_runner.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/metrics_exporter.hpp"
+#include "metrics/transaction_stages.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy.hpp"
 #include "multi_sig_transactions/mst_processor_impl.hpp"
 #include "multi_sig_transactions/mst_propagation_strategy_stub.hpp"
@@ -56,6 +64,7 @@
 #include "ordering/impl/kick_out_proposal_creation_strategy.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
+#include "ordering/impl/proposal_packing_policies.hpp"
 #include "ordering/impl/unique_creation_proposal_strategy.hpp"
 #include "simulator/impl/simulator.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
@@ -98,6 +107,17 @@ static constexpr iroha::consensus::yac::ConsistencyModel
 static constexpr uint32_t kStaleStreamMaxRoundsDefault = 2;
 static constexpr uint32_t kMstExpirationTimeDefault = 1440;
 static constexpr uint32_t kMaxRoundsDelayDefault = 3000;
+static constexpr uint32_t kStatefulValidationThreadsDefault = 1;
+static constexpr uint32_t kWsvCacheSizeDefault = 0;
+static constexpr uint32_t kToriiValidationThreadsDefault = 1;
+static constexpr uint32_t kTxHashFilterSizeDefault = 0;
+static constexpr uint32_t kBlockStoreSyncBatchSizeDefault = 1;
+static constexpr const char *kProposalPackingPolicyDefault = "fifo";
+static constexpr uint32_t kWsvReplayThreadsDefault = 0;
+static constexpr bool kYacCommitCertificatesDefault = false;
+static constexpr uint32_t kBlockDownloadRangeSizeDefault = 100;
+static constexpr uint32_t kBlockDownloadRangesAheadDefault = 8;
+static constexpr uint32_t kBlockDownloadStallTimeoutDefault = 10000;
 
 /**
  * Configuring iroha daemon
@@ -189,7 +209,8 @@ Irohad::RunResult Irohad::init() {
 
          // Torii
          | [this]{ return initTransactionCommandService();}
-         | [this]{ return initQueryService();};
+         | [this]{ return initQueryService();}
+         | [this]{ return initMetrics();};
   // clang-format on
 }
 
@@ -204,6 +225,29 @@ Irohad::RunResult Irohad::resetWsv() {
   return initStorage(StartupWsvDataPolicy::kDrop);
 }
 
+Irohad::RunResult Irohad::exportWsvSnapshot(const std::string &path) {
+  std::ofstream snapshot(path, std::ios::binary | std::ios::trunc);
+  if (not snapshot) {
+    return expected::makeError(
+        fmt::format("Failed to open WSV snapshot file {}", path));
+  }
+  return storage->exportWsvSnapshot(snapshot) | [this, &path]() -> RunResult {
+    log_->info("WSV snapshot written to {}", path);
+    return {};
+  };
+}
+
+Irohad::RunResult Irohad::importWsvSnapshot(const std::string &path) {
+  std::ifstream snapshot(path, std::ios::binary);
+  if (not snapshot) {
+    return expected::makeError(
+        fmt::format("Failed to open WSV snapshot file {}", path));
+  }
+  return dropStorage() | [this, &snapshot] {
+    return storage->importWsvSnapshot(snapshot);
+  };
+}
+
 /**
  * Initializing setting query
  */
@@ -225,15 +269,28 @@ Irohad::RunResult Irohad::initSettings() {
  * Initializing validators' configs
  */
 Irohad::RunResult Irohad::initValidatorsConfigs() {
+  // shared by all the validators, so that the number of verifying threads
+  // does not grow with the number of validating ones
+  signature_verification_pool_ =
+      std::make_shared<ThreadPool>(std::thread::hardware_concurrency());
   validators_config_ =
       std::make_shared<shared_model::validation::ValidatorsConfig>(
-          config_.max_proposal_size);
+          config_.max_proposal_size,
+          false,
+          false,
+          signature_verification_pool_);
   block_validators_config_ =
       std::make_shared<shared_model::validation::ValidatorsConfig>(
-          config_.max_proposal_size, true);
+          config_.max_proposal_size,
+          true,
+          false,
+          signature_verification_pool_);
   proposal_validators_config_ =
       std::make_shared<shared_model::validation::ValidatorsConfig>(
-          config_.max_proposal_size, false, true);
+          config_.max_proposal_size,
+          false,
+          true,
+          signature_verification_pool_);
   log_->info("[Init] => validators configs");
   return {};
 }
@@ -243,8 +300,30 @@ Irohad::RunResult Irohad::initValidatorsConfigs() {
  */
 Irohad::RunResult Irohad::initStorage(
     StartupWsvDataPolicy startup_wsv_data_policy) {
+  auto block_store_format = iroha::ametsuchi::FlatFileBlockFormat::kJson;
+  if (config_.block_store_format) {
+    auto format = iroha::ametsuchi::flatFileBlockFormatFromString(
+        config_.block_store_format.value());
+    if (not format) {
+      return expected::makeError(fmt::format("Unknown block store format {}",
+                                             *config_.block_store_format));
+    }
+    block_store_format = *format;
+  }
+  auto block_store_type = iroha::ametsuchi::KeyValueStorageType::kFilePerBlock;
+  if (config_.block_store_type) {
+    auto type = iroha::ametsuchi::keyValueStorageTypeFromString(
+        config_.block_store_type.value());
+    if (not type) {
+      return expected::makeError(fmt::format("Unknown block store type {}",
+                                             *config_.block_store_type));
+    }
+    block_store_type = *type;
+  }
+
   return PgConnectionInit::init(startup_wsv_data_policy, *pg_opt_, log_manager_)
-             | [this](auto &&pool_wrapper) -> RunResult {
+             | [this, block_store_type, block_store_format](
+                   auto &&pool_wrapper) -> RunResult {
     pool_wrapper_ = std::move(pool_wrapper);
     query_response_factory_ =
         std::make_shared<shared_model::proto::ProtoQueryResponseFactory>();
@@ -255,12 +334,25 @@ Irohad::RunResult Irohad::initStorage(
       vm_caller_ref = *vm_caller_.value();
     }
 
+    auto tx_hash_filter_size =
+        config_.tx_hash_filter_size.value_or(kTxHashFilterSizeDefault);
+    tx_hash_filter_ = tx_hash_filter_size > 0
+        ? std::make_shared<iroha::ametsuchi::TxHashFilter>(tx_hash_filter_size)
+        : nullptr;
+
     return ::iroha::initStorage(*pg_opt_,
                                 pool_wrapper_,
                                 pending_txs_storage_,
                                 query_response_factory_,
                                 config_.block_store_path,
+                                block_store_type,
+                                block_store_format,
+                                config_.block_store_sync_batch_size.value_or(
+                                    kBlockStoreSyncBatchSizeDefault),
                                 vm_caller_ref,
+                                config_.wsv_cache_size.value_or(
+                                    kWsvCacheSizeDefault),
+                                tx_hash_filter_,
                                 log_manager_->getChild("Storage"))
                | [&](auto &&v) -> RunResult {
       storage = std::move(v);
@@ -445,7 +537,18 @@ Irohad::RunResult Irohad::initValidators() {
   stateful_validator = std::make_shared<StatefulValidatorImpl>(
       std::move(factory),
       batch_parser,
-      validators_log_manager->getChild("Stateful")->getLogger());
+      validators_log_manager->getChild("Stateful")->getLogger(),
+      config_.stateful_validation_threads.value_or(
+          kStatefulValidationThreadsDefault),
+      [this] {
+        using ReturnType =
+            expected::Result<std::unique_ptr<TemporaryWsv>, std::string>;
+        return storage->createCommandExecutor() |
+            [this](auto &&command_executor) -> ReturnType {
+          return storage->createTemporaryWsv(std::move(command_executor));
+        };
+      },
+      signature_verification_pool_);
   chain_validator = std::make_shared<ChainValidatorImpl>(
       getSupermajorityChecker(kConsensusConsistencyModel),
       validators_log_manager->getChild("Chain")->getLogger());
@@ -542,7 +645,8 @@ Irohad::RunResult Irohad::initFactories() {
  * Initializing persistent cache
  */
 Irohad::RunResult Irohad::initPersistentCache() {
-  persistent_cache = std::make_shared<TxPresenceCacheImpl>(storage);
+  persistent_cache =
+      std::make_shared<TxPresenceCacheImpl>(storage, tx_hash_filter_);
 
   log_->info("[Init] => persistent cache");
   return {};
@@ -596,6 +700,14 @@ Irohad::RunResult Irohad::initOrderingGate() {
   std::shared_ptr<iroha::ordering::ProposalCreationStrategy> proposal_strategy =
       std::make_shared<ordering::UniqueCreationProposalStrategy>();
 
+  auto packing_policy = ordering::createProposalPackingPolicy(
+      config_.proposal_packing_policy.value_or(kProposalPackingPolicyDefault));
+  if (not packing_policy) {
+    return expected::makeError(
+        fmt::format("Unknown proposal packing policy {}",
+                    *config_.proposal_packing_policy));
+  }
+
   ordering_gate = ordering_init.initOrderingGate(
       config_.max_proposal_size,
       std::chrono::milliseconds(config_.proposal_delay),
@@ -608,6 +720,7 @@ Irohad::RunResult Irohad::initOrderingGate() {
       proposal_factory,
       persistent_cache,
       proposal_strategy,
+      std::move(packing_policy),
       log_manager_->getChild("Ordering"),
       inter_peer_client_factory_);
   log_->info("[Init] => init ordering gate - [{}]",
@@ -713,7 +826,9 @@ Irohad::RunResult Irohad::initConsensusGate() {
       log_manager_->getChild("Consensus"),
       std::chrono::milliseconds(
           config_.max_round_delay_ms.value_or(kMaxRoundsDelayDefault)),
-      inter_peer_client_factory_);
+      inter_peer_client_factory_,
+      config_.yac_commit_certificates.value_or(kYacCommitCertificatesDefault),
+      signature_verification_pool_);
   consensus_gate->onOutcome().subscribe(
       consensus_gate_events_subscription,
       consensus_gate_objects.get_subscriber());
@@ -734,7 +849,19 @@ Irohad::RunResult Irohad::initSynchronizer() {
         storage,
         storage,
         block_loader,
-        log_manager_->getChild("Synchronizer")->getLogger());
+        log_manager_->getChild("Synchronizer")->getLogger(),
+        std::make_shared<ParallelBlockLoader>(
+            block_loader,
+            config_.block_download_range_size.value_or(
+                kBlockDownloadRangeSizeDefault),
+            config_.block_download_ranges_ahead.value_or(
+                kBlockDownloadRangesAheadDefault),
+            std::chrono::milliseconds(
+                config_.block_download_stall_timeout.value_or(
+                    kBlockDownloadStallTimeoutDefault)),
+            log_manager_->getChild("Synchronizer")
+                ->getChild("ParallelBlockLoader")
+                ->getLogger()));
 
     log_->info("[Init] => synchronizer");
     return {};
@@ -862,6 +989,8 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
       cs_cache,
       persistent_cache,
       command_service_log_manager->getLogger());
+  const auto torii_validation_threads =
+      config_.torii_validation_threads.value_or(kToriiValidationThreadsDefault);
   command_service_transport =
       std::make_shared<::torii::CommandServiceTransportGrpc>(
           command_service,
@@ -875,6 +1004,9 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
           }),
           config_.stale_stream_max_rounds.value_or(
               kStaleStreamMaxRoundsDefault),
+          torii_validation_threads > 1
+              ? std::make_shared<ThreadPool>(torii_validation_threads)
+              : nullptr,
           command_service_log_manager->getChild("Transport")->getLogger());
 
   log_->info("[Init] => command service");
@@ -913,10 +1045,28 @@ Irohad::RunResult Irohad::initWsvRestorer() {
       std::move(interface_validator),
       std::move(proto_validator),
       chain_validator,
-      log_manager_->getChild("WsvRestorer")->getLogger());
+      log_manager_->getChild("WsvRestorer")->getLogger(),
+      config_.wsv_replay_threads.value_or(kWsvReplayThreadsDefault));
   return {};
 }
 
+Irohad::RunResult Irohad::initMetrics() {
+  if (not config_.metrics_port) {
+    return {};
+  }
+  return iroha::metrics::MetricsExporter::create(
+             iroha::metrics::registry(),
+             *config_.metrics_port,
+             log_manager_->getChild("Metrics")->getLogger())
+      | [this](auto &&exporter) -> RunResult {
+    metrics_exporter_ = std::move(exporter);
+    // transactions are tracked only when the metrics are exported
+    iroha::metrics::transactionStages().enable();
+    log_->info("[Init] => metrics exporter");
+    return {};
+  };
+}
+
 /**
  * Run iroha daemon
  */
@@ -28,15 +28,20 @@ namespace iroha {
   class PendingTransactionStorage;
   class PendingTransactionStorageInit;
   class MstProcessor;
+  class ThreadPool;
   namespace ametsuchi {
     class WsvRestorer;
     class TxPresenceCache;
+    class TxHashFilter;
     class Storage;
     class ReconnectionStrategyFactory;
     class PostgresOptions;
     struct PoolWrapper;
     class VmCaller;
   }  // namespace ametsuchi
+  namespace metrics {
+    class MetricsExporter;
+  }  // namespace metrics
   namespace consensus {
     namespace yac {
       class YacInit;
@@ -148,6 +153,19 @@ class Irohad {
 
   RunResult resetWsv();
 
+  /**
+   * Write WSV at the top block to the snapshot file
+   * @param path - path of the snapshot file
+   */
+  RunResult exportWsvSnapshot(const std::string &path);
+
+  /**
+   * Drop wsv and block store and load WSV from the snapshot file, so that
+   * only the blocks after its height are synchronized
+   * @param path - path of the snapshot file
+   */
+  RunResult importWsvSnapshot(const std::string &path);
+
   /**
    * Run worker threads for start performing
    * @return void value on success, error message otherwise
@@ -214,6 +232,11 @@ class Irohad {
    */
   virtual RunResult initWsvRestorer();
 
+  /**
+   * Start serving metrics, if the port is configured
+   */
+  RunResult initMetrics();
+
   // constructor dependencies
   IrohadConfig config_;
   const std::string listen_ip_;
@@ -278,6 +301,7 @@ class Irohad {
   std::shared_ptr<shared_model::interface::TransactionBatchParser> batch_parser;
 
   // validators
+  std::shared_ptr<iroha::ThreadPool> signature_verification_pool_;
   std::shared_ptr<shared_model::validation::ValidatorsConfig>
       validators_config_;
   std::shared_ptr<shared_model::validation::ValidatorsConfig>
@@ -313,6 +337,9 @@ class Irohad {
       iroha::protocol::BlocksQuery>>
       blocks_query_factory;
 
+  // filter of committed and rejected transaction hashes, optional
+  std::shared_ptr<iroha::ametsuchi::TxHashFilter> tx_hash_filter_;
+
   // persistent cache
   std::shared_ptr<iroha::ametsuchi::TxPresenceCache> persistent_cache;
 
@@ -367,6 +394,8 @@ class Irohad {
       torii_tls_server = boost::none;
   std::unique_ptr<iroha::network::ServerRunner> internal_server;
 
+  std::unique_ptr<iroha::metrics::MetricsExporter> metrics_exporter_;
+
   logger::LoggerManagerTreePtr log_manager_;  ///< application root log manager
 
   logger::LoggerPtr log_;  ///< log for local messages
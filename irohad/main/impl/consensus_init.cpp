@@ -28,9 +28,12 @@ namespace {
     return std::make_shared<PeerOrdererImpl>(peer_query_factory);
   }
 
-  auto createCryptoProvider(const shared_model::crypto::Keypair &keypair,
-                            logger::LoggerPtr log) {
-    auto crypto = std::make_shared<CryptoProviderImpl>(keypair, std::move(log));
+  auto createCryptoProvider(
+      const shared_model::crypto::Keypair &keypair,
+      std::shared_ptr<iroha::ThreadPool> signature_verification_pool,
+      logger::LoggerPtr log) {
+    auto crypto = std::make_shared<CryptoProviderImpl>(
+        keypair, std::move(log), std::move(signature_verification_pool));
 
     return crypto;
   }
@@ -43,6 +46,7 @@ namespace {
       ClusterOrdering initial_order,
       Round initial_round,
       const shared_model::crypto::Keypair &keypair,
+      std::shared_ptr<iroha::ThreadPool> signature_verification_pool,
       std::shared_ptr<Timer> timer,
       std::shared_ptr<YacNetwork> network,
       ConsistencyModel consistency_model,
@@ -56,7 +60,9 @@ namespace {
                        consensus_log_manager->getChild("VoteStorage")),
         std::move(network),
         createCryptoProvider(
-            keypair, consensus_log_manager->getChild("Crypto")->getLogger()),
+            keypair,
+            std::move(signature_verification_pool),
+            consensus_log_manager->getChild("Crypto")->getLogger()),
         std::move(timer),
         initial_order,
         initial_round,
@@ -103,7 +109,9 @@ namespace iroha {
           const logger::LoggerManagerTreePtr &consensus_log_manager,
           std::chrono::milliseconds delay,
           std::shared_ptr<iroha::network::GenericClientFactory>
-              client_factory) {
+              client_factory,
+          bool send_commit_certificates,
+          std::shared_ptr<iroha::ThreadPool> signature_verification_pool) {
         auto peer_orderer = createPeerOrderer(peer_query_factory);
         auto peers = peer_query_factory->createPeerQuery() |
             [](auto &&peer_query) { return peer_query->getLedgerPeers(); };
@@ -113,11 +121,13 @@ namespace iroha {
             std::make_unique<
                 iroha::network::ClientFactoryImpl<NetworkImpl::Service>>(
                 std::move(client_factory)),
-            consensus_log_manager->getChild("Network")->getLogger());
+            consensus_log_manager->getChild("Network")->getLogger(),
+            send_commit_certificates);
 
         auto yac = createYac(*ClusterOrdering::create(peers.value()),
                              initial_round,
                              keypair,
+                             std::move(signature_verification_pool),
                              createTimer(vote_delay_milliseconds),
                              consensus_network_,
                              consistency_model,
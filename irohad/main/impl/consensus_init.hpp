@@ -25,6 +25,8 @@
 #include "simulator/block_creator.hpp"
 
 namespace iroha {
+  class ThreadPool;
+
   namespace network {
     class GenericClientFactory;
   }
@@ -52,7 +54,9 @@ namespace iroha {
             const logger::LoggerManagerTreePtr &consensus_log_manager,
             std::chrono::milliseconds delay,
             std::shared_ptr<iroha::network::GenericClientFactory>
-                client_factory);
+                client_factory,
+            bool send_commit_certificates,
+            std::shared_ptr<ThreadPool> signature_verification_pool);
 
         std::shared_ptr<NetworkImpl> getConsensusNetwork() const;
 
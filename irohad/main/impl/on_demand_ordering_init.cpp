@@ -277,13 +277,16 @@ auto OnDemandOrderingInit::createService(
         proposal_factory,
     std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> creation_strategy,
+    std::shared_ptr<ProposalPackingPolicy> packing_policy,
     const logger::LoggerManagerTreePtr &ordering_log_manager) {
   return std::make_shared<OnDemandOrderingServiceImpl>(
       max_number_of_transactions,
       std::move(proposal_factory),
       std::move(tx_cache),
       creation_strategy,
-      ordering_log_manager->getChild("Service")->getLogger());
+      ordering_log_manager->getChild("Service")->getLogger(),
+      OnDemandOrderingServiceImpl::kDefaultNumberOfProposals,
+      std::move(packing_policy));
 }
 
 OnDemandOrderingInit::~OnDemandOrderingInit() {
@@ -309,12 +312,14 @@ OnDemandOrderingInit::initOrderingGate(
     std::shared_ptr<TransportFactoryType> proposal_transport_factory,
     std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> creation_strategy,
+    std::shared_ptr<ProposalPackingPolicy> packing_policy,
     logger::LoggerManagerTreePtr ordering_log_manager,
     std::shared_ptr<iroha::network::GenericClientFactory> client_factory) {
   auto ordering_service = createService(max_number_of_transactions,
                                         proposal_factory,
                                         tx_cache,
                                         creation_strategy,
+                                        std::move(packing_policy),
                                         ordering_log_manager);
   service = std::make_shared<transport::OnDemandOsServerGrpc>(
       ordering_service,
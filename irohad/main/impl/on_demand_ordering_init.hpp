@@ -57,6 +57,7 @@ namespace iroha {
   namespace ordering {
     class OnDemandOrderingService;
     class ProposalCreationStrategy;
+    class ProposalPackingPolicy;
     namespace transport {
       class OdOsNotification;
     }
@@ -113,6 +114,7 @@ namespace iroha {
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> creation_strategy,
+          std::shared_ptr<ProposalPackingPolicy> packing_policy,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       rxcpp::composite_subscription sync_event_notifier_lifetime_;
@@ -145,6 +147,7 @@ namespace iroha {
        * proposals
        * @param creation_strategy - provides a strategy for creating proposals
        * in OS
+       * @param packing_policy - selects pending batches for proposals in OS
        * @param client_factory - a factory of client stubs
        * @return initialized ordering gate
        */
@@ -166,6 +169,7 @@ namespace iroha {
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> creation_strategy,
+          std::shared_ptr<ProposalPackingPolicy> packing_policy,
           logger::LoggerManagerTreePtr ordering_log_manager,
           std::shared_ptr<iroha::network::GenericClientFactory> client_factory);
 
@@ -25,6 +25,58 @@ namespace {
     return formatted_message;
   }
 
+  /// Secondary indices of transaction tables, dropped during bulk loading
+  const std::string kTransactionIndicesSql = R"(
+CREATE INDEX IF NOT EXISTS tx_positions_hash_index
+    ON tx_positions
+    USING hash
+    (hash);
+CREATE INDEX IF NOT EXISTS tx_positions_creator_id_asset_height_index
+    ON tx_positions
+    (creator_id, asset_id, height, index);
+CREATE INDEX IF NOT EXISTS tx_positions_creator_id_asset_ts_index
+    ON tx_positions
+    (creator_id, asset_id, ts, height, index);
+CREATE INDEX IF NOT EXISTS tx_positions_ts_height_index_index
+    ON tx_positions
+    (ts);
+CREATE INDEX IF NOT EXISTS tx_status_by_hash_hash_index
+    ON tx_status_by_hash
+    USING hash
+    (hash);
+)";
+
+  /// Account details by their writers and keys
+  const std::string kAccountDetailTableSql = R"(
+CREATE TABLE IF NOT EXISTS account_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value jsonb NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
+)";
+
+  /// Number of account details by their accounts and writers
+  const std::string kAccountDetailCountTableSql = R"(
+CREATE TABLE IF NOT EXISTS account_detail_count (
+    account_id character varying(288) NOT NULL,
+    writer character varying(288) NOT NULL,
+    count bigint NOT NULL,
+    PRIMARY KEY (account_id, writer)
+);
+)";
+
+  /// Number of transactions by their related accounts and assets
+  const std::string kTxPositionsCountTableSql = R"(
+CREATE TABLE IF NOT EXISTS tx_positions_count (
+    creator_id text,
+    asset_id text,
+    count bigint,
+    PRIMARY KEY (creator_id, asset_id)
+);
+)";
+
   /// WSV schema version is identified by compatibile irohad version.
   using SchemaVersion = iroha::IrohadVersion;
 
@@ -159,7 +211,10 @@ PgConnectionInit::prepareWorkingDatabase(
                  "Either overwrite the ledger or use a compatible binary "
                  "version.";
         }
-        return iroha::expected::Value<void>{};
+        return getWorkingDbSession(options) | [](auto sql) {
+          return migrateAccountDetails(*sql) |
+              [&] { return migrateTransactionPositions(*sql); };
+        };
       };
     }
     return dropWorkingDatabase(options) | [&] { return createSchema(options); };
@@ -340,9 +395,9 @@ CREATE TABLE account (
     account_id character varying(288),
     domain_id character varying(255) NOT NULL REFERENCES domain,
     quorum int NOT NULL,
-    data JSONB,
     PRIMARY KEY (account_id)
 );
+)" + kAccountDetailTableSql + kAccountDetailCountTableSql + R"(
 CREATE TABLE account_has_signatory (
     account_id character varying(288) NOT NULL REFERENCES account,
     public_key varchar NOT NULL REFERENCES signatory,
@@ -388,30 +443,17 @@ CREATE TABLE account_has_grantable_permissions (
 );
 CREATE TABLE IF NOT EXISTS tx_positions (
     creator_id text,
-    hash varchar(64) not null,
+    hash bytea not null,
     asset_id text,
     ts bigint,
     height bigint,
     index bigint
 );
-CREATE INDEX IF NOT EXISTS tx_positions_hash_index
-    ON tx_positions
-    USING hash
-    (hash);
-CREATE INDEX IF NOT EXISTS tx_positions_creator_id_asset_index
-    ON tx_positions
-    (creator_id, asset_id);
-CREATE INDEX IF NOT EXISTS tx_positions_ts_height_index_index
-    ON tx_positions
-    (ts);
+)" + kTxPositionsCountTableSql + R"(
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
+    hash bytea,
     status boolean
 );
-CREATE INDEX tx_status_by_hash_hash_index
-  ON tx_status_by_hash
-  USING hash
-  (hash);
 CREATE TABLE IF NOT EXISTS setting(
     setting_key text,
     setting_value text,
@@ -453,6 +495,38 @@ CREATE INDEX IF NOT EXISTS burrow_tx_logs_topics_log_idx
     (log_idx ASC);
 )";
   session << prepare_tables_sql;
+  session << kTransactionIndicesSql;
+}
+
+iroha::expected::Result<void, std::string>
+PgConnectionInit::createTransactionIndices(soci::session &sql) {
+  try {
+    sql << kTransactionIndicesSql;
+  } catch (std::exception &e) {
+    return iroha::expected::makeError(
+        std::string{"Failed to create transaction indices: "}
+        + formatPostgresMessage(e.what()));
+  }
+  return expected::Value<void>();
+}
+
+iroha::expected::Result<void, std::string>
+PgConnectionInit::dropTransactionIndices(soci::session &sql) {
+  try {
+    static const std::string drop_indices = R"(
+      DROP INDEX IF EXISTS tx_positions_hash_index,
+          tx_positions_creator_id_asset_height_index,
+          tx_positions_creator_id_asset_ts_index,
+          tx_positions_ts_height_index_index,
+          tx_status_by_hash_hash_index;
+    )";
+    sql << drop_indices;
+  } catch (std::exception &e) {
+    return iroha::expected::makeError(
+        std::string{"Failed to drop transaction indices: "}
+        + formatPostgresMessage(e.what()));
+  }
+  return expected::Value<void>();
 }
 
 iroha::expected::Result<void, std::string>
@@ -480,6 +554,123 @@ iroha::expected::Result<void, std::string> PgConnectionInit::createSchema(
   }
 }
 
+iroha::expected::Result<void, std::string>
+PgConnectionInit::migrateBlockStorage(soci::session &sql,
+                                      const std::string &table) {
+  try {
+    std::string column_type;
+    sql << "SELECT data_type FROM information_schema.columns "
+           "WHERE table_schema = current_schema() AND table_name = :table "
+           "AND column_name = 'block_data'",
+        soci::use(table, "table"), soci::into(column_type);
+    if (not sql.got_data() or column_type != "text") {
+      return {};
+    }
+    sql << "ALTER TABLE " + table
+            + " ALTER COLUMN block_data TYPE bytea "
+              "USING decode(block_data, 'hex')";
+  } catch (const std::exception &e) {
+    return fmt::format("Failed to migrate block storage table {}: {}",
+                       table,
+                       formatPostgresMessage(e.what()));
+  }
+  return {};
+}
+
+iroha::expected::Result<void, std::string>
+PgConnectionInit::migrateAccountDetails(soci::session &sql) {
+  try {
+    int has_data_column = 0;
+    sql << "SELECT count(*) FROM information_schema.columns "
+           "WHERE table_schema = current_schema() AND table_name = 'account' "
+           "AND column_name = 'data'",
+        soci::into(has_data_column);
+    int has_count_table = 0;
+    sql << "SELECT count(*) FROM information_schema.tables "
+           "WHERE table_schema = current_schema() "
+           "AND table_name = 'account_detail_count'",
+        soci::into(has_count_table);
+    if (has_data_column == 0 and has_count_table != 0) {
+      return {};
+    }
+    soci::transaction transaction(sql);
+    if (has_data_column != 0) {
+      sql << kAccountDetailTableSql;
+      sql << R"(
+        INSERT INTO account_detail(account_id, writer, key, value)
+        SELECT account.account_id, data_by_writer.key, plain_data.key,
+            plain_data.value
+        FROM account,
+            jsonb_each(account.data) data_by_writer,
+            jsonb_each(data_by_writer.value) plain_data
+        WHERE account.data IS NOT NULL
+        ON CONFLICT DO NOTHING;
+        ALTER TABLE account DROP COLUMN data;
+      )";
+    }
+    if (has_count_table == 0) {
+      sql << kAccountDetailCountTableSql;
+      sql << R"(
+        INSERT INTO account_detail_count(account_id, writer, count)
+        SELECT account_id, writer, count(*)
+        FROM account_detail
+        GROUP BY 1, 2;
+      )";
+    }
+    transaction.commit();
+  } catch (const std::exception &e) {
+    return fmt::format("Failed to migrate account details: {}",
+                       formatPostgresMessage(e.what()));
+  }
+  return {};
+}
+
+iroha::expected::Result<void, std::string>
+PgConnectionInit::migrateTransactionPositions(soci::session &sql) {
+  try {
+    int has_count_table = 0;
+    sql << "SELECT count(*) FROM information_schema.tables "
+           "WHERE table_schema = current_schema() "
+           "AND table_name = 'tx_positions_count'",
+        soci::into(has_count_table);
+    int has_text_hashes = 0;
+    sql << "SELECT count(*) FROM information_schema.columns "
+           "WHERE table_schema = current_schema() "
+           "AND table_name = 'tx_positions' AND column_name = 'hash' "
+           "AND data_type <> 'bytea'",
+        soci::into(has_text_hashes);
+    soci::transaction transaction(sql);
+    if (has_text_hashes != 0) {
+      // older versions stored the hashes as hex strings
+      sql << R"(
+        ALTER TABLE tx_positions
+            ALTER COLUMN hash TYPE bytea USING decode(hash, 'hex');
+        ALTER TABLE tx_status_by_hash
+            ALTER COLUMN hash TYPE bytea USING decode(hash, 'hex');
+      )";
+    }
+    if (has_count_table == 0) {
+      // the indexer counts each transaction once per account and asset,
+      // account transactions are counted with an empty asset
+      sql << kTxPositionsCountTableSql;
+      sql << R"(
+        INSERT INTO tx_positions_count(creator_id, asset_id, count)
+        SELECT creator_id, COALESCE(asset_id, ''), count(DISTINCT hash)
+        FROM tx_positions
+        GROUP BY 1, 2;
+      )";
+    }
+    // older versions indexed only (creator_id, asset_id) under this name
+    sql << "DROP INDEX IF EXISTS tx_positions_creator_id_asset_index";
+    sql << kTransactionIndicesSql;
+    transaction.commit();
+  } catch (const std::exception &e) {
+    return fmt::format("Failed to migrate transaction positions: {}",
+                       formatPostgresMessage(e.what()));
+  }
+  return {};
+}
+
 iroha::expected::Result<void, std::string> PgConnectionInit::resetPeers(
     soci::session &sql) {
   try {
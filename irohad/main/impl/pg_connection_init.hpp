@@ -68,6 +68,56 @@ namespace iroha {
        */
       static expected::Result<void, std::string> resetPeers(soci::session &sql);
 
+      /**
+       * Converts block storage table created by older versions, which kept
+       * hex encoded blocks in a text column, to the bytea column. Does
+       * nothing if the table does not exist or is already converted.
+       * @param sql - session to the working database
+       * @param table - name of the block storage table
+       * @return error message if the conversion has failed
+       */
+      static expected::Result<void, std::string> migrateBlockStorage(
+          soci::session &sql, const std::string &table);
+
+      /**
+       * Moves account details from the JSONB column of account table, where
+       * older versions kept them, to the account_detail table, and counts
+       * them by accounts and writers. Does nothing if they are already moved
+       * and counted.
+       * @param sql - session to the working database
+       * @return error message if the migration has failed
+       */
+      static expected::Result<void, std::string> migrateAccountDetails(
+          soci::session &sql);
+
+      /**
+       * Converts hex transaction hashes of older versions to bytea, creates
+       * the table of transaction numbers by accounts and assets, filling it
+       * from the transaction index, and replaces the account transaction
+       * index of older versions. Does nothing if they are already migrated.
+       * @param sql - session to the working database
+       * @return error message if the migration has failed
+       */
+      static expected::Result<void, std::string> migrateTransactionPositions(
+          soci::session &sql);
+
+      /**
+       * Create secondary indices of transaction index tables
+       * @param sql - session to the working database
+       * @return error message if the creation has failed
+       */
+      static expected::Result<void, std::string> createTransactionIndices(
+          soci::session &sql);
+
+      /**
+       * Drop secondary indices of transaction index tables, so that a large
+       * amount of rows can be loaded without maintaining them
+       * @param sql - session to the working database
+       * @return error message if dropping has failed
+       */
+      static expected::Result<void, std::string> dropTransactionIndices(
+          soci::session &sql);
+
       /// Create tables in the given session. Left public for tests.
       static void prepareTables(soci::session &session);
 
@@ -9,9 +9,11 @@
 
 #include <fmt/core.h>
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
+#include "ametsuchi/impl/key_value_storage_factory.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_block_storage_factory.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "backend/protobuf/proto_block_json_converter.hpp"
 #include "backend/protobuf/proto_permission_to_string.hpp"
 #include "common/result.hpp"
@@ -34,11 +36,16 @@ class StorageInitException : public std::runtime_error {
 };
 
 namespace {
-  std::unique_ptr<BlockStorage> makeFlatFileBlockStorage(
+  std::unique_ptr<FlatFileBlockStorage> makeFlatFileBlockStorage(
       std::string const &block_storage_dir,
-      logger::LoggerManagerTreePtr log_manager) {
-    auto flat_file = FlatFile::create(
-        block_storage_dir, log_manager->getChild("FlatFile")->getLogger());
+      KeyValueStorageType block_storage_type,
+      FlatFileBlockFormat block_storage_format,
+      logger::LoggerManagerTreePtr log_manager,
+      size_t block_storage_sync_batch_size = 1) {
+    auto flat_file = createKeyValueStorage(block_storage_type,
+                                           block_storage_dir,
+                                           log_manager,
+                                           block_storage_sync_batch_size);
     if (auto err = iroha::expected::resultToOptionalError(flat_file)) {
       throw StorageInitException{err.value()};
     }
@@ -47,7 +54,9 @@ namespace {
             std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
     return std::make_unique<FlatFileBlockStorage>(
         std::move(flat_file.assumeValue()),
-        block_converter,
+        FlatFileBlockCodec(block_storage_format,
+                           block_converter,
+                           not checksumsRecords(block_storage_type)),
         log_manager->getChild("FlatFileBlockStorage")->getLogger());
   }
 
@@ -59,7 +68,11 @@ namespace {
     const std::string persistent_table("blocks");
 
     if (auto err = iroha::expected::resultToOptionalError(
-            PostgresBlockStorageFactory::createTable(*sql, persistent_table))) {
+            PgConnectionInit::migrateBlockStorage(*sql, persistent_table) |
+            [&] {
+              return PostgresBlockStorageFactory::createTable(
+                  *sql, persistent_table);
+            })) {
       throw StorageInitException{err.value()};
     }
 
@@ -84,8 +97,13 @@ iroha::initStorage(
     std::shared_ptr<shared_model::interface::QueryResponseFactory>
         query_response_factory,
     boost::optional<std::string> block_storage_dir,
+    KeyValueStorageType block_storage_type,
+    FlatFileBlockFormat block_storage_format,
+    size_t block_storage_sync_batch_size,
     std::optional<std::reference_wrapper<const iroha::ametsuchi::VmCaller>>
         vm_caller_ref,
+    size_t wsv_cache_size,
+    std::shared_ptr<iroha::ametsuchi::TxHashFilter> tx_hash_filter,
     logger::LoggerManagerTreePtr log_manager) {
   try {
     auto perm_converter =
@@ -107,7 +125,11 @@ iroha::initStorage(
             log_manager->getChild("TemporaryBlockStorage")->getLogger());
 
     auto persistent_block_storage = block_storage_dir
-        ? makeFlatFileBlockStorage(block_storage_dir.value(), log_manager)
+        ? makeFlatFileBlockStorage(block_storage_dir.value(),
+                                   block_storage_type,
+                                   block_storage_format,
+                                   log_manager,
+                                   block_storage_sync_batch_size)
         : makePostgresBlockStorage(
               pool_wrapper, block_transport_factory, log_manager);
     return StorageImpl::create(pg_opt,
@@ -118,9 +140,30 @@ iroha::initStorage(
                                std::move(temporary_block_storage_factory),
                                std::move(persistent_block_storage),
                                vm_caller_ref,
+                               wsv_cache_size > 0
+                                   ? std::make_shared<WsvCache>(wsv_cache_size)
+                                   : nullptr,
+                               std::move(tx_hash_filter),
                                log_manager->getChild("Storage"));
   } catch (StorageInitException const &e) {
     return iroha::expected::makeError(
         fmt::format("Storage initialization failed: ", e.what()));
   }
 }
+
+iroha::expected::Result<size_t, std::string> iroha::convertFlatFileBlockStorage(
+    std::string const &block_storage_dir,
+    KeyValueStorageType block_storage_type,
+    FlatFileBlockFormat block_storage_format,
+    logger::LoggerManagerTreePtr log_manager) {
+  try {
+    return makeFlatFileBlockStorage(block_storage_dir,
+                                    block_storage_type,
+                                    block_storage_format,
+                                    log_manager)
+        ->convertToWriteFormat();
+  } catch (StorageInitException const &e) {
+    return iroha::expected::makeError(
+        fmt::format("Block storage conversion failed: {}", e.what()));
+  }
+}
@@ -24,9 +24,12 @@ namespace iroha {
   class PendingTransactionStorage;
 
   namespace ametsuchi {
+    enum class FlatFileBlockFormat;
+    enum class KeyValueStorageType;
     struct PoolWrapper;
     class PostgresOptions;
     class Storage;
+    class TxHashFilter;
     class VmCaller;
   }  // namespace ametsuchi
 
@@ -38,8 +41,28 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
           query_response_factory,
       boost::optional<std::string> block_storage_dir,
+      iroha::ametsuchi::KeyValueStorageType block_storage_type,
+      iroha::ametsuchi::FlatFileBlockFormat block_storage_format,
+      size_t block_storage_sync_batch_size,
       std::optional<std::reference_wrapper<const iroha::ametsuchi::VmCaller>>
           vm_caller_ref,
+      size_t wsv_cache_size,
+      std::shared_ptr<iroha::ametsuchi::TxHashFilter> tx_hash_filter,
+      logger::LoggerManagerTreePtr log_manager);
+
+  /**
+   * Rewrite blocks of a flat file block storage which are not stored in the
+   * given format
+   * @param block_storage_dir - path to the block storage
+   * @param block_storage_type - layout of the block storage
+   * @param block_storage_format - target format
+   * @param log_manager - log manager
+   * @return number of converted blocks or an error
+   */
+  expected::Result<size_t, std::string> convertFlatFileBlockStorage(
+      std::string const &block_storage_dir,
+      iroha::ametsuchi::KeyValueStorageType block_storage_type,
+      iroha::ametsuchi::FlatFileBlockFormat block_storage_format,
       logger::LoggerManagerTreePtr log_manager);
 }  // namespace iroha
 
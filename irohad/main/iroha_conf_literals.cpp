@@ -7,6 +7,9 @@
 
 namespace config_members {
   const char *BlockStorePath = "block_store_path";
+  const char *BlockStoreFormat = "block_store_format";
+  const char *BlockStoreType = "block_store_type";
+  const char *BlockStoreSyncBatchSize = "block_store_sync_batch_size";
   const char *ToriiPort = "torii_port";
   const char *ToriiTlsParams = "torii_tls_params";
   const char *InterPeerTls = "inter_peer_tls";
@@ -33,6 +36,17 @@ namespace config_members {
   const char *MstExpirationTime = "mst_expiration_time";
   const char *MaxRoundsDelay = "max_rounds_delay";
   const char *StaleStreamMaxRounds = "stale_stream_max_rounds";
+  const char *StatefulValidationThreads = "stateful_validation_threads";
+  const char *WsvCacheSize = "wsv_cache_size";
+  const char *ToriiValidationThreads = "torii_validation_threads";
+  const char *TxHashFilterSize = "tx_hash_filter_size";
+  const char *ProposalPackingPolicy = "proposal_packing_policy";
+  const char *WsvReplayThreads = "wsv_replay_threads";
+  const char *BlockDownloadRangeSize = "block_download_range_size";
+  const char *BlockDownloadRangesAhead = "block_download_ranges_ahead";
+  const char *BlockDownloadStallTimeout = "block_download_stall_timeout";
+  const char *YacCommitCertificates = "yac_commit_certificates";
+  const char *MetricsPort = "metrics_port";
   const char *LogSection = "log";
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
@@ -13,6 +13,9 @@
 
 namespace config_members {
   extern const char *BlockStorePath;
+  extern const char *BlockStoreFormat;
+  extern const char *BlockStoreType;
+  extern const char *BlockStoreSyncBatchSize;
   extern const char *ToriiPort;
   extern const char *ToriiTlsParams;
   extern const char *InterPeerTls;
@@ -39,6 +42,17 @@ namespace config_members {
   extern const char *MstExpirationTime;
   extern const char *MaxRoundsDelay;
   extern const char *StaleStreamMaxRounds;
+  extern const char *StatefulValidationThreads;
+  extern const char *WsvCacheSize;
+  extern const char *ToriiValidationThreads;
+  extern const char *TxHashFilterSize;
+  extern const char *ProposalPackingPolicy;
+  extern const char *WsvReplayThreads;
+  extern const char *BlockDownloadRangeSize;
+  extern const char *BlockDownloadRangesAhead;
+  extern const char *BlockDownloadStallTimeout;
+  extern const char *YacCommitCertificates;
+  extern const char *MetricsPort;
   extern const char *LogSection;
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
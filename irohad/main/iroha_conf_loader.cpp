@@ -676,6 +676,10 @@ template <>
 inline bool JsonDeserializerImpl::loadInto(IrohadConfig &dest) {
   using namespace config_members;
   return getDictChild(BlockStorePath).loadInto(dest.block_store_path)
+      and getDictChild(BlockStoreFormat).loadInto(dest.block_store_format)
+      and getDictChild(BlockStoreType).loadInto(dest.block_store_type)
+      and getDictChild(BlockStoreSyncBatchSize)
+              .loadInto(dest.block_store_sync_batch_size)
       and getDictChild(ToriiPort).loadInto(dest.torii_port)
       and getDictChild(ToriiTlsParams).loadInto(dest.torii_tls_params)
       and getDictChild(InterPeerTls).loadInto(dest.inter_peer_tls)
@@ -690,6 +694,24 @@ inline bool JsonDeserializerImpl::loadInto(IrohadConfig &dest) {
       and getDictChild(MaxRoundsDelay).loadInto(dest.max_round_delay_ms)
       and getDictChild(StaleStreamMaxRounds)
               .loadInto(dest.stale_stream_max_rounds)
+      and getDictChild(StatefulValidationThreads)
+              .loadInto(dest.stateful_validation_threads)
+      and getDictChild(WsvCacheSize).loadInto(dest.wsv_cache_size)
+      and getDictChild(ToriiValidationThreads)
+              .loadInto(dest.torii_validation_threads)
+      and getDictChild(TxHashFilterSize).loadInto(dest.tx_hash_filter_size)
+      and getDictChild(ProposalPackingPolicy)
+              .loadInto(dest.proposal_packing_policy)
+      and getDictChild(WsvReplayThreads).loadInto(dest.wsv_replay_threads)
+      and getDictChild(BlockDownloadRangeSize)
+              .loadInto(dest.block_download_range_size)
+      and getDictChild(BlockDownloadRangesAhead)
+              .loadInto(dest.block_download_ranges_ahead)
+      and getDictChild(BlockDownloadStallTimeout)
+              .loadInto(dest.block_download_stall_timeout)
+      and getDictChild(YacCommitCertificates)
+              .loadInto(dest.yac_commit_certificates)
+      and getDictChild(MetricsPort).loadInto(dest.metrics_port)
       and getDictChild(LogSection).loadInto(dest.logger_manager)
       and getDictChild(InitialPeers).loadInto(dest.initial_peers)
       and getDictChild(UtilityService).loadInto(dest.utility_service)
@@ -47,6 +47,9 @@ struct IrohadConfig {
   // TODO: block_store_path is now optional, change docs IR-576
   // luckychess 29.06.2019
   boost::optional<std::string> block_store_path;
+  boost::optional<std::string> block_store_format;
+  boost::optional<std::string> block_store_type;
+  boost::optional<uint32_t> block_store_sync_batch_size;
   uint16_t torii_port;
   boost::optional<iroha::torii::TlsParams> torii_tls_params;
   boost::optional<InterPeerTls> inter_peer_tls;
@@ -62,6 +65,17 @@ struct IrohadConfig {
   boost::optional<uint32_t> mst_expiration_time;
   boost::optional<uint32_t> max_round_delay_ms;
   boost::optional<uint32_t> stale_stream_max_rounds;
+  boost::optional<uint32_t> stateful_validation_threads;
+  boost::optional<uint32_t> wsv_cache_size;
+  boost::optional<uint32_t> torii_validation_threads;
+  boost::optional<uint32_t> tx_hash_filter_size;
+  boost::optional<std::string> proposal_packing_policy;
+  boost::optional<uint32_t> wsv_replay_threads;
+  boost::optional<uint32_t> block_download_range_size;
+  boost::optional<uint32_t> block_download_ranges_ahead;
+  boost::optional<uint32_t> block_download_stall_timeout;
+  boost::optional<bool> yac_commit_certificates;
+  boost::optional<uint16_t> metrics_port;
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
   boost::optional<UtilityService> utility_service;
@@ -11,6 +11,8 @@
 #include <fstream>
 #include <thread>
 
+#include "ametsuchi/impl/flat_file_block_codec.hpp"
+#include "ametsuchi/impl/key_value_storage_factory.hpp"
 #include "ametsuchi/storage.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "common/bind.hpp"
@@ -25,6 +27,7 @@
 #include "logger/logger_manager.hpp"
 #include "main/application.hpp"
 #include "main/impl/pg_connection_init.hpp"
+#include "main/impl/storage_init.hpp"
 #include "main/iroha_conf_literals.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/raw_block_loader.hpp"
@@ -85,6 +88,31 @@ DEFINE_bool(wait_for_new_blocks,
             "Startup synchronization policy - waits for new blocks in "
             "blockstore, does not run network");
 
+/**
+ * Startup option to rewrite existing flat file blocks in the configured
+ * block_store_format.
+ */
+DEFINE_bool(convert_block_store,
+            false,
+            "Converts blocks in block_store_path to block_store_format before "
+            "startup");
+
+/**
+ * Startup option to write WSV snapshot and exit.
+ */
+DEFINE_string(export_snapshot,
+              "",
+              "Writes WSV snapshot at the top block to the given file and "
+              "exits");
+
+/**
+ * Startup option to load WSV from snapshot instead of replaying blocks.
+ */
+DEFINE_string(import_snapshot,
+              "",
+              "Drops existing ledger data, loads WSV from the given snapshot "
+              "file and synchronizes only the blocks after its height");
+
 static bool validateVerbosity(const char *flagname, const std::string &val) {
   if (val == kLogSettingsFromConfigFile) {
     return true;
@@ -265,6 +293,46 @@ int main(int argc, char *argv[]) {
       keypair = getKeypairFromConfig(config.crypto.value());
     }
 
+    if (FLAGS_convert_block_store) {
+      if (not config.block_store_path) {
+        log->critical("Block store conversion requires block_store_path!");
+        daemon_status_notifier->notify(
+            ::iroha::utility_service::Status::kFailed);
+        return EXIT_FAILURE;
+      }
+      auto format = iroha::ametsuchi::flatFileBlockFormatFromString(
+          config.block_store_format.value_or("json"));
+      if (not format) {
+        log->critical("Unknown block store format {}",
+                      *config.block_store_format);
+        daemon_status_notifier->notify(
+            ::iroha::utility_service::Status::kFailed);
+        return EXIT_FAILURE;
+      }
+      auto type = iroha::ametsuchi::keyValueStorageTypeFromString(
+          config.block_store_type.value_or("files"));
+      if (not type) {
+        log->critical("Unknown block store type {}",
+                      *config.block_store_type);
+        daemon_status_notifier->notify(
+            ::iroha::utility_service::Status::kFailed);
+        return EXIT_FAILURE;
+      }
+      auto converted =
+          iroha::convertFlatFileBlockStorage(config.block_store_path.value(),
+                                             type.value(),
+                                             format.value(),
+                                             log_manager->getChild("Storage"));
+      if (auto e = iroha::expected::resultToOptionalError(converted)) {
+        log->critical("{}", e.value());
+        daemon_status_notifier->notify(
+            ::iroha::utility_service::Status::kFailed);
+        return EXIT_FAILURE;
+      }
+      log->info("Block store converted, {} blocks rewritten",
+                converted.assumeValue());
+    }
+
     std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt;
     if (config.database_config) {
       pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
@@ -311,6 +379,37 @@ int main(int argc, char *argv[]) {
       return EXIT_FAILURE;
     }
 
+    if (not FLAGS_export_snapshot.empty()) {
+      if (auto e = iroha::expected::resultToOptionalError(
+              irohad->exportWsvSnapshot(FLAGS_export_snapshot))) {
+        log->critical("Failed to export WSV snapshot: {}", e.value());
+        daemon_status_notifier->notify(
+            ::iroha::utility_service::Status::kFailed);
+        return EXIT_FAILURE;
+      }
+      daemon_status_notifier->notify(
+          ::iroha::utility_service::Status::kStopped);
+      return EXIT_SUCCESS;
+    }
+
+    if (not FLAGS_import_snapshot.empty()) {
+      if (not FLAGS_genesis_block.empty() or FLAGS_overwrite_ledger) {
+        log->critical(
+            "--import_snapshot cannot be used together with --genesis_block "
+            "or --overwrite_ledger.");
+        daemon_status_notifier->notify(
+            ::iroha::utility_service::Status::kFailed);
+        return EXIT_FAILURE;
+      }
+      if (auto e = iroha::expected::resultToOptionalError(
+              irohad->importWsvSnapshot(FLAGS_import_snapshot))) {
+        log->critical("Failed to import WSV snapshot: {}", e.value());
+        daemon_status_notifier->notify(
+            ::iroha::utility_service::Status::kFailed);
+        return EXIT_FAILURE;
+      }
+    }
+
     /*
      * The logic implemented below is reflected in the following truth table.
      *
@@ -105,6 +105,10 @@ namespace iroha {
     return batches_.empty();
   }
 
+  size_t MstState::batchesQuantity() const {
+    return batches_.size();
+  }
+
   std::unordered_set<DataType,
                      iroha::model::PointerBatchHasher,
                      shared_model::interface::BatchHashEquality>
@@ -125,7 +129,11 @@ namespace iroha {
 
   void MstState::eraseByTransactionHash(
       const shared_model::interface::types::HashType &hash) {
-    auto it = batches_to_hash_.left.find(hash);
+    auto key = shared_model::crypto::HashKey::fromHash(hash);
+    if (not key) {
+      return;
+    }
+    auto it = batches_to_hash_.left.find(*key);
     if (it != batches_to_hash_.left.end()) {
       batches_.right.erase(it->second);
       batches_to_hash_.left.erase(it);
@@ -207,7 +215,8 @@ namespace iroha {
 
   void MstState::rawInsert(const DataType &rhs_batch) {
     for (auto &tx : rhs_batch->transactions()) {
-      batches_to_hash_.insert({tx->hash(), rhs_batch});
+      batches_to_hash_.insert(
+          {shared_model::crypto::HashKey(tx->hash()), rhs_batch});
     }
     batches_.insert({oldestTimestamp(rhs_batch), rhs_batch});
   }
@@ -17,6 +17,7 @@
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/any_range.hpp>
 #include "cryptography/hash.hpp"
+#include "cryptography/hash_key.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
@@ -115,6 +116,11 @@ namespace iroha {
      */
     bool isEmpty() const;
 
+    /**
+     * @return number of batches inside
+     */
+    size_t batchesQuantity() const;
+
     /**
      * @return the batches from the state
      */
@@ -174,8 +180,8 @@ namespace iroha {
 
     using BatchesToHashBimap =
         boost::bimap<boost::bimaps::unordered_set_of<
-                         shared_model::interface::types::HashType,
-                         shared_model::crypto::Hash::Hasher>,
+                         shared_model::crypto::HashKey,
+                         shared_model::crypto::HashKey::Hasher>,
                      boost::bimaps::unordered_multiset_of<
                          DataType,
                          iroha::model::PointerBatchHasher,
@@ -5,6 +5,8 @@
 
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 
+#include "metrics/metrics.hpp"
+
 namespace iroha {
   // ------------------------------| private API |------------------------------
 
@@ -28,7 +30,10 @@ namespace iroha {
       : MstStorage(log),
         completer_(completer),
         own_state_(MstState::empty(mst_state_logger, completer_)),
-        mst_state_logger_(std::move(mst_state_logger)) {}
+        mst_state_logger_(std::move(mst_state_logger)),
+        pending_batches_(metrics::registry().gauge(
+            "iroha_mst_pending_batches",
+            "Multisignature batches waiting for signatures")) {}
 
   std::shared_ptr<MstStorageStateImpl> MstStorageStateImpl::create(
       CompleterType const &completer,
@@ -52,6 +57,8 @@ namespace iroha {
               p.second.eraseByTransactionHash(hash);
             }
             storage->own_state_.eraseByTransactionHash(hash);
+            storage->pending_batches_.set(
+                storage->own_state_.batchesQuantity());
           } else {
             subscription.unsubscribe();
           }
@@ -66,12 +73,16 @@ namespace iroha {
       -> decltype(apply(target_peer_key, new_state)) {
     auto target_state_iter = getState(target_peer_key);
     target_state_iter->second += new_state;
-    return own_state_ += new_state;
+    auto result = own_state_ += new_state;
+    pending_batches_.set(own_state_.batchesQuantity());
+    return result;
   }
 
   auto MstStorageStateImpl::updateOwnStateImpl(const DataType &tx)
       -> decltype(updateOwnState(tx)) {
-    return own_state_ += tx;
+    auto result = own_state_ += tx;
+    pending_batches_.set(own_state_.batchesQuantity());
+    return result;
   }
 
   auto MstStorageStateImpl::extractExpiredTransactionsImpl(
@@ -80,7 +91,9 @@ namespace iroha {
     for (auto &peer_and_state : peer_states_) {
       peer_and_state.second.eraseExpired(current_time);
     }
-    return own_state_.extractExpired(current_time);
+    auto expired = own_state_.extractExpired(current_time);
+    pending_batches_.set(own_state_.batchesQuantity());
+    return expired;
   }
 
   auto MstStorageStateImpl::getDiffStateImpl(
@@ -15,6 +15,10 @@
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 
 namespace iroha {
+  namespace metrics {
+    class Gauge;
+  }
+
   class MstStorageStateImpl : public MstStorage {
    private:
     struct private_tag {};
@@ -101,6 +105,9 @@ namespace iroha {
 
     logger::LoggerPtr mst_state_logger_;  ///< Logger for created MstState
                                           ///< objects.
+
+    /// Number of own batches, which wait for signatures
+    metrics::Gauge &pending_batches_;
   };
 }  // namespace iroha
 
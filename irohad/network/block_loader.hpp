@@ -32,6 +32,23 @@ namespace iroha {
                      shared_model::interface::types::PublicKeyHexStringView
                          peer_pubkey) = 0;
 
+      /**
+       * Retrieve a bounded range of blocks from given peer
+       * @param height - height of the block preceding the range
+       * @param end_height - height of the last block of the range
+       * @param peer_pubkey - peer for requesting blocks
+       * @return observable of blocks from height + 1 to end_height, which
+       * completes earlier if the peer does not have all of them
+       */
+      virtual iroha::expected::Result<
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>,
+          std::string>
+      retrieveBlocks(const shared_model::interface::types::HeightType height,
+                     const shared_model::interface::types::HeightType
+                         end_height,
+                     shared_model::interface::types::PublicKeyHexStringView
+                         peer_pubkey) = 0;
+
       /**
        * Retrieve block by its block_height from given peer
        * @param peer_pubkey - peer for requesting blocks
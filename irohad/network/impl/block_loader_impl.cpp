@@ -39,21 +39,38 @@ Result<rxcpp::observable<std::shared_ptr<Block>>, std::string>
 BlockLoaderImpl::retrieveBlocks(
     const shared_model::interface::types::HeightType height,
     types::PublicKeyHexStringView peer_pubkey) {
+  // zero end height requests all blocks up to the top one
+  return retrieveBlocks(height, 0, peer_pubkey);
+}
+
+Result<rxcpp::observable<std::shared_ptr<Block>>, std::string>
+BlockLoaderImpl::retrieveBlocks(
+    const shared_model::interface::types::HeightType height,
+    const shared_model::interface::types::HeightType end_height,
+    types::PublicKeyHexStringView peer_pubkey) {
   return findPeer(peer_pubkey) | [&](const auto &peer) {
     return client_factory_->createClient(*peer) | [&](auto client) {
       std::shared_ptr<typename decltype(client)::element_type> shared_client(
           std::move(client));
       return rxcpp::observable<std::shared_ptr<Block>>(
           rxcpp::observable<>::create<std::shared_ptr<Block>>(
-              [height, shared_client, block_factory = block_factory_](
-                  auto subscriber) {
-                grpc::ClientContext context;
-                context.set_deadline(std::chrono::system_clock::now() + std::chrono::minutes(1ull));
+              [height,
+               end_height,
+               shared_client,
+               block_factory = block_factory_](auto subscriber) {
+                auto context = std::make_shared<grpc::ClientContext>();
+                context->set_deadline(std::chrono::system_clock::now()
+                                      + std::chrono::minutes(1ull));
+                // unsubscription from another thread interrupts a blocked read
+                auto cancellation = subscriber.get_subscription().add(
+                    [context] { context->TryCancel(); });
 
                 proto::BlockRequest request;
                 request.set_height(height
                                    + 1);  // request next block to our top
-                auto reader = shared_client->retrieveBlocks(&context, request);
+                request.set_end_height(end_height);
+                auto reader =
+                    shared_client->retrieveBlocks(context.get(), request);
                 protocol::Block block;
                 while (subscriber.is_subscribed() and reader->Read(&block)) {
                   block_factory->createBlock(std::move(block))
@@ -62,7 +79,7 @@ BlockLoaderImpl::retrieveBlocks(
                             subscriber.on_next(std::move(result.value));
                           },
                           [&](const auto &error) {
-                            context.TryCancel();
+                            context->TryCancel();
                             reader->Finish();
                             subscriber.on_error(std::make_exception_ptr(
                                 std::runtime_error(fmt::format(
@@ -71,6 +88,7 @@ BlockLoaderImpl::retrieveBlocks(
                           });
                 }
                 reader->Finish();
+                subscriber.get_subscription().remove(cancellation);
                 subscriber.on_completed();
               }));
     };
@@ -40,6 +40,15 @@ namespace iroha {
                      shared_model::interface::types::PublicKeyHexStringView
                          peer_pubkey) override;
 
+      iroha::expected::Result<
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>,
+          std::string>
+      retrieveBlocks(const shared_model::interface::types::HeightType height,
+                     const shared_model::interface::types::HeightType
+                         end_height,
+                     shared_model::interface::types::PublicKeyHexStringView
+                         peer_pubkey) override;
+
       iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
                               std::string>
       retrieveBlock(
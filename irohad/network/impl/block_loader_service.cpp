@@ -5,6 +5,8 @@
 
 #include "network/impl/block_loader_service.hpp"
 
+#include <algorithm>
+
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
 #include "logger/logger.hpp"
@@ -52,6 +54,9 @@ grpc::Status BlockLoaderService::retrieveBlocks(
   }
 
   auto top_height = (*block_query)->getTopBlockHeight();
+  if (request->end_height() != 0) {
+    top_height = std::min(top_height, request->end_height());
+  }
   for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
     auto block_result = (*block_query)->getBlock(i);
 
@@ -155,14 +155,18 @@ std::shared_ptr<const shared_model::interface::Proposal>
 OnDemandOrderingGate::removeReplaysAndDuplicates(
     std::shared_ptr<const shared_model::interface::Proposal> proposal) const {
   std::vector<bool> proposal_txs_validation_results;
-  auto tx_is_not_processed = [this](const auto &tx) {
-    auto tx_result = tx_cache_->check(tx.hash());
-    if (not tx_result) {
+  std::vector<shared_model::crypto::Hash> proposal_hashes;
+  for (const auto &tx : proposal->transactions()) {
+    proposal_hashes.push_back(tx.hash());
+  }
+  auto tx_results = tx_cache_->check(proposal_hashes);
+  auto tx_is_not_processed = [&tx_results](size_t tx_index) {
+    if (not tx_results) {
       // TODO andrei 30.11.18 IR-51 Handle database error
       return false;
     }
     // TODO nickaleks 21.11.18: IR-1887 log replayed transactions
-    return !ametsuchi::isAlreadyProcessed(*tx_result);
+    return !ametsuchi::isAlreadyProcessed(tx_results->at(tx_index));
   };
 
   std::unordered_set<std::string> hashes;
@@ -181,11 +185,14 @@ OnDemandOrderingGate::removeReplaysAndDuplicates(
 
   bool has_invalid_txs = false;
   auto batches = batch_parser.parseBatches(proposal->transactions());
+  size_t tx_index = 0;
   for (auto &batch : batches) {
-    bool txs_are_valid =
-        std::all_of(batch.begin(), batch.end(), [&](const auto &tx) {
-          return tx_is_not_processed(tx) and tx_is_unique(tx);
-        });
+    bool txs_are_valid = true;
+    for (const auto &tx : batch) {
+      txs_are_valid = txs_are_valid and tx_is_not_processed(tx_index)
+          and tx_is_unique(tx);
+      ++tx_index;
+    }
     proposal_txs_validation_results.insert(
         proposal_txs_validation_results.end(), batch.size(), txs_are_valid);
     has_invalid_txs |= not txs_are_valid;
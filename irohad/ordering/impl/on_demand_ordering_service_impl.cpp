@@ -5,11 +5,13 @@
 
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
-#include <unordered_set>
+#include <algorithm>
+#include <iterator>
 
 #include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indirected.hpp>
+#include <boost/range/adaptor/map.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/size.hpp>
@@ -21,10 +23,14 @@
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/transaction_stages.hpp"
+#include "ordering/impl/proposal_packing_policies.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 using TransactionBatchType = transport::OdOsNotification::TransactionBatchType;
+using shared_model::crypto::HashKey;
 
 OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     size_t transaction_limit,
@@ -33,13 +39,30 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
     logger::LoggerPtr log,
-    size_t number_of_proposals)
+    size_t number_of_proposals,
+    std::shared_ptr<ProposalPackingPolicy> packing_policy)
     : transaction_limit_(transaction_limit),
       number_of_proposals_(number_of_proposals),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
       proposal_creation_strategy_(std::move(proposal_creation_strategy)),
-      log_(std::move(log)) {}
+      packing_policy_(packing_policy
+                          ? std::move(packing_policy)
+                          : std::make_shared<FifoProposalPackingPolicy>()),
+      log_(std::move(log)),
+      pending_batches_(metrics::registry().gauge(
+          "iroha_ordering_pending_batches",
+          "Batches waiting in the ordering service for a proposal")),
+      proposal_transactions_(metrics::registry().histogram(
+          "iroha_ordering_proposal_transactions",
+          "Number of transactions in proposals of the ordering service")),
+      packed_batch_max_age_(metrics::registry().gauge(
+          "iroha_ordering_packed_batch_max_age_milliseconds",
+          "Longest wait of a batch packed into the last proposal")),
+      oldest_batch_age_(metrics::registry().gauge(
+          "iroha_ordering_oldest_batch_age_milliseconds",
+          "Wait of the oldest batch left in the cache after the last "
+          "proposal")) {}
 
 // -------------------------| OnDemandOrderingService |-------------------------
 
@@ -79,27 +102,77 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
   return result;
 }
 
+std::vector<bool> OnDemandOrderingServiceImpl::hasBatches(
+    const std::vector<shared_model::crypto::Hash> &hashes) {
+  std::vector<bool> result;
+  result.reserve(hashes.size());
+  std::shared_lock<std::shared_timed_mutex> lock(batches_cache_cs_);
+  for (const auto &hash : hashes) {
+    auto key = HashKey::fromHash(hash);
+    result.push_back(key and batches_by_tx_hash_.count(*key) > 0);
+  }
+  return result;
+}
+
 // ---------------------------------| Private |---------------------------------
 void OnDemandOrderingServiceImpl::insertBatchToCache(
     std::shared_ptr<shared_model::interface::TransactionBatch> const &batch) {
-  std::lock_guard<std::shared_timed_mutex> lock(batches_cache_cs_);
-  batches_cache_.insert(batch);
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(batches_cache_cs_);
+    if (not batches_cache_.insert(batch).second) {
+      return;
+    }
+    for (const auto &tx : batch->transactions()) {
+      batches_by_tx_hash_.emplace(tx->hash(), batch);
+    }
+    batches_by_arrival_.emplace(next_arrival_,
+                                CachedBatch{batch, iroha::time::now()});
+    arrival_by_batch_.emplace(batch, next_arrival_++);
+    pending_batches_.set(batches_by_arrival_.size());
+  }
+
+  for (const auto &tx : batch->transactions()) {
+    metrics::transactionStages().finished(
+        tx->hash(), metrics::TransactionStages::kOrdering);
+  }
 }
 
 void OnDemandOrderingServiceImpl::removeFromBatchesCache(
     const OnDemandOrderingService::HashesSetType &hashes) {
   std::lock_guard<std::shared_timed_mutex> lock(batches_cache_cs_);
-  for (auto it = batches_cache_.begin(); it != batches_cache_.end();) {
-    if (std::any_of(it->get()->transactions().begin(),
-                    it->get()->transactions().end(),
-                    [&hashes](const auto &tx) {
-                      return hashes.find(tx->hash()) != hashes.end();
-                    })) {
-      it = batches_cache_.erase(it);
-    } else {
-      ++it;
+  for (const auto &hash : hashes) {
+    auto key = HashKey::fromHash(hash);
+    if (not key) {
+      continue;
+    }
+    auto batches = batches_by_tx_hash_.equal_range(*key);
+    if (batches.first == batches.second) {
+      continue;
+    }
+    // the index entries of the batch are erased below, copy it beforehand
+    std::vector<TransactionBatchType> committed_batches;
+    std::transform(batches.first,
+                   batches.second,
+                   std::back_inserter(committed_batches),
+                   [](const auto &entry) { return entry.second; });
+
+    for (const auto &batch : committed_batches) {
+      batches_cache_.erase(batch);
+      auto arrival = arrival_by_batch_.find(batch);
+      if (arrival != arrival_by_batch_.end()) {
+        batches_by_arrival_.erase(arrival->second);
+        arrival_by_batch_.erase(arrival);
+      }
+      for (const auto &tx : batch->transactions()) {
+        auto entries = batches_by_tx_hash_.equal_range(HashKey(tx->hash()));
+        for (auto it = entries.first; it != entries.second;) {
+          it = it->second == batch ? batches_by_tx_hash_.erase(it)
+                                   : std::next(it);
+        }
+      }
     }
   }
+  pending_batches_.set(batches_by_arrival_.size());
 }
 
 bool OnDemandOrderingServiceImpl::isEmptyBatchesCache() const {
@@ -121,15 +194,57 @@ OnDemandOrderingServiceImpl::getTransactionsFromBatchesCache(
   collection.reserve(requested_tx_amount);
 
   std::shared_lock<std::shared_timed_mutex> lock(batches_cache_cs_);
-  auto it = batches_cache_.begin();
-  for (; it != batches_cache_.end()
-       and collection.size() + boost::size((*it)->transactions())
-           <= requested_tx_amount;
-       ++it) {
+  // the policy reads the cached batches lazily, oldest first
+  auto packed = packing_policy_->pack(
+      batches_by_arrival_ | boost::adaptors::map_values
+          | boost::adaptors::transformed(
+                [](const CachedBatch &cached) -> const TransactionBatchType & {
+                  return cached.batch;
+                }),
+      requested_tx_amount);
+  for (const auto &batch : packed) {
     collection.insert(std::end(collection),
-                      std::begin((*it)->transactions()),
-                      std::end((*it)->transactions()));
+                      std::begin(batch->transactions()),
+                      std::end(batch->transactions()));
+  }
+
+  // queue age: how long the packed batches and the batches left behind have
+  // been waiting for a proposal
+  auto now = iroha::time::now();
+  auto age = [now](const auto &arrival) {
+    return now > arrival->second.arrival_time
+        ? now - arrival->second.arrival_time
+        : 0;
+  };
+  shared_model::interface::types::TimestampType max_packed_age = 0;
+  std::vector<uint64_t> packed_arrivals;
+  packed_arrivals.reserve(packed.size());
+  for (const auto &batch : packed) {
+    auto arrival = batches_by_arrival_.find(arrival_by_batch_.at(batch));
+    max_packed_age = std::max(max_packed_age, age(arrival));
+    packed_arrivals.push_back(arrival->first);
+  }
+  // the oldest batch left is among the first packed.size() + 1 batches
+  std::sort(packed_arrivals.begin(), packed_arrivals.end());
+  auto oldest_left = batches_by_arrival_.begin();
+  for (auto arrival : packed_arrivals) {
+    if (oldest_left == batches_by_arrival_.end()
+        or oldest_left->first != arrival) {
+      break;
+    }
+    ++oldest_left;
   }
+  auto oldest_left_age =
+      oldest_left == batches_by_arrival_.end() ? 0 : age(oldest_left);
+  packed_batch_max_age_.set(max_packed_age);
+  oldest_batch_age_.set(oldest_left_age);
+  log_->debug(
+      "Packed {} of {} cached batches, max age of packed batches {} ms, "
+      "age of the oldest batch left {} ms",
+      packed.size(),
+      batches_by_arrival_.size(),
+      max_packed_age,
+      oldest_left_age);
 
   return collection;
 }
@@ -179,6 +294,7 @@ OnDemandOrderingServiceImpl::tryCreateProposal(
     log_->debug("No transactions to create a proposal for {}", round);
   }
 
+  proposal_transactions_.observe(txs.size());
   assert(proposal_map_.find(round) == proposal_map_.end());
   proposal_map_.emplace(round, proposal);
   return proposal;
@@ -13,8 +13,10 @@
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 
 #include <tbb/concurrent_unordered_set.h>
+#include "cryptography/hash_key.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
@@ -22,11 +24,16 @@
 #include "multi_sig_transactions/state/mst_state.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/ordering_service_proposal_creation_strategy.hpp"
+#include "ordering/proposal_packing_policy.hpp"
 
 namespace iroha {
   namespace ametsuchi {
     class TxPresenceCache;
   }
+  namespace metrics {
+    class Gauge;
+    class Histogram;
+  }  // namespace metrics
   namespace ordering {
     namespace detail {
       using BatchSetType = tbb::concurrent_unordered_set<
@@ -42,6 +49,9 @@ namespace iroha {
 
     class OnDemandOrderingServiceImpl : public OnDemandOrderingService {
      public:
+      /// number of proposals stored by the ordering service by default
+      static constexpr size_t kDefaultNumberOfProposals = 3;
+
       /**
        * Create on_demand ordering service with following options:
        * @param transaction_limit - number of maximum transactions in one
@@ -52,6 +62,8 @@ namespace iroha {
        * @param number_of_proposals - number of stored proposals, older will be
        * removed. Default value is 3
        * @param creation_strategy - provides a strategy for creating proposals
+       * @param packing_policy - selects cached batches for proposals, batches
+       * are taken in the order of arrival if not set
        */
       OnDemandOrderingServiceImpl(
           size_t transaction_limit,
@@ -60,7 +72,8 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
           logger::LoggerPtr log,
-          size_t number_of_proposals = 3);
+          size_t number_of_proposals = kDefaultNumberOfProposals,
+          std::shared_ptr<ProposalPackingPolicy> packing_policy = nullptr);
 
       // --------------------- | OnDemandOrderingService |_---------------------
 
@@ -77,6 +90,9 @@ namespace iroha {
       boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
           consensus::Round round) override;
 
+      std::vector<bool> hasBatches(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
+
      private:
       /**
        * Packs new proposals and creates new rounds
@@ -150,6 +166,29 @@ namespace iroha {
       mutable std::shared_timed_mutex batches_cache_cs_;
       BatchesSetType batches_cache_;
 
+      /**
+       * Cached batches by hashes of their transactions, lets committed
+       * transactions be removed without a walk over the whole cache. Guarded
+       * by batches_cache_cs_
+       */
+      std::unordered_multimap<shared_model::crypto::HashKey,
+                              TransactionBatchType,
+                              shared_model::crypto::HashKey::Hasher>
+          batches_by_tx_hash_;
+
+      struct CachedBatch {
+        TransactionBatchType batch;
+        shared_model::interface::types::TimestampType arrival_time;
+      };
+
+      /**
+       * Cached batches by the order of their arrival, and the order of each
+       * cached batch. Guarded by batches_cache_cs_
+       */
+      std::map<uint64_t, CachedBatch> batches_by_arrival_;
+      std::unordered_map<TransactionBatchType, uint64_t> arrival_by_batch_;
+      uint64_t next_arrival_ = 0;
+
       std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
           proposal_factory_;
 
@@ -163,6 +202,11 @@ namespace iroha {
        */
       std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy_;
 
+      /**
+       * Policy of selecting cached batches for proposals
+       */
+      std::shared_ptr<ProposalPackingPolicy> packing_policy_;
+
       /**
        * Logger instance
        */
@@ -172,6 +216,11 @@ namespace iroha {
        * Current round
        */
       consensus::Round current_round_;
+
+      metrics::Gauge &pending_batches_;
+      metrics::Histogram &proposal_transactions_;
+      metrics::Gauge &packed_batch_max_age_;
+      metrics::Gauge &oldest_batch_age_;
     };
   }  // namespace ordering
 }  // namespace iroha
@@ -20,6 +20,7 @@ OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::shared_ptr<proto::OnDemandOrdering::StubInterface> stub,
     std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
         async_call,
+    std::shared_ptr<AnnounceCallType> announce_call,
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<TimepointType()> time_provider,
     std::chrono::milliseconds proposal_request_timeout,
@@ -27,24 +28,67 @@ OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     : log_(std::move(log)),
       stub_(std::move(stub)),
       async_call_(std::move(async_call)),
+      announce_call_(std::move(announce_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(std::move(time_provider)),
       proposal_request_timeout_(proposal_request_timeout) {}
 
 void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
+  proto::BatchesAnnouncement announcement;
+  for (auto &batch : batches) {
+    announcement.add_batch_hashes(shared_model::crypto::toBinaryString(
+        batch->transactions().front()->hash()));
+  }
+
+  log_->debug("Announcing {} batches", batches.size());
+
+  // the client might be destroyed before the response arrives
+  announce_call_->Call(
+      [&](auto context, auto cq) {
+        return stub_->AsyncAnnounceBatches(context, announcement, cq);
+      },
+      [batches = std::move(batches),
+       stub = stub_,
+       async_call = async_call_,
+       log = log_](auto &status, auto &response) {
+        if (not status.ok()) {
+          // the peer might not support announcements
+          sendBatches(batches, *stub, *async_call, log);
+          return;
+        }
+        CollectionType missing_batches;
+        for (auto position : response.missing_batches()) {
+          if (position < batches.size()) {
+            missing_batches.push_back(batches[position]);
+          }
+        }
+        log->debug("{} of {} announced batches are missing",
+                   missing_batches.size(),
+                   batches.size());
+        if (not missing_batches.empty()) {
+          sendBatches(missing_batches, *stub, *async_call, log);
+        }
+      });
+}
+
+void OnDemandOsClientGrpc::sendBatches(
+    const CollectionType &batches,
+    proto::OnDemandOrdering::StubInterface &stub,
+    network::AsyncGrpcClient<google::protobuf::Empty> &async_call,
+    const logger::LoggerPtr &log) {
   proto::BatchesRequest request;
   for (auto &batch : batches) {
     for (auto &transaction : batch->transactions()) {
-      *request.add_transactions() = std::move(
+      *request.add_transactions() =
           static_cast<shared_model::proto::Transaction *>(transaction.get())
-              ->getTransport());
+              ->getTransport();
     }
   }
 
-  log_->debug("Propagating: '{}'", request.DebugString());
+  log->debug("Propagating: '{}'", request.DebugString());
 
-  async_call_->Call([&](auto context, auto cq) {
-    return stub_->AsyncSendBatches(context, request, cq);
+  async_call.Call([&](auto context, auto cq) {
+    return stub.AsyncSendBatches(context, request, cq);
   });
 }
 
@@ -87,6 +131,8 @@ OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
     logger::LoggerPtr client_log,
     std::unique_ptr<ClientFactory> client_factory)
     : async_call_(std::move(async_call)),
+      announce_call_(
+          std::make_shared<OnDemandOsClientGrpc::AnnounceCallType>(client_log)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(time_provider),
       proposal_request_timeout_(proposal_request_timeout),
@@ -99,6 +145,7 @@ OnDemandOsClientGrpcFactory::create(const shared_model::interface::Peer &to) {
              [&](auto &&client) -> std::unique_ptr<OdOsNotification> {
     return std::make_unique<OnDemandOsClientGrpc>(std::move(client),
                                                   async_call_,
+                                                  announce_call_,
                                                   proposal_factory_,
                                                   time_provider_,
                                                   proposal_request_timeout_,
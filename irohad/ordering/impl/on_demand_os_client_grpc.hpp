@@ -33,6 +33,8 @@ namespace iroha {
                 iroha::protocol::Proposal>;
         using TimepointType = std::chrono::system_clock::time_point;
         using TimeoutType = std::chrono::milliseconds;
+        using AnnounceCallType =
+            network::AsyncGrpcClient<proto::BatchesAnnouncementResponse>;
 
         /**
          * Constructor is left public because testing required passing a mock
@@ -42,21 +44,34 @@ namespace iroha {
             std::shared_ptr<proto::OnDemandOrdering::StubInterface> stub,
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
+            std::shared_ptr<AnnounceCallType> announce_call,
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<TimepointType()> time_provider,
             std::chrono::milliseconds proposal_request_timeout,
             logger::LoggerPtr log);
 
+        /**
+         * Announces hashes of the batches to the peer, and sends the bodies
+         * of the batches which the peer reports as missing. All batches are
+         * sent if the announcement fails
+         */
         void onBatches(CollectionType batches) override;
 
         boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
             consensus::Round round) override;
 
        private:
+        static void sendBatches(
+            const CollectionType &batches,
+            proto::OnDemandOrdering::StubInterface &stub,
+            network::AsyncGrpcClient<google::protobuf::Empty> &async_call,
+            const logger::LoggerPtr &log);
+
         logger::LoggerPtr log_;
         std::shared_ptr<proto::OnDemandOrdering::StubInterface> stub_;
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
+        std::shared_ptr<AnnounceCallType> announce_call_;
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
@@ -83,6 +98,7 @@ namespace iroha {
        private:
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
+        std::shared_ptr<OnDemandOsClientGrpc::AnnounceCallType> announce_call_;
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<OnDemandOsClientGrpc::TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
@@ -12,6 +12,7 @@
 #include "backend/protobuf/deserialize_repeated_transactions.hpp"
 #include "backend/protobuf/proposal.hpp"
 #include "common/bind.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
 #include "interfaces/iroha_internal/parse_and_create_batches.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
@@ -57,6 +58,49 @@ grpc::Status OnDemandOsServerGrpc::SendBatches(
   return ::grpc::Status::OK;
 }
 
+grpc::Status OnDemandOsServerGrpc::AnnounceBatches(
+    ::grpc::ServerContext *context,
+    const proto::BatchesAnnouncement *request,
+    proto::BatchesAnnouncementResponse *response) {
+  if (request->batch_hashes_size() > kMaxAnnouncedBatches) {
+    log_->warn("Rejected announcement of {} batches, at most {} are allowed",
+               request->batch_hashes_size(),
+               kMaxAnnouncedBatches);
+    return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT,
+                          "Too many announced batches");
+  }
+
+  // hashes of a wrong size cannot be known, so they are reported missing
+  // without a lookup
+  std::vector<shared_model::crypto::Hash> hashes;
+  std::vector<int> positions;
+  hashes.reserve(request->batch_hashes_size());
+  positions.reserve(request->batch_hashes_size());
+  for (int i = 0; i < request->batch_hashes_size(); ++i) {
+    const auto &hash = request->batch_hashes(i);
+    if (hash.size() == shared_model::crypto::Sha3_256::kHashLength) {
+      hashes.emplace_back(hash);
+      positions.push_back(i);
+    }
+  }
+
+  std::vector<bool> missing(request->batch_hashes_size(), true);
+  auto known = ordering_service_->hasBatches(hashes);
+  for (size_t i = 0; i < known.size() and i < positions.size(); ++i) {
+    missing[positions[i]] = not known[i];
+  }
+  for (size_t i = 0; i < missing.size(); ++i) {
+    if (missing[i]) {
+      response->add_missing_batches(i);
+    }
+  }
+  log_->debug("Announced {} batches, {} missing",
+              request->batch_hashes_size(),
+              response->missing_batches_size());
+
+  return ::grpc::Status::OK;
+}
+
 grpc::Status OnDemandOsServerGrpc::RequestProposal(
     ::grpc::ServerContext *context,
     const proto::ProposalRequest *request,
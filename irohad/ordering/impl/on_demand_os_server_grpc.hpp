@@ -23,6 +23,9 @@ namespace iroha {
        */
       class OnDemandOsServerGrpc : public proto::OnDemandOrdering::Service {
        public:
+        /// Maximal number of batch hashes accepted in one announcement
+        static constexpr int kMaxAnnouncedBatches = 10000;
+
         using TransportFactoryType =
             shared_model::interface::AbstractTransportFactory<
                 shared_model::interface::Transaction,
@@ -41,6 +44,11 @@ namespace iroha {
                                  const proto::BatchesRequest *request,
                                  ::google::protobuf::Empty *response) override;
 
+        grpc::Status AnnounceBatches(
+            ::grpc::ServerContext *context,
+            const proto::BatchesAnnouncement *request,
+            proto::BatchesAnnouncementResponse *response) override;
+
         grpc::Status RequestProposal(
             ::grpc::ServerContext *context,
             const proto::ProposalRequest *request,
@@ -0,0 +1,155 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_packing_policies.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+namespace {
+  using BatchesCollectionType = ProposalPackingPolicy::BatchesCollectionType;
+  using BatchesRangeType = ProposalPackingPolicy::BatchesRangeType;
+
+  /// @return maximum number of batches to read for a proposal
+  size_t maxBatchesToRead(size_t transaction_limit) {
+    return ProposalPackingPolicy::kBatchesPerTransaction * transaction_limit;
+  }
+
+  /// @return the oldest batches, which are considered for a proposal
+  BatchesCollectionType readBatches(const BatchesRangeType &batches,
+                                    size_t transaction_limit) {
+    BatchesCollectionType result;
+    const auto max_batches = maxBatchesToRead(transaction_limit);
+    for (auto it = boost::begin(batches);
+         it != boost::end(batches) and result.size() < max_batches;
+         ++it) {
+      result.push_back(*it);
+    }
+    return result;
+  }
+}  // namespace
+
+BatchesCollectionType FifoProposalPackingPolicy::pack(
+    const BatchesRangeType &batches, size_t transaction_limit) const {
+  BatchesCollectionType result;
+  size_t size = 0;
+  size_t read = 0;
+  const auto max_batches = maxBatchesToRead(transaction_limit);
+  for (auto it = boost::begin(batches); it != boost::end(batches)
+       and size < transaction_limit and read < max_batches;
+       ++it, ++read) {
+    auto batch_size = (*it)->transactions().size();
+    if (size + batch_size <= transaction_limit) {
+      result.push_back(*it);
+      size += batch_size;
+    }
+  }
+  return result;
+}
+
+BatchesCollectionType RoundRobinProposalPackingPolicy::pack(
+    const BatchesRangeType &batches, size_t transaction_limit) const {
+  // batches of each creator in the order of arrival
+  std::vector<BatchesCollectionType> queues;
+  std::unordered_map<std::string, size_t> queue_by_creator;
+  for (const auto &batch : readBatches(batches, transaction_limit)) {
+    auto queue = queue_by_creator.emplace(
+        batch->transactions().front()->creatorAccountId(), queues.size());
+    if (queue.second) {
+      queues.emplace_back();
+    }
+    queues[queue.first->second].push_back(batch);
+  }
+
+  BatchesCollectionType result;
+  size_t size = 0;
+  std::vector<size_t> positions(queues.size(), 0);
+  bool taken = true;
+  while (taken and size < transaction_limit) {
+    taken = false;
+    for (size_t i = 0; i < queues.size(); ++i) {
+      if (positions[i] == queues[i].size()) {
+        continue;
+      }
+      const auto &batch = queues[i][positions[i]];
+      auto batch_size = batch->transactions().size();
+      if (size + batch_size > transaction_limit) {
+        // later batches of the creator must not overtake this one
+        positions[i] = queues[i].size();
+        continue;
+      }
+      result.push_back(batch);
+      size += batch_size;
+      ++positions[i];
+      taken = true;
+    }
+  }
+  return result;
+}
+
+BatchesCollectionType BestFitProposalPackingPolicy::pack(
+    const BatchesRangeType &range, size_t transaction_limit) const {
+  const auto batches = readBatches(range, transaction_limit);
+  std::vector<size_t> sizes;
+  sizes.reserve(batches.size());
+  for (const auto &batch : batches) {
+    sizes.push_back(batch->transactions().size());
+  }
+
+  std::vector<bool> taken(batches.size(), false);
+  size_t size = 0;
+  auto take = [&](size_t i) {
+    taken[i] = true;
+    size += sizes[i];
+  };
+
+  auto oldest = std::find_if(sizes.begin(), sizes.end(), [&](size_t s) {
+    return s <= transaction_limit;
+  });
+  if (oldest == sizes.end()) {
+    return {};
+  }
+  take(oldest - sizes.begin());
+
+  std::vector<size_t> order(batches.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return sizes[a] > sizes[b];
+  });
+  for (auto i : order) {
+    if (not taken[i] and size + sizes[i] <= transaction_limit) {
+      take(i);
+    }
+  }
+
+  BatchesCollectionType result;
+  for (size_t i = 0; i < batches.size(); ++i) {
+    if (taken[i]) {
+      result.push_back(batches[i]);
+    }
+  }
+  return result;
+}
+
+std::shared_ptr<ProposalPackingPolicy>
+iroha::ordering::createProposalPackingPolicy(std::string_view name) {
+  if (name == "fifo") {
+    return std::make_shared<FifoProposalPackingPolicy>();
+  }
+  if (name == "round_robin") {
+    return std::make_shared<RoundRobinProposalPackingPolicy>();
+  }
+  if (name == "best_fit") {
+    return std::make_shared<BestFitProposalPackingPolicy>();
+  }
+  return nullptr;
+}
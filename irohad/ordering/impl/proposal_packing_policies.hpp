@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_PACKING_POLICIES_HPP
+#define IROHA_PROPOSAL_PACKING_POLICIES_HPP
+
+#include "ordering/proposal_packing_policy.hpp"
+
+#include <memory>
+#include <string_view>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Takes batches in the order of arrival until the proposal is full. A
+     * batch which does not fit is skipped, so it does not block smaller
+     * batches behind it; the oldest batch always gets into the proposal, so
+     * no batch starves
+     */
+    class FifoProposalPackingPolicy : public ProposalPackingPolicy {
+     public:
+      BatchesCollectionType pack(const BatchesRangeType &batches,
+                                 size_t transaction_limit) const override;
+    };
+
+    /**
+     * Takes batches of different creators in turns, one batch of each creator
+     * per turn, with creators ordered by their oldest batch. Batches of one
+     * creator are taken in the order of arrival, so a creator which sends
+     * many transactions gets an equal share of a proposal under contention.
+     * Creators share the oldest batches, which are read up to
+     * kBatchesPerTransaction per transaction of the proposal
+     */
+    class RoundRobinProposalPackingPolicy : public ProposalPackingPolicy {
+     public:
+      BatchesCollectionType pack(const BatchesRangeType &batches,
+                                 size_t transaction_limit) const override;
+    };
+
+    /**
+     * Takes the oldest batch and fills the rest of the proposal with the
+     * largest batches which fit, older ones first among batches of the same
+     * size, so proposals stay full when batch sizes vary. The batches are
+     * chosen among the oldest ones, which are read up to
+     * kBatchesPerTransaction per transaction of the proposal
+     */
+    class BestFitProposalPackingPolicy : public ProposalPackingPolicy {
+     public:
+      BatchesCollectionType pack(const BatchesRangeType &batches,
+                                 size_t transaction_limit) const override;
+    };
+
+    /**
+     * Create packing policy by its name in configuration
+     * @param name - one of "fifo", "round_robin" and "best_fit"
+     * @return the policy or nullptr if the name is unknown
+     */
+    std::shared_ptr<ProposalPackingPolicy> createProposalPackingPolicy(
+        std::string_view name);
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_PACKING_POLICIES_HPP
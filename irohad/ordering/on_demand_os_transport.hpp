@@ -79,6 +79,17 @@ namespace iroha {
         virtual boost::optional<std::shared_ptr<const ProposalType>>
         onRequestProposal(consensus::Round round) = 0;
 
+        /**
+         * Check which batches are already known, so that only unknown ones
+         * are transferred. Receivers which do not keep batches know none
+         * @param hashes - hashes of the first transactions of the batches
+         * @return presence flags in the order of given hashes
+         */
+        virtual std::vector<bool> hasBatches(
+            const std::vector<shared_model::crypto::Hash> &hashes) {
+          return std::vector<bool>(hashes.size(), false);
+        }
+
         virtual ~OdOsNotification() = default;
       };
 
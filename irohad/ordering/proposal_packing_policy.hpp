@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_PACKING_POLICY_HPP
+#define IROHA_PROPOSAL_PACKING_POLICY_HPP
+
+#include <vector>
+
+#include <boost/range/any_range.hpp>
+#include "ordering/on_demand_os_transport.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Class provides a policy of selecting cached batches for a proposal
+     */
+    class ProposalPackingPolicy {
+     public:
+      using TransactionBatchType =
+          transport::OdOsNotification::TransactionBatchType;
+      using BatchesCollectionType = std::vector<TransactionBatchType>;
+
+      /// Batches which are read one by one, only as far as a policy needs
+      using BatchesRangeType =
+          boost::any_range<TransactionBatchType,
+                           boost::single_pass_traversal_tag,
+                           const TransactionBatchType &,
+                           std::ptrdiff_t>;
+
+      /**
+       * Maximum number of batches a policy reads per transaction of a
+       * proposal, so that packing does not depend on the size of the cache
+       */
+      static constexpr size_t kBatchesPerTransaction = 4;
+
+      /**
+       * Select batches for a proposal
+       * @param batches - cached batches ordered by their arrival, oldest first
+       * @param transaction_limit - maximum number of transactions in the
+       * proposal
+       * @return selected batches in the order of their transactions in the
+       * proposal
+       */
+      virtual BatchesCollectionType pack(const BatchesRangeType &batches,
+                                         size_t transaction_limit) const = 0;
+
+      virtual ~ProposalPackingPolicy() = default;
+    };
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_PACKING_POLICY_HPP
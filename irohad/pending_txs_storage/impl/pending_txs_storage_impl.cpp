@@ -191,7 +191,8 @@ namespace iroha {
               std::prev(account_batches.batches.end());
           account_batches.index.emplace(first_tx_hash, inserted_batch_iterator);
           for (auto &tx : batch->transactions()) {
-            account_batches.txs_to_batches.insert({tx->hash(), batch});
+            account_batches.txs_to_batches.insert(
+                {shared_model::crypto::HashKey(tx->hash()), batch});
           }
         } else {
           // updating batch
@@ -286,10 +287,14 @@ namespace iroha {
   }
 
   void PendingTransactionStorageImpl::removeTransaction(HashType const &hash) {
+    auto key = shared_model::crypto::HashKey::fromHash(hash);
+    if (not key) {
+      return;
+    }
     std::shared_lock<std::shared_timed_mutex> read_lock(mutex_);
     for (auto &p : storage_) {
       auto &txs_index = p.second.txs_to_batches;
-      auto it = txs_index.left.find(hash);
+      auto it = txs_index.left.find(*key);
       if (txs_index.left.end() != it) {
         auto batch = it->second;
         assert(!!batch);
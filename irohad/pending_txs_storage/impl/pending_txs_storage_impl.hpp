@@ -19,6 +19,7 @@
 #include <boost/bimap/unordered_set_of.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "cryptography/hash.hpp"
+#include "cryptography/hash_key.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "multi_sig_transactions/hash.hpp"
 
@@ -112,8 +113,9 @@ namespace iroha {
     struct AccountBatches {
       using BatchPtr = std::shared_ptr<TransactionBatch>;
       using BatchesBimap = boost::bimap<
-          boost::bimaps::unordered_set_of<HashType,
-                                          shared_model::crypto::Hash::Hasher>,
+          boost::bimaps::unordered_set_of<
+              shared_model::crypto::HashKey,
+              shared_model::crypto::HashKey::Hasher>,
           boost::bimaps::unordered_multiset_of<
               BatchPtr,
               iroha::model::PointerBatchHasher,
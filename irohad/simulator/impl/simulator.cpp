@@ -10,7 +10,10 @@
 #include "common/bind.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
+#include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/transaction_stages.hpp"
 
 namespace iroha {
   namespace simulator {
@@ -31,7 +34,14 @@ namespace iroha {
           ametsuchi_factory_(std::move(factory)),
           crypto_signer_(std::move(crypto_signer)),
           block_factory_(std::move(block_factory)),
-          log_(std::move(log)) {
+          log_(std::move(log)),
+          validation_time_(metrics::registry().histogram(
+              "iroha_simulator_validation_microseconds",
+              "Time of stateful validation of a proposal")),
+          block_creation_time_(metrics::registry().histogram(
+              "iroha_simulator_block_creation_microseconds",
+              "Time of creating and signing a block from a verified "
+              "proposal")) {
       ordering_gate->onProposal().subscribe(
           proposal_subscription_, [this](const network::OrderingEvent &event) {
             if (event.proposal) {
@@ -42,6 +52,10 @@ namespace iroha {
                   VerifiedProposalCreatorEvent{validated_proposal_and_errors,
                                                event.round,
                                                event.ledger_state});
+              // the block is created by now, a state which was not prepared
+              // must not keep its locks
+              validated_proposal_.reset();
+              validated_storage_.reset();
             } else {
               notifier_.get_subscriber().on_next(VerifiedProposalCreatorEvent{
                   boost::none, event.round, event.ledger_state});
@@ -84,13 +98,32 @@ namespace iroha {
     Simulator::processProposal(
         const shared_model::interface::Proposal &proposal) {
       log_->info("process proposal: {}", proposal);
+      for (const auto &tx : proposal.transactions()) {
+        metrics::transactionStages().finished(
+            tx.hash(), metrics::TransactionStages::kProposal);
+      }
+
+      // the state of the previous proposal must be released before a new
+      // temporary wsv is created
+      validated_proposal_.reset();
+      validated_storage_.reset();
 
       auto storage = ametsuchi_factory_->createTemporaryWsv(command_executor_);
 
+      auto start = std::chrono::steady_clock::now();
       std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>
           validated_proposal_and_errors =
               validator_->validate(proposal, *storage);
-      ametsuchi_factory_->prepareBlock(std::move(storage));
+      validation_time_.observeSince(start);
+      for (const auto &tx :
+           validated_proposal_and_errors->verified_proposal->transactions()) {
+        metrics::transactionStages().finished(
+            tx.hash(), metrics::TransactionStages::kStatefulValidation);
+      }
+      if (validated_proposal_and_errors->temporary_wsv_is_complete) {
+        validated_proposal_ = validated_proposal_and_errors;
+        validated_storage_ = std::move(storage);
+      }
 
       return validated_proposal_and_errors;
     }
@@ -105,6 +138,7 @@ namespace iroha {
         log_->info("process verified proposal: {}", *proposal);
       else
         log_->info("process verified proposal: no proposal");
+      auto start = std::chrono::steady_clock::now();
       std::vector<shared_model::crypto::Hash> rejected_hashes;
       for (const auto &rejected_tx :
            verified_proposal_and_errors->rejected_transactions) {
@@ -117,7 +151,15 @@ namespace iroha {
                                             proposal->transactions(),
                                             rejected_hashes);
       crypto_signer_->sign(*block);
+      block_creation_time_.observeSince(start);
       log_->info("Created block: {}", *block);
+      if (validated_storage_
+          and validated_proposal_ == verified_proposal_and_errors) {
+        // the state is written in the background while the block is voted
+        // for, committing the block waits for it
+        ametsuchi_factory_->prepareBlock(std::move(validated_storage_), block);
+        validated_proposal_.reset();
+      }
       return block;
     }
 
@@ -12,6 +12,7 @@
 #include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/temporary_factory.hpp"
+#include "ametsuchi/temporary_wsv.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
 #include "interfaces/iroha_internal/unsafe_block_factory.hpp"
 #include "logger/logger_fwd.hpp"
@@ -22,6 +23,9 @@ namespace iroha {
   namespace ametsuchi {
     class CommandExecutor;
   }
+  namespace metrics {
+    class Histogram;
+  }
 
   namespace simulator {
 
@@ -76,7 +80,18 @@ namespace iroha {
       std::unique_ptr<shared_model::interface::UnsafeBlockFactory>
           block_factory_;
 
+      /**
+       * Complete state of the last validated proposal, which is prepared when
+       * the block is created from the proposal
+       */
+      std::shared_ptr<validation::VerifiedProposalAndErrors>
+          validated_proposal_;
+      std::unique_ptr<ametsuchi::TemporaryWsv> validated_storage_;
+
       logger::LoggerPtr log_;
+
+      metrics::Histogram &validation_time_;
+      metrics::Histogram &block_creation_time_;
     };
   }  // namespace simulator
 }  // namespace iroha
@@ -0,0 +1,236 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/parallel_block_loader.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/result.hpp"
+#include "interfaces/common_objects/string_view_types.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+#include "network/block_loader.hpp"
+
+using namespace iroha::synchronizer;
+using shared_model::interface::types::HeightType;
+
+namespace {
+  using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+  using Clock = std::chrono::steady_clock;
+
+  /// State shared by the download threads and the emitting subscriber
+  struct Download {
+    std::mutex mutex;
+    std::condition_variable cv;
+    /// first and last heights of the ranges which nobody downloads
+    std::set<std::pair<HeightType, HeightType>> pending;
+    /// downloaded blocks which are not emitted yet
+    std::map<HeightType, BlockPtr> ready;
+    /// height of the next block to emit
+    HeightType next;
+    /// number of peers which have not failed yet
+    size_t working_peers;
+    bool stopped = false;
+  };
+
+  struct Peer {
+    explicit Peer(std::string public_key)
+        : public_key(std::move(public_key)) {}
+
+    std::string public_key;
+    /// lifetime of the current range download, unsubscribed when it stalls
+    rxcpp::composite_subscription range_lifetime;
+    bool downloading = false;
+    Clock::time_point last_block_time;
+    std::thread thread;
+  };
+
+  /**
+   * Download ranges from the peer until the download is stopped or the peer
+   * fails to provide a range completely. The rest of a failed range is
+   * returned to the pending ones.
+   */
+  void downloadRanges(Download &download,
+                      Peer &peer,
+                      iroha::network::BlockLoader &block_loader,
+                      HeightType window,
+                      const logger::LoggerPtr &log) {
+    std::unique_lock<std::mutex> lock(download.mutex);
+    while (true) {
+      download.cv.wait(lock, [&] {
+        return download.stopped
+            or (not download.pending.empty()
+                and download.pending.begin()->first
+                    <= download.next + window);
+      });
+      if (download.stopped) {
+        return;
+      }
+      const auto range = *download.pending.begin();
+      download.pending.erase(download.pending.begin());
+      peer.downloading = true;
+      peer.last_block_time = Clock::now();
+      peer.range_lifetime = rxcpp::composite_subscription();
+      auto lifetime = peer.range_lifetime;
+      lock.unlock();
+
+      HeightType received = range.first - 1;
+      auto blocks = block_loader.retrieveBlocks(
+          received,
+          range.second,
+          shared_model::interface::types::PublicKeyHexStringView{
+              peer.public_key});
+      if (auto error = iroha::expected::resultToOptionalError(blocks)) {
+        log->warn("failed to request blocks from {} to {} from peer {}: {}",
+                  range.first,
+                  range.second,
+                  peer.public_key,
+                  *error);
+      } else {
+        // block loader observables emit on the subscribing thread
+        blocks.assumeValue().subscribe(
+            lifetime,
+            [&](const BlockPtr &block) {
+              if (block->height() != received + 1
+                  or block->height() > range.second) {
+                lifetime.unsubscribe();
+                return;
+              }
+              received = block->height();
+              std::lock_guard<std::mutex> guard(download.mutex);
+              download.ready.emplace(received, block);
+              peer.last_block_time = Clock::now();
+              download.cv.notify_all();
+            },
+            [&](std::exception_ptr) {
+              log->warn("error while downloading blocks from peer {}",
+                        peer.public_key);
+            });
+      }
+
+      lock.lock();
+      peer.downloading = false;
+      if (download.stopped) {
+        return;
+      }
+      if (received < range.second) {
+        log->warn("peer {} provided blocks up to {} instead of {}",
+                  peer.public_key,
+                  received,
+                  range.second);
+        download.pending.emplace(received + 1, range.second);
+        --download.working_peers;
+        download.cv.notify_all();
+        return;
+      }
+    }
+  }
+}  // namespace
+
+ParallelBlockLoader::ParallelBlockLoader(
+    std::shared_ptr<network::BlockLoader> block_loader,
+    size_t range_size,
+    size_t ranges_ahead,
+    std::chrono::milliseconds stall_timeout,
+    logger::LoggerPtr log)
+    : block_loader_(std::move(block_loader)),
+      range_size_(std::max<size_t>(range_size, 1)),
+      ranges_ahead_(std::max<size_t>(ranges_ahead, 1)),
+      stall_timeout_(stall_timeout),
+      log_(std::move(log)) {}
+
+bool ParallelBlockLoader::isWorthFor(size_t blocks, size_t peers) const {
+  return peers > 1 and blocks > range_size_;
+}
+
+rxcpp::observable<BlockPtr> ParallelBlockLoader::retrieveBlocks(
+    HeightType height,
+    HeightType target_height,
+    const shared_model::interface::types::PublicKeyCollectionType &public_keys)
+    const {
+  return rxcpp::observable<BlockPtr>(rxcpp::observable<>::create<BlockPtr>(
+      [block_loader = block_loader_,
+       range_size = range_size_,
+       window = range_size_ * ranges_ahead_,
+       stall_timeout = stall_timeout_,
+       log = log_,
+       height,
+       target_height,
+       public_keys](auto subscriber) {
+        log->info("downloading blocks from {} to {} from {} peers",
+                  height + 1,
+                  target_height,
+                  public_keys.size());
+        Download download;
+        download.next = height + 1;
+        download.working_peers = public_keys.size();
+        for (auto from = height + 1; from <= target_height;
+             from += range_size) {
+          download.pending.emplace(
+              from, std::min<HeightType>(from + range_size - 1, target_height));
+        }
+
+        std::vector<Peer> peers(public_keys.begin(), public_keys.end());
+        for (auto &peer : peers) {
+          peer.thread = std::thread(downloadRanges,
+                                    std::ref(download),
+                                    std::ref(peer),
+                                    std::ref(*block_loader),
+                                    window,
+                                    std::cref(log));
+        }
+
+        std::unique_lock<std::mutex> lock(download.mutex);
+        while (subscriber.is_subscribed()
+               and download.next <= target_height) {
+          auto it = download.ready.find(download.next);
+          if (it != download.ready.end()) {
+            auto block = std::move(it->second);
+            download.ready.erase(it);
+            ++download.next;
+            download.cv.notify_all();
+            lock.unlock();
+            subscriber.on_next(std::move(block));
+            lock.lock();
+            continue;
+          }
+          if (download.working_peers == 0) {
+            log->warn("no peer provided block {}", download.next);
+            break;
+          }
+          download.cv.wait_for(lock, stall_timeout, [&] {
+            return download.ready.count(download.next) != 0
+                or download.working_peers == 0;
+          });
+          const auto now = Clock::now();
+          for (auto &peer : peers) {
+            if (peer.downloading
+                and now - peer.last_block_time > stall_timeout) {
+              log->warn("peer {} stalled, switching to other peers",
+                        peer.public_key);
+              peer.downloading = false;
+              peer.range_lifetime.unsubscribe();
+            }
+          }
+        }
+
+        download.stopped = true;
+        for (auto &peer : peers) {
+          peer.range_lifetime.unsubscribe();
+        }
+        download.cv.notify_all();
+        lock.unlock();
+        for (auto &peer : peers) {
+          peer.thread.join();
+        }
+        subscriber.on_completed();
+      }));
+}
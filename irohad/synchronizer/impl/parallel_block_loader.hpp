@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PARALLEL_BLOCK_LOADER_HPP
+#define IROHA_PARALLEL_BLOCK_LOADER_HPP
+
+#include <chrono>
+#include <memory>
+
+#include <rxcpp/rx-lite.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace network {
+    class BlockLoader;
+  }
+
+  namespace synchronizer {
+
+    /**
+     * Downloads a long chain of blocks from several peers at once. The chain
+     * is split into ranges of fixed size, each peer downloads one range at a
+     * time, and received blocks are emitted in the order of their heights.
+     * Blocks are parsed and their signatures are checked by the download
+     * threads, so only applying them is left to the subscriber.
+     *
+     * A peer which fails to provide its range completely or does not send a
+     * block for too long is not used anymore, and the rest of its range is
+     * downloaded by other peers.
+     */
+    class ParallelBlockLoader {
+     public:
+      /**
+       * @param block_loader - loader used to download the ranges
+       * @param range_size - number of blocks requested from a peer at once
+       * @param ranges_ahead - number of ranges which may be downloaded ahead
+       * of the lowest block which is not emitted yet
+       * @param stall_timeout - time without a received block after which a
+       * peer is considered stalled
+       * @param log - logger
+       */
+      ParallelBlockLoader(std::shared_ptr<network::BlockLoader> block_loader,
+                          size_t range_size,
+                          size_t ranges_ahead,
+                          std::chrono::milliseconds stall_timeout,
+                          logger::LoggerPtr log);
+
+      /**
+       * @param blocks - number of blocks to download
+       * @param peers - number of peers which have the blocks
+       * @return true if downloading the blocks in parallel pays off
+       */
+      bool isWorthFor(size_t blocks, size_t peers) const;
+
+      /**
+       * Download the blocks after the given height up to the target one
+       * @param height - top block height in the local storage
+       * @param target_height - height of the last block to download
+       * @param public_keys - peers to download the blocks from
+       * @return observable of consecutive blocks starting from height + 1,
+       * which completes earlier if none of the peers can provide the next
+       * block. Subscription blocks until the download is finished.
+       */
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlocks(
+          shared_model::interface::types::HeightType height,
+          shared_model::interface::types::HeightType target_height,
+          const shared_model::interface::types::PublicKeyCollectionType
+              &public_keys) const;
+
+     private:
+      std::shared_ptr<network::BlockLoader> block_loader_;
+      size_t range_size_;
+      size_t ranges_ahead_;
+      std::chrono::milliseconds stall_timeout_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace synchronizer
+}  // namespace iroha
+
+#endif  // IROHA_PARALLEL_BLOCK_LOADER_HPP
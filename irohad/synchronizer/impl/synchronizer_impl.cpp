@@ -16,7 +16,10 @@
 #include "common/visitor.hpp"
 #include "interfaces/common_objects/string_view_types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/transaction_stages.hpp"
 
 using namespace shared_model::interface::types;
 
@@ -30,14 +33,22 @@ namespace iroha {
         std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
         std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
         std::shared_ptr<network::BlockLoader> block_loader,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<ParallelBlockLoader> parallel_block_loader)
         : command_executor_(std::move(command_executor)),
           validator_(std::move(validator)),
           mutable_factory_(std::move(mutable_factory)),
           block_query_factory_(std::move(block_query_factory)),
           block_loader_(std::move(block_loader)),
+          parallel_block_loader_(std::move(parallel_block_loader)),
           notifier_(notifier_lifetime_),
-          log_(std::move(log)) {
+          log_(std::move(log)),
+          commit_time_(metrics::registry().histogram(
+              "iroha_synchronizer_commit_microseconds",
+              "Time of committing a block agreed on by the consensus")),
+          synchronization_time_(metrics::registry().histogram(
+              "iroha_synchronizer_synchronization_microseconds",
+              "Time of downloading and committing missing blocks")) {
       consensus_gate->onOutcome().subscribe(
           subscription_, [this](consensus::GateObject object) {
             this->processOutcome(object);
@@ -98,6 +109,26 @@ namespace iroha {
       auto storage = std::move(storage_result).assumeValue();
       shared_model::interface::types::HeightType my_height = start_height;
 
+      if (parallel_block_loader_
+          and parallel_block_loader_->isWorthFor(target_height - my_height,
+                                                 public_keys.size())) {
+        auto network_chain =
+            parallel_block_loader_
+                ->retrieveBlocks(my_height, target_height, public_keys)
+                .tap([&my_height](const std::shared_ptr<
+                                  shared_model::interface::Block> &block) {
+                  my_height = block->height();
+                });
+        if (validator_->validateAndApply(network_chain, *storage)) {
+          if (my_height >= target_height) {
+            return mutable_factory_->commit(std::move(storage));
+          }
+        } else {
+          my_height = std::max(my_height - 1, start_height);
+        }
+        // the rest of the chain is downloaded from the peers one by one
+      }
+
       // TODO andrei 17.10.18 IR-1763 Add delay strategy for loading blocks
       using namespace iroha::expected;
       for (const auto &public_key : public_keys) {
@@ -157,9 +188,15 @@ namespace iroha {
 
     void SynchronizerImpl::processNext(const consensus::PairValid &msg) {
       log_->info("at handleNext");
+      for (const auto &tx : msg.block->transactions()) {
+        metrics::transactionStages().finished(
+            tx.hash(), metrics::TransactionStages::kConsensus);
+      }
+      const auto start = std::chrono::steady_clock::now();
       const auto notify =
-          [this,
-           &msg](std::shared_ptr<const iroha::LedgerState> &&ledger_state) {
+          [this, &msg, start](
+              std::shared_ptr<const iroha::LedgerState> &&ledger_state) {
+            commit_time_.observeSince(start);
             this->notifier_.get_subscriber().on_next(
                 SynchronizationEvent{SynchronizationOutcomeType::kCommit,
                                      msg.round,
@@ -201,10 +238,12 @@ namespace iroha {
         shared_model::interface::types::HeightType required_height) {
       log_->info("at handleDifferent");
 
+      const auto start = std::chrono::steady_clock::now();
       auto commit_result = downloadAndCommitMissingBlocks(
           msg.ledger_state->top_block_info.height,
           required_height,
           msg.public_keys);
+      synchronization_time_.observeSince(start);
 
       commit_result.match(
           [this, &msg](auto &value) {
@@ -16,6 +16,7 @@
 #include "logger/logger_fwd.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
+#include "synchronizer/impl/parallel_block_loader.hpp"
 #include "validation/chain_validator.hpp"
 
 namespace iroha {
@@ -24,6 +25,9 @@ namespace iroha {
     class BlockQueryFactory;
     class CommandExecutor;
   }  // namespace ametsuchi
+  namespace metrics {
+    class Histogram;
+  }  // namespace metrics
 
   namespace synchronizer {
 
@@ -36,7 +40,9 @@ namespace iroha {
           std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<network::BlockLoader> block_loader,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<ParallelBlockLoader> parallel_block_loader =
+              nullptr);
 
       ~SynchronizerImpl() override;
 
@@ -46,7 +52,8 @@ namespace iroha {
      private:
       /**
        * Iterate through the peers which signed the commit message, load and
-       * apply the missing blocks
+       * apply the missing blocks. Long chains are first downloaded from all
+       * the peers at once, if parallel block loader is set
        * @param start_height - the block from which to start synchronization
        * @param target_height - the block height that must be reached
        * @param public_keys - public keys of peers from which to ask the blocks
@@ -79,6 +86,7 @@ namespace iroha {
       std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<network::BlockLoader> block_loader_;
+      std::shared_ptr<ParallelBlockLoader> parallel_block_loader_;
 
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
@@ -86,6 +94,9 @@ namespace iroha {
       rxcpp::composite_subscription subscription_;
 
       logger::LoggerPtr log_;
+
+      metrics::Histogram &commit_time_;
+      metrics::Histogram &synchronization_time_;
     };
 
   }  // namespace synchronizer
@@ -7,9 +7,12 @@
 
 #include "torii/impl/command_service_transport_grpc.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <future>
 #include <iterator>
+#include <vector>
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/format.hpp>
@@ -22,6 +25,7 @@
 #include "backend/protobuf/util.hpp"
 #include "common/combine_latest_until_first_completed.hpp"
 #include "common/run_loop_handler.hpp"
+#include "common/thread_pool.hpp"
 #include "cryptography/hash_providers/sha3_256.hpp"
 #include "interfaces/iroha_internal/parse_and_create_batches.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -30,8 +34,15 @@
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/transaction_stages.hpp"
 #include "torii/status_bus.hpp"
 
+namespace {
+  /// Minimal number of transactions deserialized by a single pool thread
+  constexpr size_t kMinTransactionsPerValidationThread = 16;
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -47,6 +58,7 @@ namespace iroha {
             transaction_batch_factory,
         rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
         int maximum_rounds_without_update,
+        std::shared_ptr<ThreadPool> validation_pool,
         logger::LoggerPtr log)
         : command_service_(std::move(command_service)),
           status_bus_(std::move(status_bus)),
@@ -56,7 +68,18 @@ namespace iroha {
           batch_factory_(std::move(transaction_batch_factory)),
           log_(std::move(log)),
           consensus_gate_objects_(std::move(consensus_gate_objects)),
-          maximum_rounds_without_update_(maximum_rounds_without_update) {}
+          maximum_rounds_without_update_(maximum_rounds_without_update),
+          validation_pool_(std::move(validation_pool)),
+          received_transactions_(metrics::registry().counter(
+              "iroha_torii_transactions_received_total",
+              "Transactions received by Torii")),
+          rejected_transactions_(metrics::registry().counter(
+              "iroha_torii_transactions_rejected_total",
+              "Transactions rejected by Torii before stateful validation")),
+          stateless_validation_time_(metrics::registry().histogram(
+              "iroha_torii_stateless_validation_microseconds",
+              "Time of deserialization and stateless validation of "
+              "transaction lists")) {}
 
     grpc::Status CommandServiceTransportGrpc::Torii(
         grpc::ServerContext *context,
@@ -71,9 +94,12 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxList *request,
         google::protobuf::Empty *response) {
+      const auto start = std::chrono::steady_clock::now();
+      received_transactions_.increment(request->transactions_size());
       auto publish_stateless_fail = [&](auto &&message) {
         using HashProvider = shared_model::crypto::Sha3_256;
 
+        rejected_transactions_.increment(request->transactions_size());
         log_->warn("{}", message);
         for (const auto &tx : request->transactions()) {
           status_bus_->publish(status_factory_->makeStatelessFail(
@@ -85,8 +111,7 @@ namespace iroha {
         return grpc::Status::OK;
       };
 
-      auto transactions = shared_model::proto::deserializeTransactions(
-          *transaction_factory_, request->transactions());
+      auto transactions = deserializeTransactions(request->transactions());
       if (auto e = expected::resultToOptionalError(transactions)) {
         return publish_stateless_fail(
             fmt::format("Transaction deserialization failed: hash {}, {}",
@@ -102,7 +127,15 @@ namespace iroha {
         return publish_stateless_fail(
             fmt::format("Batch deserialization failed: {}", *e));
       }
+      stateless_validation_time_.observeSince(start);
 
+      for (const auto &batch : batches.assumeValue()) {
+        for (const auto &tx : batch->transactions()) {
+          metrics::transactionStages().submitted(tx->hash(), start);
+          metrics::transactionStages().finished(
+              tx->hash(), metrics::TransactionStages::kStatelessValidation);
+        }
+      }
       for (auto &batch : std::move(batches).assumeValue()) {
         this->command_service_->handleTransactionBatch(std::move(batch));
       }
@@ -110,6 +143,68 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
+    iroha::expected::Result<
+        shared_model::interface::types::SharedTxsCollectionType,
+        CommandServiceTransportGrpc::TransportFactoryType::Error>
+    CommandServiceTransportGrpc::deserializeTransactions(
+        const google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+            &transactions) {
+      const size_t size = transactions.size();
+      const size_t chunks = validation_pool_
+          ? std::min(validation_pool_->size(),
+                     size / kMinTransactionsPerValidationThread)
+          : 0;
+      if (chunks < 2) {
+        return shared_model::proto::deserializeTransactions(
+            *transaction_factory_, transactions);
+      }
+
+      using ChunkResult = iroha::expected::Result<
+          shared_model::interface::types::SharedTxsCollectionType,
+          TransportFactoryType::Error>;
+      const size_t chunk_size = (size + chunks - 1) / chunks;
+      std::vector<std::future<ChunkResult>> chunk_results;
+      for (size_t begin = 0; begin < size; begin += chunk_size) {
+        const size_t end = std::min(size, begin + chunk_size);
+        chunk_results.push_back(
+            validation_pool_->submit([&, begin, end]() -> ChunkResult {
+              shared_model::interface::types::SharedTxsCollectionType txs;
+              txs.reserve(end - begin);
+              for (auto i = begin; i < end; ++i) {
+                auto tx = transaction_factory_->build(transactions[i]);
+                if (auto e = expected::resultToOptionalError(tx)) {
+                  return *e;
+                }
+                txs.emplace_back(std::move(tx).assumeValue());
+              }
+              return txs;
+            }));
+      }
+
+      // chunks are joined in the request order, so the reported error is the
+      // one of the first invalid transaction, as with sequential processing
+      shared_model::interface::types::SharedTxsCollectionType result;
+      result.reserve(size);
+      boost::optional<TransportFactoryType::Error> error;
+      for (auto &chunk_result : chunk_results) {
+        auto txs = chunk_result.get();
+        if (error) {
+          continue;
+        }
+        if (auto e = expected::resultToOptionalError(txs)) {
+          error = std::move(e);
+          continue;
+        }
+        auto &chunk_txs = txs.assumeValue();
+        std::move(
+            chunk_txs.begin(), chunk_txs.end(), std::back_inserter(result));
+      }
+      if (error) {
+        return expected::makeError(std::move(*error));
+      }
+      return result;
+    }
+
     grpc::Status CommandServiceTransportGrpc::Status(
         grpc::ServerContext *context,
         const iroha::protocol::TxStatusRequest *request,
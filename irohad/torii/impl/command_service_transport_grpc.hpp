@@ -16,6 +16,11 @@
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
+  class ThreadPool;
+  namespace metrics {
+    class Counter;
+    class Histogram;
+  }  // namespace metrics
   namespace torii {
     class StatusBus;
   }
@@ -52,6 +57,9 @@ namespace iroha {
        * @param consensus_gate_objects - events from consensus gate
        * @param maximum_rounds_without_update - defines how long tx status
        * stream is kept alive when no new tx statuses appear
+       * @param validation_pool - threads which deserialize and validate large
+       * transaction lists in parallel, or nullptr to do it on the calling
+       * thread
        * @param log to print progress
        */
       CommandServiceTransportGrpc(
@@ -66,6 +74,7 @@ namespace iroha {
               transaction_batch_factory,
           rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
           int maximum_rounds_without_update,
+          std::shared_ptr<ThreadPool> validation_pool,
           logger::LoggerPtr log);
 
       /**
@@ -119,6 +128,20 @@ namespace iroha {
           override;
 
      private:
+      /**
+       * Deserialize and statelessly validate transactions, splitting large
+       * lists between threads of the validation pool
+       * @param transactions - transactions received
+       * @return transactions in the order of the request, or an error of the
+       * first invalid transaction
+       */
+      iroha::expected::Result<
+          shared_model::interface::types::SharedTxsCollectionType,
+          TransportFactoryType::Error>
+      deserializeTransactions(
+          const google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+              &transactions);
+
       std::shared_ptr<CommandService> command_service_;
       std::shared_ptr<iroha::torii::StatusBus> status_bus_;
       std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory_;
@@ -131,6 +154,11 @@ namespace iroha {
 
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
       const int maximum_rounds_without_update_;
+      std::shared_ptr<ThreadPool> validation_pool_;
+
+      metrics::Counter &received_transactions_;
+      metrics::Counter &rejected_transactions_;
+      metrics::Histogram &stateless_validation_time_;
     };
   }  // namespace torii
 }  // namespace iroha
@@ -5,6 +5,9 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <future>
 #include <string>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
@@ -13,8 +16,10 @@
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include "common/result.hpp"
+#include "common/thread_pool.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "logger/logger.hpp"
+#include "validation/impl/transaction_footprint.hpp"
 
 namespace iroha {
   namespace validation {
@@ -40,66 +45,70 @@ namespace iroha {
     };
 
     /**
-     * Validate all transactions supplied; includes special rules, such as batch
-     * validation etc
-     * @param txs to be validated
+     * Validate a single batch; includes special rules, such as atomic batch
+     * rollback
+     * @param batch to be validated
      * @param temporary_wsv to apply transactions on
      * @param transactions_errors_log to write errors to
-     * @param batch_parser to parse batches from transaction range
-     * @return range of transactions, which passed stateful validation
+     * @param validation_results to append the result of each transaction to
      */
-    static auto validateTransactions(
-        const shared_model::interface::types::TransactionsCollectionType &txs,
+    static void validateBatch(
+        const shared_model::interface::types::TransactionsCollectionType
+            &batch,
         ametsuchi::TemporaryWsv &temporary_wsv,
         validation::TransactionsErrors &transactions_errors_log,
-        const shared_model::interface::TransactionBatchParser &batch_parser) {
-      std::vector<bool> validation_results;
-      validation_results.reserve(boost::size(txs));
-
-      for (auto batch : batch_parser.parseBatches(txs)) {
-        auto validation = [&](auto &tx) {
-          return checkTransactions(temporary_wsv, transactions_errors_log, tx);
-        };
-        if (batch.front().batchMeta()
-            and batch.front().batchMeta()->get()->type()
-                == shared_model::interface::types::BatchType::ATOMIC) {
-          // check all batch's transactions for validness
-          auto savepoint = temporary_wsv.createSavepoint(
-              "batch_" + batch.front().hash().hex());
-          bool validation_result = false;
-
-          if (boost::algorithm::all_of(batch, validation)) {
-            // batch is successful; release savepoint
-            validation_result = true;
-            savepoint->release();
-          } else {
-            auto failed_tx_hash = transactions_errors_log.back().tx_hash;
-            for (const auto &tx : batch) {
-              if (tx.hash() != failed_tx_hash) {
-                transactions_errors_log.emplace_back(
-                    validation::TransactionError{
-                        tx.hash(),
-                        // TODO igor-egorov 22.01.2019 IR-245 add a separate
-                        // error code for failed batch case
-                        validation::CommandError{
-                            "",
-                            1,  // internal error code
-                            "Another transaction failed the batch",
-                            true,
-                            std::numeric_limits<size_t>::max()}});
-              }
-            }
-          }
+        std::vector<bool> &validation_results) {
+      auto validation = [&](auto &tx) {
+        return checkTransactions(temporary_wsv, transactions_errors_log, tx);
+      };
+      if (batch.front().batchMeta()
+          and batch.front().batchMeta()->get()->type()
+              == shared_model::interface::types::BatchType::ATOMIC) {
+        // check all batch's transactions for validness
+        auto savepoint = temporary_wsv.createSavepoint(
+            "batch_" + batch.front().hash().hex());
+        bool validation_result = false;
 
-          validation_results.insert(
-              validation_results.end(), boost::size(batch), validation_result);
+        if (boost::algorithm::all_of(batch, validation)) {
+          // batch is successful; release savepoint
+          validation_result = true;
+          savepoint->release();
         } else {
+          auto failed_tx_hash = transactions_errors_log.back().tx_hash;
           for (const auto &tx : batch) {
-            validation_results.push_back(validation(tx));
+            if (tx.hash() != failed_tx_hash) {
+              transactions_errors_log.emplace_back(validation::TransactionError{
+                  tx.hash(),
+                  // TODO igor-egorov 22.01.2019 IR-245 add a separate
+                  // error code for failed batch case
+                  validation::CommandError{
+                      "",
+                      1,  // internal error code
+                      "Another transaction failed the batch",
+                      true,
+                      std::numeric_limits<size_t>::max()}});
+            }
           }
         }
+
+        validation_results.insert(
+            validation_results.end(), boost::size(batch), validation_result);
+      } else {
+        for (const auto &tx : batch) {
+          validation_results.push_back(validation(tx));
+        }
       }
+    }
 
+    /**
+     * Select transactions which passed stateful validation
+     * @param txs - all transactions
+     * @param validation_results - validation result of each transaction
+     * @return range of transactions, which passed stateful validation
+     */
+    static auto selectValid(
+        const shared_model::interface::types::TransactionsCollectionType &txs,
+        std::vector<bool> validation_results) {
       return txs | boost::adaptors::indexed()
           | boost::adaptors::filtered(
                  [validation_results =
@@ -110,14 +119,138 @@ namespace iroha {
                  [](const auto &el) -> decltype(auto) { return el.value(); });
     }
 
+    /// Validation outcome of a single batch
+    struct BatchOutcome {
+      std::vector<bool> validation_results;
+      validation::TransactionsErrors errors;
+    };
+
     StatefulValidatorImpl::StatefulValidatorImpl(
         std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory,
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
             batch_parser,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        size_t max_workers,
+        TemporaryWsvFactory wsv_factory,
+        std::shared_ptr<ThreadPool> thread_pool)
         : factory_(std::move(factory)),
           batch_parser_(std::move(batch_parser)),
-          log_(std::move(log)) {}
+          log_(std::move(log)),
+          max_workers_(max_workers),
+          wsv_factory_(std::move(wsv_factory)),
+          thread_pool_(std::move(thread_pool)) {}
+
+    boost::optional<std::vector<bool>>
+    StatefulValidatorImpl::validateInParallel(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        TransactionsErrors &transactions_errors_log) {
+      if (max_workers_ < 2 or not wsv_factory_ or not thread_pool_
+          or batches.size() < 2) {
+        return boost::none;
+      }
+
+      std::vector<TransactionFootprint> footprints(batches.size());
+      for (size_t i = 0; i < batches.size(); ++i) {
+        for (const auto &tx : batches[i]) {
+          footprints[i].add(tx);
+        }
+      }
+      auto groups = splitIntoIndependentGroups(footprints);
+      if (groups.size() < 2) {
+        return boost::none;
+      }
+
+      // assign the largest groups first, each to the least loaded worker
+      const auto workers_number = std::min(max_workers_, groups.size());
+      std::stable_sort(
+          groups.begin(), groups.end(), [](const auto &a, const auto &b) {
+            return a.size() > b.size();
+          });
+      std::vector<std::vector<size_t>> worker_batches(workers_number);
+      std::vector<size_t> worker_load(workers_number, 0);
+      for (const auto &group : groups) {
+        auto worker = std::distance(
+            worker_load.begin(),
+            std::min_element(worker_load.begin(), worker_load.end()));
+        for (auto batch : group) {
+          worker_batches[worker].push_back(batch);
+          worker_load[worker] += boost::size(batches[batch]);
+        }
+      }
+
+      std::vector<std::unique_ptr<ametsuchi::TemporaryWsv>> additional_wsvs;
+      for (size_t i = 1; i < workers_number; ++i) {
+        auto wsv = wsv_factory_();
+        if (auto error = expected::resultToOptionalError(wsv)) {
+          log_->warn(
+              "Could not create temporary WSV for parallel validation: {}",
+              error.value());
+          return boost::none;
+        }
+        additional_wsvs.push_back(std::move(wsv).assumeValue());
+      }
+
+      // each worker writes only the outcomes of its own batches
+      std::vector<BatchOutcome> outcomes(batches.size());
+      auto run_worker = [&](size_t worker, ametsuchi::TemporaryWsv &wsv) {
+        auto &indices = worker_batches[worker];
+        std::sort(indices.begin(), indices.end());
+        for (auto i : indices) {
+          validateBatch(batches[i],
+                        wsv,
+                        outcomes[i].errors,
+                        outcomes[i].validation_results);
+        }
+      };
+
+      std::vector<std::future<void>> workers;
+      for (size_t i = 1; i < workers_number; ++i) {
+        workers.push_back(thread_pool_->submit(
+            [&run_worker, &wsv = *additional_wsvs[i - 1], i] {
+              run_worker(i, wsv);
+            }));
+      }
+      // the workers use the state of this call, so all of them must finish
+      // before an exception of any one is passed on
+      std::exception_ptr error;
+      try {
+        run_worker(0, temporary_wsv);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      for (auto &worker : workers) {
+        try {
+          worker.get();
+        } catch (...) {
+          if (not error) {
+            error = std::current_exception();
+          }
+        }
+      }
+      if (error) {
+        std::rethrow_exception(error);
+      }
+
+      log_->info("validated {} independent groups with {} workers",
+                 groups.size(),
+                 workers_number);
+
+      // merge in proposal order, so that the result is the same as of
+      // sequential validation
+      std::vector<bool> validation_results;
+      for (auto &outcome : outcomes) {
+        validation_results.insert(validation_results.end(),
+                                  outcome.validation_results.begin(),
+                                  outcome.validation_results.end());
+        std::move(outcome.errors.begin(),
+                  outcome.errors.end(),
+                  std::back_inserter(transactions_errors_log));
+      }
+      return validation_results;
+    }
 
     std::unique_ptr<validation::VerifiedProposalAndErrors>
     StatefulValidatorImpl::validate(
@@ -127,11 +260,25 @@ namespace iroha {
                  proposal.transactions().size());
 
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
-      auto valid_txs =
-          validateTransactions(proposal.transactions(),
-                               temporaryWsv,
-                               validation_result->rejected_transactions,
-                               *batch_parser_);
+      auto batches = batch_parser_->parseBatches(proposal.transactions());
+
+      auto validation_results = validateInParallel(
+          batches, temporaryWsv, validation_result->rejected_transactions);
+      if (validation_results) {
+        // the changes of other workers are not in the given WSV
+        validation_result->temporary_wsv_is_complete = false;
+      } else {
+        validation_results = std::vector<bool>{};
+        validation_results->reserve(proposal.transactions().size());
+        for (const auto &batch : batches) {
+          validateBatch(batch,
+                        temporaryWsv,
+                        validation_result->rejected_transactions,
+                        *validation_results);
+        }
+      }
+      auto valid_txs = selectValid(proposal.transactions(),
+                                   std::move(*validation_results));
 
       // Since proposal came from ordering gate it was already validated.
       // All transactions are validated as well
@@ -8,11 +8,17 @@
 
 #include "validation/stateful_validator.hpp"
 
+#include <functional>
+
+#include <boost/optional.hpp>
+#include "common/result_fwd.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
+  class ThreadPool;
+
   namespace validation {
 
     /**
@@ -20,22 +26,61 @@ namespace iroha {
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
+      /// Creates a temporary WSV which uses its own database session
+      using TemporaryWsvFactory = std::function<expected::Result<
+          std::unique_ptr<ametsuchi::TemporaryWsv>,
+          std::string>()>;
+
+      /**
+       * @param factory - factory of verified proposals
+       * @param batch_parser - parser of batches in proposal
+       * @param log - logger
+       * @param max_workers - maximal number of transaction groups which are
+       * validated concurrently; 1 disables parallel validation
+       * @param wsv_factory - factory of temporary WSVs for additional workers;
+       * required if max_workers is greater than 1
+       * @param thread_pool - pool which runs additional workers, while the
+       * first one runs on the calling thread; required if max_workers is
+       * greater than 1
+       */
       StatefulValidatorImpl(
           std::unique_ptr<shared_model::interface::UnsafeProposalFactory>
               factory,
           std::shared_ptr<shared_model::interface::TransactionBatchParser>
               batch_parser,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t max_workers = 1,
+          TemporaryWsvFactory wsv_factory = {},
+          std::shared_ptr<ThreadPool> thread_pool = nullptr);
 
       std::unique_ptr<validation::VerifiedProposalAndErrors> validate(
           const shared_model::interface::Proposal &proposal,
           ametsuchi::TemporaryWsv &temporaryWsv) override;
 
      private:
+      /**
+       * Validate groups of batches which do not touch the same state on
+       * separate temporary WSVs concurrently
+       * @param batches - batches of the proposal
+       * @param temporary_wsv - WSV used by the first worker
+       * @param transactions_errors_log - log to write errors to
+       * @return validation result of each transaction, or none if the
+       * proposal is not worth splitting or additional WSVs are not available
+       */
+      boost::optional<std::vector<bool>> validateInParallel(
+          const std::vector<
+              shared_model::interface::types::TransactionsCollectionType>
+              &batches,
+          ametsuchi::TemporaryWsv &temporary_wsv,
+          TransactionsErrors &transactions_errors_log);
+
       std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory_;
       std::shared_ptr<shared_model::interface::TransactionBatchParser>
           batch_parser_;
       logger::LoggerPtr log_;
+      size_t max_workers_;
+      TemporaryWsvFactory wsv_factory_;
+      std::shared_ptr<ThreadPool> thread_pool_;
     };
 
   }  // namespace validation
@@ -0,0 +1,212 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/transaction_footprint.hpp"
+
+#include <numeric>
+#include <unordered_map>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/compare_and_set_account_detail.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::validation;
+namespace interface = shared_model::interface;
+
+namespace {
+  std::string accountKey(const std::string &id) {
+    return "account:" + id;
+  }
+
+  std::string assetKey(const std::string &id) {
+    return "asset:" + id;
+  }
+
+  std::string domainKey(const std::string &id) {
+    return "domain:" + id;
+  }
+
+  std::string roleKey(const std::string &id) {
+    return "role:" + id;
+  }
+
+  std::string signatoryKey(const std::string &public_key) {
+    return "signatory:" + public_key;
+  }
+
+  /// Disjoint set of footprint indices
+  class DisjointSet {
+   public:
+    explicit DisjointSet(size_t size) : parent_(size) {
+      std::iota(parent_.begin(), parent_.end(), 0);
+    }
+
+    size_t find(size_t i) {
+      while (parent_[i] != i) {
+        parent_[i] = parent_[parent_[i]];
+        i = parent_[i];
+      }
+      return i;
+    }
+
+    void unite(size_t a, size_t b) {
+      a = find(a);
+      b = find(b);
+      // keep the smaller index as the root, so the order is deterministic
+      if (a < b) {
+        parent_[b] = a;
+      } else {
+        parent_[a] = b;
+      }
+    }
+
+   private:
+    std::vector<size_t> parent_;
+  };
+}  // namespace
+
+void TransactionFootprint::add(const interface::Transaction &tx) {
+  const auto &creator = tx.creatorAccountId();
+  // signatories and permissions of the creator are checked for every command
+  reads.push_back(accountKey(creator));
+
+  for (const auto &command : tx.commands()) {
+    iroha::visit_in_place(
+        command.get(),
+        [&](const interface::AddAssetQuantity &c) {
+          writes.push_back(accountKey(creator));
+          reads.push_back(assetKey(c.assetId()));
+        },
+        [&](const interface::SubtractAssetQuantity &c) {
+          writes.push_back(accountKey(creator));
+          reads.push_back(assetKey(c.assetId()));
+        },
+        [&](const interface::TransferAsset &c) {
+          writes.push_back(accountKey(c.srcAccountId()));
+          writes.push_back(accountKey(c.destAccountId()));
+          reads.push_back(assetKey(c.assetId()));
+        },
+        [&](const interface::CreateAccount &c) {
+          writes.push_back(
+              accountKey(c.accountName() + "@" + c.domainId()));
+          writes.push_back(signatoryKey(c.pubkey()));
+          reads.push_back(domainKey(c.domainId()));
+        },
+        [&](const interface::CreateAsset &c) {
+          writes.push_back(assetKey(c.assetName() + "#" + c.domainId()));
+          reads.push_back(domainKey(c.domainId()));
+        },
+        [&](const interface::CreateDomain &c) {
+          writes.push_back(domainKey(c.domainId()));
+          reads.push_back(roleKey(c.userDefaultRole()));
+        },
+        [&](const interface::CreateRole &c) {
+          writes.push_back(roleKey(c.roleName()));
+        },
+        [&](const interface::AppendRole &c) {
+          writes.push_back(accountKey(c.accountId()));
+          reads.push_back(roleKey(c.roleName()));
+        },
+        [&](const interface::DetachRole &c) {
+          writes.push_back(accountKey(c.accountId()));
+          reads.push_back(roleKey(c.roleName()));
+        },
+        [&](const interface::AddSignatory &c) {
+          writes.push_back(accountKey(c.accountId()));
+          writes.push_back(signatoryKey(c.pubkey()));
+        },
+        [&](const interface::RemoveSignatory &c) {
+          writes.push_back(accountKey(c.accountId()));
+          writes.push_back(signatoryKey(c.pubkey()));
+        },
+        [&](const interface::SetQuorum &c) {
+          writes.push_back(accountKey(c.accountId()));
+        },
+        [&](const interface::SetAccountDetail &c) {
+          writes.push_back(accountKey(c.accountId()));
+        },
+        [&](const interface::CompareAndSetAccountDetail &c) {
+          writes.push_back(accountKey(c.accountId()));
+        },
+        [&](const interface::GrantPermission &c) {
+          writes.push_back(accountKey(creator));
+          writes.push_back(accountKey(c.accountId()));
+        },
+        [&](const interface::RevokePermission &c) {
+          writes.push_back(accountKey(creator));
+          writes.push_back(accountKey(c.accountId()));
+        },
+        // AddPeer, RemovePeer, SetSettingValue and CallEngine
+        [&](const auto &) { global = true; });
+  }
+}
+
+std::vector<std::vector<size_t>> iroha::validation::splitIntoIndependentGroups(
+    const std::vector<TransactionFootprint> &footprints) {
+  const auto size = footprints.size();
+  DisjointSet groups(size);
+
+  // index of some writer of the key, if the key was written
+  std::unordered_map<std::string, size_t> writers;
+  // indices of readers of the key which have not been joined with a writer
+  std::unordered_map<std::string, std::vector<size_t>> readers;
+
+  for (size_t i = 0; i < size; ++i) {
+    const auto &footprint = footprints[i];
+    if (footprint.global) {
+      std::vector<size_t> all(size);
+      std::iota(all.begin(), all.end(), 0);
+      return {std::move(all)};
+    }
+    for (const auto &key : footprint.writes) {
+      auto writer = writers.emplace(key, i);
+      if (not writer.second) {
+        groups.unite(writer.first->second, i);
+      }
+      auto pending = readers.find(key);
+      if (pending != readers.end()) {
+        for (auto reader : pending->second) {
+          groups.unite(reader, i);
+        }
+        readers.erase(pending);
+      }
+    }
+    for (const auto &key : footprint.reads) {
+      auto writer = writers.find(key);
+      if (writer != writers.end()) {
+        groups.unite(writer->second, i);
+      } else {
+        readers[key].push_back(i);
+      }
+    }
+  }
+
+  std::vector<std::vector<size_t>> result;
+  std::unordered_map<size_t, size_t> root_to_group;
+  for (size_t i = 0; i < size; ++i) {
+    auto group = root_to_group.emplace(groups.find(i), result.size());
+    if (group.second) {
+      result.emplace_back();
+    }
+    result[group.first->second].push_back(i);
+  }
+  return result;
+}
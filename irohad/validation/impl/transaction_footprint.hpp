@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRANSACTION_FOOTPRINT_HPP
+#define IROHA_TRANSACTION_FOOTPRINT_HPP
+
+#include <string>
+#include <vector>
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Keys of world state entities which are read or modified by transaction
+     * commands. Keys are prefixed with the entity kind, e.g. "account:"
+     */
+    struct TransactionFootprint {
+      std::vector<std::string> reads;
+      std::vector<std::string> writes;
+
+      /// Set if the transaction may touch any part of the state, e.g. changes
+      /// peers or settings or calls the engine
+      bool global = false;
+
+      /**
+       * Add keys of the transaction commands to the footprint
+       * @param tx - transaction to process
+       */
+      void add(const shared_model::interface::Transaction &tx);
+    };
+
+    /**
+     * Split footprints into groups which can be validated independently.
+     * Footprints which write the same key, or write a key read by another one,
+     * are placed into the same group. A global footprint joins all the
+     * footprints into one group.
+     * @param footprints - footprints in proposal order
+     * @return groups of footprint indices; indices in each group are ascending
+     * and groups are ordered by their first index
+     */
+    std::vector<std::vector<size_t>> splitIntoIndependentGroups(
+        const std::vector<TransactionFootprint> &footprints);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_FOOTPRINT_HPP
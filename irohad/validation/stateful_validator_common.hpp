@@ -61,6 +61,10 @@ namespace iroha {
       std::shared_ptr<const shared_model::interface::Proposal>
           verified_proposal;
       TransactionsErrors rejected_transactions;
+      /// False if some transactions were applied to other temporary WSVs
+      /// during validation, so the state of the validated WSV must not be
+      /// prepared as the state of the block
+      bool temporary_wsv_is_complete = true;
     };
 
   }  // namespace validation
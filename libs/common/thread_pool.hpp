@@ -0,0 +1,72 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_THREAD_POOL_HPP
+#define IROHA_COMMON_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Fixed number of threads executing submitted tasks in FIFO order
+   */
+  class ThreadPool {
+   public:
+    /**
+     * @param threads - number of worker threads, at least one is started
+     */
+    explicit ThreadPool(size_t threads);
+
+    /// Executes already submitted tasks and joins the threads
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// @return number of worker threads
+    size_t size() const;
+
+    /**
+     * Schedule the task for execution
+     * @param task - callable without arguments
+     * @return future result of the task
+     */
+    template <typename Task>
+    auto submit(Task &&task) -> std::future<std::invoke_result_t<Task>> {
+      // std::function requires a copyable target
+      auto packaged_task =
+          std::make_shared<std::packaged_task<std::invoke_result_t<Task>()>>(
+              std::forward<Task>(task));
+      auto result = packaged_task->get_future();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.emplace([packaged_task] { (*packaged_task)(); });
+      }
+      condition_.notify_one();
+      return result;
+    }
+
+   private:
+    void work();
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::queue<std::function<void()>> tasks_;
+    bool stopped_ = false;
+    std::vector<std::thread> threads_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_THREAD_POOL_HPP
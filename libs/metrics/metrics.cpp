@@ -0,0 +1,213 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics.hpp"
+
+#include <stdexcept>
+
+#include <fmt/core.h>
+
+using namespace iroha::metrics;
+
+namespace {
+  /// Number of bits of a value which select the bucket within a power of two
+  constexpr int kSubBucketBits = 2;
+  static_assert(Histogram::kSubBuckets == 1 << kSubBucketBits);
+
+  std::string escapeLabelValue(const std::string &value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (auto c : value) {
+      switch (c) {
+        case '\\':
+          escaped += "\\\\";
+          break;
+        case '"':
+          escaped += "\\\"";
+          break;
+        case '\n':
+          escaped += "\\n";
+          break;
+        default:
+          escaped += c;
+      }
+    }
+    return escaped;
+  }
+
+  /// @return labels as they are written inside the braces
+  std::string serializeLabels(const Labels &labels) {
+    std::string result;
+    for (const auto &label : labels) {
+      if (not result.empty()) {
+        result += ',';
+      }
+      result += fmt::format(
+          "{}=\"{}\"", label.first, escapeLabelValue(label.second));
+    }
+    return result;
+  }
+
+  /// @return labels with the additional one in braces
+  std::string withLabel(const std::string &labels,
+                        const std::string &name,
+                        const std::string &value) {
+    return fmt::format("{{{}{}{}=\"{}\"}}",
+                       labels,
+                       labels.empty() ? "" : ",",
+                       name,
+                       value);
+  }
+
+  std::string inBraces(const std::string &labels) {
+    return labels.empty() ? labels : "{" + labels + "}";
+  }
+
+  template <typename T>
+  constexpr const char *typeName();
+
+  template <>
+  constexpr const char *typeName<Counter>() {
+    return "counter";
+  }
+
+  template <>
+  constexpr const char *typeName<Gauge>() {
+    return "gauge";
+  }
+
+  template <>
+  constexpr const char *typeName<Histogram>() {
+    return "histogram";
+  }
+
+  void serializeMetric(std::string &out,
+                       const std::string &name,
+                       const std::string &labels,
+                       const Counter &counter) {
+    out += fmt::format("{}{} {}\n", name, inBraces(labels), counter.value());
+  }
+
+  void serializeMetric(std::string &out,
+                       const std::string &name,
+                       const std::string &labels,
+                       const Gauge &gauge) {
+    out += fmt::format("{}{} {}\n", name, inBraces(labels), gauge.value());
+  }
+
+  void serializeMetric(std::string &out,
+                       const std::string &name,
+                       const std::string &labels,
+                       const Histogram &histogram) {
+    std::array<uint64_t, Histogram::kBuckets> counts;
+    size_t used_buckets = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+      counts[i] = histogram.bucketCount(i);
+      if (counts[i] != 0) {
+        used_buckets = i + 1;
+      }
+    }
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < used_buckets; ++i) {
+      cumulative += counts[i];
+      out += fmt::format(
+          "{}_bucket{} {}\n",
+          name,
+          withLabel(labels,
+                    "le",
+                    std::to_string(Histogram::bucketUpperBound(i))),
+          cumulative);
+    }
+    out += fmt::format(
+        "{}_bucket{} {}\n", name, withLabel(labels, "le", "+Inf"), cumulative);
+    out += fmt::format(
+        "{}_sum{} {}\n", name, inBraces(labels), histogram.sum());
+    out += fmt::format("{}_count{} {}\n", name, inBraces(labels), cumulative);
+  }
+}  // namespace
+
+size_t Histogram::bucketIndex(uint64_t value) {
+  if (value < kSubBuckets) {
+    return value;
+  }
+  const int exponent = 63 - __builtin_clzll(value);
+  const auto sub_bucket =
+      (value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+  return kSubBuckets * (exponent - kSubBucketBits + 1) + sub_bucket;
+}
+
+uint64_t Histogram::bucketUpperBound(size_t index) {
+  if (index < kSubBuckets) {
+    return index;
+  }
+  const auto exponent = index / kSubBuckets - 1 + kSubBucketBits;
+  const auto sub_bucket = index % kSubBuckets;
+  // wraps around to the maximal value for the last bucket
+  return ((kSubBuckets + sub_bucket + 1) << (exponent - kSubBucketBits)) - 1;
+}
+
+template <typename T>
+T &Registry::get(const std::string &name,
+                 const std::string &help,
+                 const Labels &labels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &family = families_[name];
+  if (family.type.empty()) {
+    family.type = typeName<T>();
+    family.help = help;
+  } else if (family.type != typeName<T>()) {
+    throw std::invalid_argument(fmt::format(
+        "metric {} is a {}, not a {}", name, family.type, typeName<T>()));
+  }
+
+  auto &metric = family.metrics[serializeLabels(labels)];
+  auto *typed = std::get_if<std::unique_ptr<T>>(&metric);
+  if (not typed or not *typed) {
+    metric = std::make_unique<T>();
+    typed = std::get_if<std::unique_ptr<T>>(&metric);
+  }
+  return **typed;
+}
+
+Counter &Registry::counter(const std::string &name,
+                           const std::string &help,
+                           const Labels &labels) {
+  return get<Counter>(name, help, labels);
+}
+
+Gauge &Registry::gauge(const std::string &name,
+                       const std::string &help,
+                       const Labels &labels) {
+  return get<Gauge>(name, help, labels);
+}
+
+Histogram &Registry::histogram(const std::string &name,
+                               const std::string &help,
+                               const Labels &labels) {
+  return get<Histogram>(name, help, labels);
+}
+
+std::string Registry::serialize() const {
+  std::string out;
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &family : families_) {
+    const auto &name = family.first;
+    out += fmt::format("# HELP {} {}\n", name, family.second.help);
+    out += fmt::format("# TYPE {} {}\n", name, family.second.type);
+    for (const auto &metric : family.second.metrics) {
+      std::visit(
+          [&](const auto &value) {
+            serializeMetric(out, name, metric.first, *value);
+          },
+          metric.second);
+    }
+  }
+  return out;
+}
+
+Registry &iroha::metrics::registry() {
+  static Registry registry;
+  return registry;
+}
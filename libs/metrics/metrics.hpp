@@ -0,0 +1,178 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_HPP
+#define IROHA_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+
+    /// Label names and values of a metric
+    using Labels = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * Monotonically increasing value, such as the number of processed items
+     */
+    class Counter {
+     public:
+      void increment(uint64_t amount = 1) {
+        value_.fetch_add(amount, std::memory_order_relaxed);
+      }
+
+      uint64_t value() const {
+        return value_.load(std::memory_order_relaxed);
+      }
+
+     private:
+      std::atomic<uint64_t> value_{0};
+    };
+
+    /**
+     * Value which goes up and down, such as the size of a queue
+     */
+    class Gauge {
+     public:
+      void set(int64_t value) {
+        value_.store(value, std::memory_order_relaxed);
+      }
+
+      void add(int64_t amount) {
+        value_.fetch_add(amount, std::memory_order_relaxed);
+      }
+
+      int64_t value() const {
+        return value_.load(std::memory_order_relaxed);
+      }
+
+     private:
+      std::atomic<int64_t> value_{0};
+    };
+
+    /**
+     * Distribution of values, such as latencies or sizes. Buckets are
+     * log-linear: each power of two is split into kSubBuckets buckets, so
+     * the value is known with an error of at most 25% without any
+     * configuration. Observation is a couple of relaxed atomic increments.
+     */
+    class Histogram {
+     public:
+      /// Number of buckets per power of two
+      static constexpr size_t kSubBuckets = 4;
+      /// Number of buckets covering all the 64 bit values
+      static constexpr size_t kBuckets = kSubBuckets * 63;
+
+      void observe(uint64_t value) {
+        buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+      }
+
+      /**
+       * Observe the number of microseconds elapsed since start
+       * @param start - time when the measured operation has started
+       */
+      void observeSince(std::chrono::steady_clock::time_point start) {
+        observe(std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count());
+      }
+
+      /// @return index of the bucket containing the value
+      static size_t bucketIndex(uint64_t value);
+
+      /// @return largest value of the bucket
+      static uint64_t bucketUpperBound(size_t index);
+
+      /// @return number of observations in the bucket
+      uint64_t bucketCount(size_t index) const {
+        return buckets_[index].load(std::memory_order_relaxed);
+      }
+
+      /// @return sum of observed values
+      uint64_t sum() const {
+        return sum_.load(std::memory_order_relaxed);
+      }
+
+     private:
+      std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+      std::atomic<uint64_t> sum_{0};
+    };
+
+    /**
+     * Named metrics of a process. Metrics are created once, usually when the
+     * component which updates them is constructed, and are never destroyed,
+     * so the returned references stay valid while the registry exists.
+     * Metrics with the same name and labels are shared.
+     */
+    class Registry {
+     public:
+      /**
+       * @param name - metric name, which must be the same for all the labels
+       * @param help - description of the metric
+       * @param labels - labels which distinguish the metric from the others
+       * with the same name
+       * @return the metric
+       * @throws std::invalid_argument if a metric of another type has the name
+       */
+      Counter &counter(const std::string &name,
+                       const std::string &help,
+                       const Labels &labels = {});
+
+      /// @see counter
+      Gauge &gauge(const std::string &name,
+                   const std::string &help,
+                   const Labels &labels = {});
+
+      /// @see counter
+      Histogram &histogram(const std::string &name,
+                           const std::string &help,
+                           const Labels &labels = {});
+
+      /**
+       * @return all the metrics in Prometheus text exposition format.
+       * Histogram buckets are listed up to the highest observed value.
+       */
+      std::string serialize() const;
+
+     private:
+      using Metric = std::variant<std::unique_ptr<Counter>,
+                                  std::unique_ptr<Gauge>,
+                                  std::unique_ptr<Histogram>>;
+
+      struct Family {
+        std::string type;
+        std::string help;
+        /// metrics by serialized labels
+        std::map<std::string, Metric> metrics;
+      };
+
+      template <typename T>
+      T &get(const std::string &name,
+             const std::string &help,
+             const Labels &labels);
+
+      mutable std::mutex mutex_;
+      std::map<std::string, Family> families_;
+    };
+
+    /**
+     * @return registry of the process, which is exported by irohad
+     */
+    Registry &registry();
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_HPP
@@ -0,0 +1,163 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics_exporter.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+#include <fmt/core.h>
+#include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+
+using namespace iroha::metrics;
+
+namespace {
+  /// Period of checking whether the exporter is stopped
+  constexpr int kPollTimeoutMs = 200;
+
+  /// Time a client is given to send its request
+  constexpr time_t kReceiveTimeoutSec = 1;
+
+  /// Requests are small, anything larger is not a scraper
+  constexpr size_t kMaxRequestSize = 8192;
+
+  void sendAll(int connection, const std::string &data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+      auto result = ::send(
+          connection, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+      if (result <= 0) {
+        return;
+      }
+      sent += result;
+    }
+  }
+
+  std::string response(const char *status,
+                       const char *content_type,
+                       const std::string &body) {
+    return fmt::format(
+        "HTTP/1.1 {}\r\nContent-Type: {}\r\nContent-Length: {}\r\n"
+        "Connection: close\r\n\r\n{}",
+        status,
+        content_type,
+        body.size(),
+        body);
+  }
+}  // namespace
+
+iroha::expected::Result<std::unique_ptr<MetricsExporter>, std::string>
+MetricsExporter::create(const Registry &registry,
+                        uint16_t port,
+                        logger::LoggerPtr log) {
+  auto fail = [](int socket, const char *action) {
+    auto error =
+        fmt::format("Failed to {} metrics socket: {}", action, strerror(errno));
+    if (socket >= 0) {
+      ::close(socket);
+    }
+    return error;
+  };
+
+  int socket = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (socket < 0) {
+    return fail(socket, "create");
+  }
+  int reuse = 1;
+  ::setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(port);
+  if (::bind(socket, reinterpret_cast<sockaddr *>(&address), sizeof(address))
+      != 0) {
+    return fail(socket, "bind");
+  }
+  if (::listen(socket, SOMAXCONN) != 0) {
+    return fail(socket, "listen on");
+  }
+  socklen_t address_size = sizeof(address);
+  if (::getsockname(
+          socket, reinterpret_cast<sockaddr *>(&address), &address_size)
+      != 0) {
+    return fail(socket, "get address of");
+  }
+
+  return std::unique_ptr<MetricsExporter>(new MetricsExporter(
+      registry, socket, ntohs(address.sin_port), std::move(log)));
+}
+
+MetricsExporter::MetricsExporter(const Registry &registry,
+                                 int socket,
+                                 uint16_t port,
+                                 logger::LoggerPtr log)
+    : registry_(registry),
+      socket_(socket),
+      port_(port),
+      log_(std::move(log)),
+      thread_([this] { serve(); }) {
+  log_->info("Serving metrics on 127.0.0.1:{}", port_);
+}
+
+MetricsExporter::~MetricsExporter() {
+  stopped_ = true;
+  thread_.join();
+  ::close(socket_);
+}
+
+uint16_t MetricsExporter::port() const {
+  return port_;
+}
+
+void MetricsExporter::serve() {
+  pollfd listening{socket_, POLLIN, 0};
+  while (not stopped_) {
+    if (::poll(&listening, 1, kPollTimeoutMs) <= 0) {
+      continue;
+    }
+    int connection = ::accept(socket_, nullptr, nullptr);
+    if (connection < 0) {
+      continue;
+    }
+    handle(connection);
+    ::close(connection);
+  }
+}
+
+void MetricsExporter::handle(int connection) {
+  timeval timeout{kReceiveTimeoutSec, 0};
+  ::setsockopt(
+      connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  std::string request;
+  char buffer[1024];
+  while (request.find("\r\n\r\n") == std::string::npos
+         and request.size() < kMaxRequestSize) {
+    auto received = ::recv(connection, buffer, sizeof(buffer), 0);
+    if (received <= 0) {
+      return;
+    }
+    request.append(buffer, received);
+  }
+
+  auto request_line = request.substr(0, request.find("\r\n"));
+  if (request_line.rfind("GET /metrics ", 0) == 0
+      or request_line.rfind("GET /metrics?", 0) == 0) {
+    sendAll(connection,
+            response("200 OK",
+                     "text/plain; version=0.0.4",
+                     registry_.serialize()));
+  } else {
+    log_->debug("Unexpected metrics request: {}", request_line);
+    sendAll(connection, response("404 Not Found", "text/plain", "Not Found\n"));
+  }
+}
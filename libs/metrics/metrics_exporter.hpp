@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_EXPORTER_HPP
+#define IROHA_METRICS_EXPORTER_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    class Registry;
+
+    /**
+     * HTTP endpoint on the loopback interface, which serves the metrics of a
+     * registry in Prometheus text format at /metrics. Requests are handled
+     * one by one on a dedicated thread, which is enough for a scraper.
+     */
+    class MetricsExporter {
+     public:
+      /**
+       * Start listening on the port
+       * @param registry - metrics to serve, must outlive the exporter
+       * @param port - local port, or 0 to pick a free one
+       * @param log - logger
+       * @return started exporter or error description
+       */
+      static expected::Result<std::unique_ptr<MetricsExporter>, std::string>
+      create(const Registry &registry, uint16_t port, logger::LoggerPtr log);
+
+      /// Stops serving and joins the thread
+      ~MetricsExporter();
+
+      MetricsExporter(const MetricsExporter &) = delete;
+      MetricsExporter &operator=(const MetricsExporter &) = delete;
+
+      /// @return port the exporter listens on
+      uint16_t port() const;
+
+     private:
+      MetricsExporter(const Registry &registry,
+                      int socket,
+                      uint16_t port,
+                      logger::LoggerPtr log);
+
+      void serve();
+
+      void handle(int connection);
+
+      const Registry &registry_;
+      const int socket_;
+      const uint16_t port_;
+      logger::LoggerPtr log_;
+      std::atomic<bool> stopped_{false};
+      std::thread thread_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_EXPORTER_HPP
@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/transaction_stages.hpp"
+
+#include "cryptography/hash.hpp"
+#include "metrics/metrics.hpp"
+
+using namespace iroha::metrics;
+
+namespace {
+  const char *stageName(TransactionStages::Stage stage) {
+    switch (stage) {
+      case TransactionStages::kStatelessValidation:
+        return "stateless_validation";
+      case TransactionStages::kOrdering:
+        return "ordering";
+      case TransactionStages::kProposal:
+        return "proposal";
+      case TransactionStages::kStatefulValidation:
+        return "stateful_validation";
+      case TransactionStages::kConsensus:
+        return "consensus";
+      case TransactionStages::kCommit:
+        return "commit";
+      default:
+        return "unknown";
+    }
+  }
+}  // namespace
+
+TransactionStages::TransactionStages(Registry &registry)
+    : total_time_(registry.histogram(
+        "iroha_transaction_latency_microseconds",
+        "Time from submission of a transaction to the peer until its "
+        "commit")) {
+  for (size_t i = 0; i < kStagesCount; ++i) {
+    stage_time_[i] = &registry.histogram(
+        "iroha_transaction_stage_microseconds",
+        "Time which a transaction submitted to the peer spends in a stage "
+        "of the pipeline",
+        {{"stage", stageName(static_cast<Stage>(i))}});
+  }
+}
+
+void TransactionStages::enable() {
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+bool TransactionStages::enabled() const {
+  return enabled_.load(std::memory_order_relaxed);
+}
+
+TransactionStages::Shard &TransactionStages::shardOf(const HashKey &key) {
+  return shards_[HashKey::Hasher{}(key) % kShardsCount];
+}
+
+void TransactionStages::submitted(
+    const shared_model::crypto::Hash &hash,
+    std::chrono::steady_clock::time_point submitted) {
+  if (not enabled()) {
+    return;
+  }
+  auto key = HashKey::fromHash(hash);
+  if (not key) {
+    return;
+  }
+  auto &shard = shardOf(*key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto inserted = shard.entries.emplace(
+      *key, Entry{submitted, submitted, kStatelessValidation, {}});
+  if (not inserted.second) {
+    return;
+  }
+  inserted.first->second.position =
+      shard.submission_order.insert(shard.submission_order.end(), *key);
+  if (shard.submission_order.size() > kMaxTracked / kShardsCount) {
+    shard.entries.erase(shard.submission_order.front());
+    shard.submission_order.pop_front();
+  }
+}
+
+void TransactionStages::finished(const shared_model::crypto::Hash &hash,
+                                 Stage stage) {
+  if (not enabled()) {
+    return;
+  }
+  auto key = HashKey::fromHash(hash);
+  if (not key) {
+    return;
+  }
+  const auto now = std::chrono::steady_clock::now();
+  auto since = [now](std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(now - start)
+        .count();
+  };
+
+  auto &shard = shardOf(*key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.entries.find(*key);
+  if (it == shard.entries.end() or stage < it->second.next_stage) {
+    return;
+  }
+  stage_time_[stage]->observe(since(it->second.last_stage_end));
+  if (stage == kCommit) {
+    total_time_.observe(since(it->second.submitted));
+    shard.submission_order.erase(it->second.position);
+    shard.entries.erase(it);
+    return;
+  }
+  it->second.last_stage_end = now;
+  it->second.next_stage = static_cast<Stage>(stage + 1);
+}
+
+size_t TransactionStages::size() const {
+  size_t size = 0;
+  for (const auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size += shard.entries.size();
+  }
+  return size;
+}
+
+TransactionStages &iroha::metrics::transactionStages() {
+  static TransactionStages stages(registry());
+  return stages;
+}
@@ -0,0 +1,127 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_TRANSACTION_STAGES_HPP
+#define IROHA_METRICS_TRANSACTION_STAGES_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "cryptography/hash_key.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    class Histogram;
+    class Registry;
+
+    /**
+     * Time which transactions spend in the stages of the pipeline of a peer,
+     * measured with the steady clock of the peer. A transaction is tracked
+     * from its submission to the peer until its commit, keyed by its hash.
+     * When the transaction finishes a stage, the time since the end of the
+     * previous one is observed in a histogram labelled with the stage. Stages
+     * which a transaction passes on other peers, such as ordering, are not
+     * marked and count towards the next marked stage.
+     *
+     * Tracking is off until enable() is called, which is done when the
+     * metrics are exported, so that the pipeline pays only for an atomic load
+     * otherwise. Tracked transactions are split into shards by hash, each
+     * with its own lock.
+     */
+    class TransactionStages {
+     public:
+      /// Stages in the order they are passed by a transaction
+      enum Stage {
+        kStatelessValidation,
+        kOrdering,
+        kProposal,
+        kStatefulValidation,
+        kConsensus,
+        kCommit,
+        kStagesCount
+      };
+
+      /**
+       * Maximal number of tracked transactions. The transactions which are
+       * tracked for the longest time in a shard are forgotten on its
+       * overflow, so the ones which are never committed do not accumulate.
+       */
+      static constexpr size_t kMaxTracked = 100000;
+
+      /// Number of independently locked shards of tracked transactions
+      static constexpr size_t kShardsCount = 16;
+
+      /// @param registry - registry of the histograms
+      explicit TransactionStages(Registry &registry);
+
+      /// Start tracking transactions
+      void enable();
+
+      /// @return whether transactions are tracked
+      bool enabled() const;
+
+      /**
+       * Start tracking a submitted transaction
+       * @param hash - hash of the transaction
+       * @param submitted - time of the submission
+       */
+      void submitted(const shared_model::crypto::Hash &hash,
+                     std::chrono::steady_clock::time_point submitted);
+
+      /**
+       * Mark the end of a stage of a transaction. Transactions which are not
+       * tracked, or already passed the stage, are ignored. The transaction is
+       * no longer tracked after kCommit.
+       * @param hash - hash of the transaction
+       * @param stage - stage which the transaction has finished
+       */
+      void finished(const shared_model::crypto::Hash &hash, Stage stage);
+
+      /// @return number of tracked transactions
+      size_t size() const;
+
+     private:
+      using HashKey = shared_model::crypto::HashKey;
+
+      struct Entry {
+        std::chrono::steady_clock::time_point submitted;
+        std::chrono::steady_clock::time_point last_stage_end;
+        Stage next_stage;
+        /// position in submission_order of the shard
+        std::list<HashKey>::iterator position;
+      };
+
+      struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<HashKey, Entry, HashKey::Hasher> entries;
+        /// hashes of the entries in the order of submission
+        std::list<HashKey> submission_order;
+      };
+
+      /// @return shard of the key
+      Shard &shardOf(const HashKey &key);
+
+      std::array<Histogram *, kStagesCount> stage_time_;
+      Histogram &total_time_;
+
+      std::atomic<bool> enabled_{false};
+      std::array<Shard, kShardsCount> shards_;
+    };
+
+    /**
+     * @return transaction stages of the process, which are observed in the
+     * process wide registry
+     */
+    TransactionStages &transactionStages();
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_TRANSACTION_STAGES_HPP
@@ -9,6 +9,7 @@
 #include "interfaces/iroha_internal/block.hpp"
 
 #include "block.pb.h"
+#include "interfaces/common_objects/byte_range.hpp"
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
@@ -22,6 +23,15 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Create block from the transport parsed from wire bytes. The wire
+       * bytes are kept as the blob, so that the transport is not serialized
+       * again for hashing or sending.
+       * @param ref - transport parsed from wire
+       * @param wire - serialized transport
+       */
+      Block(TransportType &&ref, interface::types::ByteRange wire);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
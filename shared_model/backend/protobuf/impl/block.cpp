@@ -5,11 +5,56 @@
 
 #include "backend/protobuf/block.hpp"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <boost/optional.hpp>
 #include <boost/range/adaptors.hpp>
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
 #include "common/byteutils.hpp"
+#include "utils/lazy_initializer.hpp"
+
+namespace {
+  /**
+   * Find serialized payload in serialized Block_v1
+   * @return payload bytes, or none if they cannot be located unambiguously
+   */
+  boost::optional<shared_model::interface::types::ByteRange> findPayload(
+      shared_model::interface::types::ByteRange wire) {
+    using google::protobuf::internal::WireFormatLite;
+    google::protobuf::io::CodedInputStream input(
+        reinterpret_cast<const uint8_t *>(wire.data()),
+        static_cast<int>(wire.size()));
+    const auto payload_tag = WireFormatLite::MakeTag(
+        iroha::protocol::Block_v1::kPayloadFieldNumber,
+        WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+
+    boost::optional<shared_model::interface::types::ByteRange> payload;
+    while (auto tag = input.ReadTag()) {
+      if (tag != payload_tag) {
+        if (not WireFormatLite::SkipField(&input, tag)) {
+          return boost::none;
+        }
+        continue;
+      }
+      uint32_t length;
+      // repeated occurrences are merged by the parser
+      if (payload or not input.ReadVarint32(&length)) {
+        return boost::none;
+      }
+      const auto offset = static_cast<size_t>(input.CurrentPosition());
+      if (not input.Skip(static_cast<int>(length))) {
+        return boost::none;
+      }
+      payload = wire.substr(offset, length);
+    }
+    if (static_cast<size_t>(input.CurrentPosition()) != wire.size()) {
+      return boost::none;
+    }
+    return payload;
+  }
+}  // namespace
 
 namespace shared_model {
   namespace proto {
@@ -17,48 +62,80 @@ namespace shared_model {
     struct Block::Impl {
       explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
       explicit Impl(const TransportType &ref) : proto_(ref) {}
+      Impl(TransportType &&ref, interface::types::ByteRange wire)
+          : proto_(std::move(ref)) {
+        blob_.set(interface::types::BlobType(wire));
+        if (auto payload = findPayload(wire)) {
+          payload_blob_.set(interface::types::BlobType(*payload));
+        }
+      }
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
       TransportType proto_;
       iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
 
-      std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
-      }()};
-
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
-
-      interface::types::HashType prev_hash_{[this] {
-        return interface::types::HashType(
-            crypto::Hash::fromHexString(proto_.payload().prev_block_hash()));
-      }()};
-
-      SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_.mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }()};
-
-      std::vector<interface::types::HashType> rejected_transactions_hashes_{
-          [this] {
-            std::vector<interface::types::HashType> hashes;
-            for (const auto &hash :
-                 *payload_.mutable_rejected_transactions_hashes()) {
-              hashes.emplace_back(
-                  shared_model::crypto::Hash::fromHexString(hash));
-            }
-            return hashes;
-          }()};
-
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
-
-      interface::types::HashType hash_ = makeHash(payload_blob_);
+      // the fields below are generated on first access, so that callers do
+      // not pay for serialization and hashing they do not need
+
+      std::vector<proto::Transaction> &transactions() {
+        return transactions_.get([this] {
+          return std::vector<proto::Transaction>(
+              payload_.mutable_transactions()->begin(),
+              payload_.mutable_transactions()->end());
+        });
+      }
+
+      const interface::types::BlobType &blob() {
+        return blob_.get([this] { return makeBlob(proto_); });
+      }
+
+      const interface::types::HashType &prevHash() {
+        return prev_hash_.get([this] {
+          return interface::types::HashType(
+              crypto::Hash::fromHexString(proto_.payload().prev_block_hash()));
+        });
+      }
+
+      const SignatureSetType<proto::Signature> &signatures() {
+        return signatures_.get([this] {
+          auto signatures = *proto_.mutable_signatures()
+              | boost::adaptors::transformed(
+                                [](auto &x) { return proto::Signature(x); });
+          return SignatureSetType<proto::Signature>(signatures.begin(),
+                                                    signatures.end());
+        });
+      }
+
+      const std::vector<interface::types::HashType> &
+      rejectedTransactionsHashes() {
+        return rejected_transactions_hashes_.get([this] {
+          std::vector<interface::types::HashType> hashes;
+          for (const auto &hash :
+               *payload_.mutable_rejected_transactions_hashes()) {
+            hashes.emplace_back(
+                shared_model::crypto::Hash::fromHexString(hash));
+          }
+          return hashes;
+        });
+      }
+
+      const interface::types::BlobType &payloadBlob() {
+        return payload_blob_.get([this] { return makeBlob(payload_); });
+      }
+
+      const interface::types::HashType &hash() {
+        return hash_.get([this] { return makeHash(payloadBlob()); });
+      }
+
+      detail::LazyInitializer<std::vector<proto::Transaction>> transactions_;
+      detail::LazyInitializer<interface::types::BlobType> blob_;
+      detail::LazyInitializer<interface::types::HashType> prev_hash_;
+      detail::LazyInitializer<SignatureSetType<proto::Signature>> signatures_;
+      detail::LazyInitializer<std::vector<interface::types::HashType>>
+          rejected_transactions_hashes_;
+      detail::LazyInitializer<interface::types::BlobType> payload_blob_;
+      detail::LazyInitializer<interface::types::HashType> hash_;
     };
 
     Block::Block(Block &&o) noexcept = default;
@@ -71,8 +148,12 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(TransportType &&ref, interface::types::ByteRange wire) {
+      impl_ = std::make_unique<Block::Impl>(std::move(ref), wire);
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
-      return impl_->transactions_;
+      return impl_->transactions();
     }
 
     interface::types::HeightType Block::height() const {
@@ -80,27 +161,28 @@ namespace shared_model {
     }
 
     const interface::types::HashType &Block::prevHash() const {
-      return impl_->prev_hash_;
+      return impl_->prevHash();
     }
 
     const interface::types::BlobType &Block::blob() const {
-      return impl_->blob_;
+      return impl_->blob();
     }
 
     interface::types::SignatureRangeType Block::signatures() const {
-      return impl_->signatures_;
+      return impl_->signatures();
     }
 
     bool Block::addSignature(
         interface::types::SignedHexStringView signed_blob,
         interface::types::PublicKeyHexStringView public_key) {
       // if already has such signature
-      if (std::find_if(impl_->signatures_.begin(),
-                       impl_->signatures_.end(),
+      const auto &signatures = impl_->signatures();
+      if (std::find_if(signatures.begin(),
+                       signatures.end(),
                        [&public_key](const auto &signature) {
                          return signature.publicKey() == public_key;
                        })
-          != impl_->signatures_.end()) {
+          != signatures.end()) {
         return false;
       }
 
@@ -110,20 +192,14 @@ namespace shared_model {
       std::string_view const &public_key_string{public_key};
       sig->set_public_key(public_key_string.data(), public_key_string.size());
 
-      impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_.mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }();
-      impl_->blob_ = makeBlob(impl_->proto_);
+      impl_->signatures_.invalidate();
+      impl_->blob_.invalidate();
 
       return true;
     }
 
     const interface::types::HashType &Block::hash() const {
-      return impl_->hash_;
+      return impl_->hash();
     }
 
     interface::types::TimestampType Block::createdTime() const {
@@ -136,11 +212,11 @@ namespace shared_model {
 
     interface::types::HashCollectionType Block::rejected_transactions_hashes()
         const {
-      return impl_->rejected_transactions_hashes_;
+      return impl_->rejectedTransactionsHashes();
     }
 
     const interface::types::BlobType &Block::payload() const {
-      return impl_->payload_blob_;
+      return impl_->payloadBlob();
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
@@ -10,6 +10,7 @@
 #include "backend/protobuf/commands/proto_command.hpp"
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/util.hpp"
+#include "utils/lazy_initializer.hpp"
 #include "utils/reference_holder.hpp"
 
 namespace shared_model {
@@ -30,39 +31,71 @@ namespace shared_model {
       iroha::protocol::Transaction::Payload::ReducedPayload &reduced_payload_{
           *proto_->mutable_payload()->mutable_reduced_payload()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
+      // the fields below are generated on first access, so that callers do
+      // not pay for serialization and hashing they do not need
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      using BatchMetaType =
+          std::optional<std::shared_ptr<interface::BatchMeta>>;
 
-      interface::types::BlobType reduced_payload_blob_{
-          [this] { return makeBlob(reduced_payload_); }()};
+      const interface::types::BlobType &blob() {
+        return blob_.get([this] { return makeBlob(*proto_); });
+      }
+
+      const interface::types::BlobType &payloadBlob() {
+        return payload_blob_.get([this] { return makeBlob(payload_); });
+      }
 
-      interface::types::HashType reduced_hash_{makeHash(reduced_payload_blob_)};
+      const interface::types::BlobType &reducedPayloadBlob() {
+        return reduced_payload_blob_.get(
+            [this] { return makeBlob(reduced_payload_); });
+      }
 
-      std::vector<proto::Command> commands_{
-          reduced_payload_.mutable_commands()->begin(),
-          reduced_payload_.mutable_commands()->end()};
+      const interface::types::HashType &reducedHash() {
+        return reduced_hash_.get(
+            [this] { return makeHash(reducedPayloadBlob()); });
+      }
 
-      std::optional<std::shared_ptr<interface::BatchMeta>> meta_{
-          [this]() -> std::optional<std::shared_ptr<interface::BatchMeta>> {
-            if (payload_.has_batch()) {
-              std::shared_ptr<interface::BatchMeta> b =
-                  std::make_shared<proto::BatchMeta>(*payload_.mutable_batch());
-              return b;
-            }
-            return std::nullopt;
-          }()};
+      const std::vector<proto::Command> &commands() {
+        return commands_.get([this] {
+          return std::vector<proto::Command>(
+              reduced_payload_.mutable_commands()->begin(),
+              reduced_payload_.mutable_commands()->end());
+        });
+      }
 
-      SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_->mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }()};
+      const BatchMetaType &meta() {
+        return meta_.get([this]() -> BatchMetaType {
+          if (payload_.has_batch()) {
+            std::shared_ptr<interface::BatchMeta> b =
+                std::make_shared<proto::BatchMeta>(*payload_.mutable_batch());
+            return b;
+          }
+          return std::nullopt;
+        });
+      }
+
+      const SignatureSetType<proto::Signature> &signatures() {
+        return signatures_.get([this] {
+          auto signatures = *proto_->mutable_signatures()
+              | boost::adaptors::transformed(
+                                [](auto &x) { return proto::Signature(x); });
+          return SignatureSetType<proto::Signature>(signatures.begin(),
+                                                    signatures.end());
+        });
+      }
+
+      const interface::types::HashType &hash() {
+        return hash_.get([this] { return makeHash(payloadBlob()); });
+      }
 
-      interface::types::HashType hash_{makeHash(payload_blob_)};
+      detail::LazyInitializer<interface::types::BlobType> blob_;
+      detail::LazyInitializer<interface::types::BlobType> payload_blob_;
+      detail::LazyInitializer<interface::types::BlobType> reduced_payload_blob_;
+      detail::LazyInitializer<interface::types::HashType> reduced_hash_;
+      detail::LazyInitializer<std::vector<proto::Command>> commands_;
+      detail::LazyInitializer<BatchMetaType> meta_;
+      detail::LazyInitializer<SignatureSetType<proto::Signature>> signatures_;
+      detail::LazyInitializer<interface::types::HashType> hash_;
     };
 
     Transaction::Transaction(const TransportType &transaction) {
@@ -93,39 +126,40 @@ namespace shared_model {
     }
 
     Transaction::CommandsType Transaction::commands() const {
-      return impl_->commands_;
+      return impl_->commands();
     }
 
     const interface::types::BlobType &Transaction::blob() const {
-      return impl_->blob_;
+      return impl_->blob();
     }
 
     const interface::types::BlobType &Transaction::payload() const {
-      return impl_->payload_blob_;
+      return impl_->payloadBlob();
     }
 
     const interface::types::BlobType &Transaction::reducedPayload() const {
-      return impl_->reduced_payload_blob_;
+      return impl_->reducedPayloadBlob();
     }
 
     interface::types::SignatureRangeType Transaction::signatures() const {
-      return impl_->signatures_;
+      return impl_->signatures();
     }
 
     const interface::types::HashType &Transaction::reducedHash() const {
-      return impl_->reduced_hash_;
+      return impl_->reducedHash();
     }
 
     bool Transaction::addSignature(
         interface::types::SignedHexStringView signed_blob,
         interface::types::PublicKeyHexStringView public_key) {
       // if already has such signature
-      if (std::find_if(impl_->signatures_.begin(),
-                       impl_->signatures_.end(),
+      const auto &signatures = impl_->signatures();
+      if (std::find_if(signatures.begin(),
+                       signatures.end(),
                        [&public_key](const auto &signature) {
                          return signature.publicKey() == public_key;
                        })
-          != impl_->signatures_.end()) {
+          != signatures.end()) {
         return false;
       }
 
@@ -135,20 +169,14 @@ namespace shared_model {
       std::string_view const &public_key_string{public_key};
       sig->set_public_key(public_key_string.data(), public_key_string.size());
 
-      impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_->mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }();
-      impl_->blob_ = makeBlob(*impl_->proto_);
+      impl_->signatures_.invalidate();
+      impl_->blob_.invalidate();
 
       return true;
     }
 
     const interface::types::HashType &Transaction::hash() const {
-      return impl_->hash_;
+      return impl_->hash();
     }
 
     const Transaction::TransportType &Transaction::getTransport() const {
@@ -165,7 +193,7 @@ namespace shared_model {
 
     std::optional<std::shared_ptr<interface::BatchMeta>>
     Transaction::batchMeta() const {
-      return impl_->meta_;
+      return impl_->meta();
     }
 
     std::unique_ptr<interface::Transaction> Transaction::moveTo() {
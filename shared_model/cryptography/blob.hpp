@@ -13,6 +13,7 @@
 #include "common/cloneable.hpp"
 #include "interfaces/base/model_primitive.hpp"
 #include "interfaces/common_objects/byte_range.hpp"
+#include "utils/lazy_initializer.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -46,6 +47,16 @@ namespace shared_model {
 
       explicit Blob(Bytes &&blob) noexcept;
 
+      Blob(const Blob &other);
+
+      Blob(Blob &&other) noexcept;
+
+      Blob &operator=(const Blob &other);
+
+      Blob &operator=(Blob &&other) noexcept;
+
+      ~Blob() override;
+
       /**
        * Creates new Blob object from provided hex string
        * @param hex - string in hex format to create Blob from
@@ -64,7 +75,8 @@ namespace shared_model {
 
       /**
        * @return provides human-readable representation of blob without leading
-       * 0x
+       * 0x, which is built on the first call. The reference stays valid for
+       * the lifetime of the blob, and its value follows assignments
        */
       virtual const std::string &hex() const;
 
@@ -82,7 +94,7 @@ namespace shared_model {
 
      private:
       Bytes blob_;
-      std::string hex_;
+      detail::LazyInitializer<std::string> hex_;
     };
 
   }  // namespace crypto
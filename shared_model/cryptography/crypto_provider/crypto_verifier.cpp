@@ -5,8 +5,12 @@
 
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 
+#include <algorithm>
+#include <future>
+
 #include "common/hexutils.hpp"
 #include "common/result.hpp"
+#include "common/thread_pool.hpp"
 #include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
 #include "interfaces/common_objects/byte_range.hpp"
 #include "multihash/multihash.hpp"
@@ -83,6 +87,26 @@ namespace {
           return verifyMultihash(signature, source, public_key);
         };
   }
+
+  /**
+   * Verify entries of a batch in range [begin, end)
+   * @param entries - batch entries
+   * @param begin - index of the first entry to verify
+   * @param end - index past the last entry to verify
+   * @param errors - errors of the failed entries are appended here
+   */
+  void verifyBatchRange(const std::vector<CryptoVerifier::BatchEntry> &entries,
+                        size_t begin,
+                        size_t end,
+                        CryptoVerifier::BatchErrors &errors) {
+    for (auto i = begin; i < end; ++i) {
+      const auto &entry = entries[i];
+      if (auto error = resultToOptionalError(CryptoVerifier::verify(
+              entry.signature, entry.source, entry.public_key))) {
+        errors.emplace_back(i, error.value());
+      }
+    }
+  }
 }  // namespace
 
 Result<void, const char *> CryptoVerifier::verify(
@@ -107,3 +131,44 @@ Result<void, const char *> CryptoVerifier::verify(
             };
       };
 }
+
+Result<void, CryptoVerifier::BatchErrors> CryptoVerifier::verifyBatch(
+    const std::vector<BatchEntry> &entries,
+    iroha::ThreadPool *pool,
+    size_t min_entries_per_thread) {
+  // the calling thread verifies a chunk too
+  const size_t threads = std::max<size_t>(
+      1,
+      std::min<size_t>(
+          pool ? pool->size() + 1 : 1,
+          entries.size() / std::max<size_t>(1, min_entries_per_thread)));
+  const size_t chunk_size = (entries.size() + threads - 1) / threads;
+  auto chunk_end = [&](size_t chunk) {
+    return std::min(entries.size(), (chunk + 1) * chunk_size);
+  };
+
+  // chunks are contiguous, so concatenated errors stay ordered by index
+  std::vector<BatchErrors> chunk_errors(threads);
+  std::vector<std::future<void>> verifications;
+  for (size_t chunk = 1; chunk < threads; ++chunk) {
+    verifications.push_back(pool->submit([&entries,
+                                          begin = chunk * chunk_size,
+                                          end = chunk_end(chunk),
+                                          &errors = chunk_errors[chunk]] {
+      verifyBatchRange(entries, begin, end, errors);
+    }));
+  }
+  verifyBatchRange(entries, 0, chunk_end(0), chunk_errors.front());
+  for (auto &verification : verifications) {
+    verification.get();
+  }
+
+  BatchErrors errors;
+  for (auto &chunk : chunk_errors) {
+    errors.insert(errors.end(), chunk.begin(), chunk.end());
+  }
+  if (errors.empty()) {
+    return Value<void>{};
+  }
+  return makeError(std::move(errors));
+}
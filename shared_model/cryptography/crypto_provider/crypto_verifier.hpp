@@ -6,9 +6,16 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
+#include <utility>
+#include <vector>
+
 #include "common/result_fwd.hpp"
 #include "interfaces/common_objects/string_view_types.hpp"
 
+namespace iroha {
+  class ThreadPool;
+}
+
 namespace shared_model {
   namespace crypto {
     class Blob;
@@ -33,6 +40,38 @@ namespace shared_model {
           const Blob &source,
           shared_model::interface::types::PublicKeyHexStringView public_key);
 
+      /// Signature, signed data and public key to be verified in a batch
+      struct BatchEntry {
+        shared_model::interface::types::SignedHexStringView signature;
+        const Blob &source;
+        shared_model::interface::types::PublicKeyHexStringView public_key;
+      };
+
+      /// Indices of batch entries which failed verification with error messages
+      using BatchErrors = std::vector<std::pair<size_t, const char *>>;
+
+      /// Default minimal number of batch entries verified by a single thread
+      static constexpr size_t kMinBatchEntriesPerThread = 32;
+
+      /**
+       * Verify several signatures at once. Large batches are split into
+       * chunks which are verified concurrently by the pool threads and the
+       * calling one
+       * @param entries - signatures with the data that was signed
+       * @param pool - threads verifying the chunks, the whole batch is
+       * verified by the calling thread if not set. Tasks of the pool must not
+       * wait for batch verification on the same pool
+       * @param min_entries_per_thread - batch is not split into chunks smaller
+       * than that, so that passing a chunk to the pool does not cost more than
+       * it saves
+       * @return a result of void if all signatures are correct, or indices of
+       * the failed entries in ascending order with error messages otherwise
+       */
+      static iroha::expected::Result<void, BatchErrors> verifyBatch(
+          const std::vector<BatchEntry> &entries,
+          iroha::ThreadPool *pool = nullptr,
+          size_t min_entries_per_thread = kMinBatchEntriesPerThread);
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
 
@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_HASH_KEY_HPP
+#define IROHA_SHARED_MODEL_HASH_KEY_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "interfaces/common_objects/byte_range.hpp"
+
+namespace shared_model {
+  namespace crypto {
+    class Hash;
+
+    /**
+     * Trivially copyable copy of a hash, which keeps its bytes inline. It is
+     * meant for the keys of large hash indexed containers, where a Hash costs
+     * a heap allocation per element.
+     */
+    class HashKey {
+     public:
+      /// Maximal number of stored bytes, which is the size of SHA3-256
+      static constexpr size_t kMaxSize = 32;
+
+      /**
+       * To calculate hash used by some standard containers
+       */
+      struct Hasher {
+        std::size_t operator()(const HashKey &key) const;
+      };
+
+      /**
+       * Create a key for a hash of unchecked size, e.g. received from the
+       * network
+       * @param hash - hash to be copied
+       * @return key of the hash or nullopt if the hash is longer than kMaxSize,
+       * in which case no container keyed by HashKey can hold it
+       */
+      static std::optional<HashKey> fromHash(const Hash &hash);
+
+      /**
+       * Use only for hashes of a known size, such as the locally computed
+       * transaction hashes; others go through fromHash
+       * @param hash - hash to be copied
+       * @throws std::invalid_argument if the hash is longer than kMaxSize
+       */
+      explicit HashKey(const Hash &hash);
+
+      /// @return range view on the stored bytes
+      interface::types::ByteRange range() const;
+
+      /**
+       * @return human-readable representation of the stored bytes without
+       * leading 0x, built on each call
+       */
+      std::string hex() const;
+
+      bool operator==(const HashKey &rhs) const;
+
+      bool operator!=(const HashKey &rhs) const;
+
+     private:
+      std::array<uint8_t, kMaxSize> bytes_;
+      uint8_t size_;
+    };
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_HASH_KEY_HPP
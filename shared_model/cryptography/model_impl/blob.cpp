@@ -19,9 +19,7 @@ namespace shared_model {
 
     Blob::Blob(const Bytes &blob) : Blob(Bytes(blob)) {}
 
-    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {
-      iroha::bytestringToHexstringAppend(range(), hex_);
-    }
+    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {}
 
     Blob::Blob(shared_model::interface::types::ByteRange range)
         : blob_(reinterpret_cast<const Bytes::value_type *>(range.data()),
@@ -29,9 +27,33 @@ namespace shared_model {
                     + range.size()) {
       static_assert(sizeof(range.data()[0]) == sizeof(Bytes::value_type),
                     "type mismatch");
-      iroha::bytestringToHexstringAppend(range, hex_);
     }
 
+    Blob::Blob(const Blob &other) : blob_(other.blob_) {}
+
+    Blob::Blob(Blob &&other) noexcept : blob_(std::move(other.blob_)) {
+      other.hex_.invalidate();
+    }
+
+    Blob &Blob::operator=(const Blob &other) {
+      if (this != &other) {
+        blob_ = other.blob_;
+        hex_.invalidate();
+      }
+      return *this;
+    }
+
+    Blob &Blob::operator=(Blob &&other) noexcept {
+      if (this != &other) {
+        blob_ = std::move(other.blob_);
+        hex_.invalidate();
+        other.hex_.invalidate();
+      }
+      return *this;
+    }
+
+    Blob::~Blob() = default;
+
     Blob *Blob::clone() const {
       return new Blob(blob());
     }
@@ -56,7 +78,11 @@ namespace shared_model {
     }
 
     const std::string &Blob::hex() const {
-      return hex_;
+      return hex_.get([this] {
+        std::string hex;
+        iroha::bytestringToHexstringAppend(range(), hex);
+        return hex;
+      });
     }
 
     size_t Blob::size() const {
@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/hash_key.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/hexutils.hpp"
+#include "cryptography/hash.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    static_assert(std::is_trivially_copyable_v<HashKey>,
+                  "HashKey must be copied without allocations");
+
+    std::optional<HashKey> HashKey::fromHash(const Hash &hash) {
+      if (hash.size() > kMaxSize) {
+        return std::nullopt;
+      }
+      return HashKey(hash);
+    }
+
+    HashKey::HashKey(const Hash &hash) : bytes_{}, size_(0) {
+      if (hash.size() > kMaxSize) {
+        throw std::invalid_argument(
+            "Hash of " + std::to_string(hash.size())
+            + " bytes does not fit a hash key of "
+            + std::to_string(kMaxSize) + " bytes");
+      }
+      size_ = static_cast<uint8_t>(hash.size());
+      std::copy_n(hash.blob().begin(), size_, bytes_.begin());
+    }
+
+    interface::types::ByteRange HashKey::range() const {
+      return interface::types::ByteRange{
+          reinterpret_cast<const std::byte *>(bytes_.data()), size_};
+    }
+
+    std::string HashKey::hex() const {
+      std::string hex;
+      iroha::bytestringToHexstringAppend(range(), hex);
+      return hex;
+    }
+
+    bool HashKey::operator==(const HashKey &rhs) const {
+      return size_ == rhs.size_
+          and std::equal(bytes_.begin(),
+                         bytes_.begin() + size_,
+                         rhs.bytes_.begin());
+    }
+
+    bool HashKey::operator!=(const HashKey &rhs) const {
+      return not(*this == rhs);
+    }
+
+    std::size_t HashKey::Hasher::operator()(const HashKey &key) const {
+      const auto range = key.range();
+      return std::hash<std::string_view>{}(
+          {reinterpret_cast<const char *>(range.data()), range.size()});
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
@@ -8,6 +8,7 @@
 #include <unordered_map>
 
 #include <fmt/core.h>
+#include <boost/range/adaptor/indirected.hpp>
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_helpers.hpp"
@@ -51,20 +52,31 @@ namespace shared_model {
             batches.push_back(std::move(value.value));
           };
 
+      // perform stateless validation checks
+      // signatures of all transactions are verified in one batch
+      std::vector<typename FieldValidator::SignedData> signed_data;
+      for (const auto &tx : transactions) {
+        if (not boost::empty(tx->signatures())) {
+          signed_data.emplace_back(tx->signatures(), tx->payload());
+        }
+      }
+      auto signature_errors = field_validator.validateSignatures(signed_data);
+      auto signature_error = signature_errors.begin();
+      auto tx_errors = transaction_validator.validateBatch(
+          transactions | boost::adaptors::indirected);
+
       validation::ValidationErrorCreator error_creator;
       if (transactions.empty()) {
         error_creator.addReason("Sequence is empty.");
       }
       for (auto tx : transactions | boost::adaptors::indexed(1)) {
         validation::ValidationErrorCreator tx_error_creator;
-        // perform stateless validation checks
         // check signatures validness
         if (not boost::empty(tx.value()->signatures())) {
-          tx_error_creator |= field_validator.validateSignatures(
-              tx.value()->signatures(), tx.value()->payload());
+          tx_error_creator |= std::move(*signature_error++);
         }
         // check transaction validness
-        tx_error_creator |= transaction_validator.validate(*tx.value());
+        tx_error_creator |= std::move(tx_errors[tx.index() - 1]);
 
         // if transaction is valid, try to form batch out of it
         if (auto meta = tx.value()->batchMeta()) {
@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LAZY_INITIALIZER_HPP
+#define IROHA_LAZY_INITIALIZER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+namespace shared_model {
+  namespace detail {
+    /**
+     * Value which is generated on first access. Concurrent accesses generate
+     * the value only once, the others wait for it. The holder adds a single
+     * atomic byte to the value; the generator is passed on access, so that
+     * it is not stored in each holder.
+     *
+     * The value object lives as long as the holder: invalidation only marks
+     * it for regeneration, so references to it never dangle.
+     * @tparam T type of stored value, which must be default constructible
+     */
+    template <typename T>
+    class LazyInitializer {
+      static_assert(std::is_default_constructible_v<T>,
+                    "LazyInitializer keeps a constructed value");
+
+     public:
+      LazyInitializer() = default;
+
+      LazyInitializer(const LazyInitializer &) = delete;
+      LazyInitializer &operator=(const LazyInitializer &) = delete;
+
+      /**
+       * @param generate - function returning the value, which is invoked if
+       * the value is not generated yet
+       * @return the value
+       */
+      template <typename Generator>
+      T &get(Generator &&generate) {
+        return getImpl(std::forward<Generator>(generate));
+      }
+
+      /// @see get
+      template <typename Generator>
+      const T &get(Generator &&generate) const {
+        return getImpl(std::forward<Generator>(generate));
+      }
+
+      /**
+       * Set the value without invoking a generator.
+       * Must not be called concurrently with other methods.
+       */
+      void set(T value) {
+        value_ = std::move(value);
+        state_.store(kReady, std::memory_order_release);
+      }
+
+      /**
+       * Mark the value to be generated again on next access.
+       * Must not be called concurrently with other methods.
+       */
+      void invalidate() {
+        state_.store(kEmpty, std::memory_order_release);
+      }
+
+     private:
+      enum State : uint8_t { kEmpty, kGenerating, kReady };
+
+      template <typename Generator>
+      T &getImpl(Generator &&generate) const {
+        for (auto state = state_.load(std::memory_order_acquire);
+             state != kReady;
+             state = state_.load(std::memory_order_acquire)) {
+          if (state == kEmpty
+              and state_.compare_exchange_strong(
+                      state, kGenerating, std::memory_order_acquire)) {
+            try {
+              value_ = std::forward<Generator>(generate)();
+            } catch (...) {
+              state_.store(kEmpty, std::memory_order_release);
+              throw;
+            }
+            state_.store(kReady, std::memory_order_release);
+            break;
+          }
+          // another thread generates the value
+          std::this_thread::yield();
+        }
+        return value_;
+      }
+
+      mutable std::atomic<uint8_t> state_{kEmpty};
+      mutable T value_{};
+    };
+  }  // namespace detail
+}  // namespace shared_model
+
+#endif  // IROHA_LAZY_INITIALIZER_HPP
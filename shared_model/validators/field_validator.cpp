@@ -124,7 +124,10 @@ namespace shared_model {
     FieldValidator::FieldValidator(std::shared_ptr<ValidatorsConfig> config,
                                    time_t future_gap,
                                    TimeFunction time_provider)
-        : future_gap_(future_gap), time_provider_(time_provider) {}
+        : future_gap_(future_gap),
+          time_provider_(time_provider),
+          signature_verification_pool_(
+              config ? config->signature_verification_pool : nullptr) {}
 
     std::optional<ValidationError> FieldValidator::validateAccountId(
         const interface::types::AccountIdType &account_id) const {
@@ -318,35 +321,71 @@ namespace shared_model {
     std::optional<ValidationError> FieldValidator::validateSignatures(
         const interface::types::SignatureRangeType &signatures,
         const crypto::Blob &source) const {
-      ValidationErrorCreator error_creator;
-      if (boost::empty(signatures)) {
-        error_creator.addReason("Signatures are empty.");
+      return validateSignatures({SignedData{signatures, source}}).front();
+    }
+
+    std::vector<std::optional<ValidationError>>
+    FieldValidator::validateSignatures(
+        const std::vector<SignedData> &signed_data) const {
+      using namespace shared_model::interface::types;
+
+      // well-formed signatures of all the objects are verified in one batch
+      std::vector<std::vector<std::optional<ValidationError>>> form_errors;
+      std::vector<crypto::CryptoVerifier::BatchEntry> batch;
+      form_errors.reserve(signed_data.size());
+      for (const auto &data : signed_data) {
+        auto &errors = form_errors.emplace_back();
+        for (const auto &signature : data.first) {
+          errors.push_back(validateSignatureForm(signature));
+          if (not errors.back()) {
+            batch.push_back({SignedHexStringView{signature.signedData()},
+                             data.second,
+                             PublicKeyHexStringView{signature.publicKey()}});
+          }
+        }
       }
+      auto batch_errors =
+          resultToOptionalError(crypto::CryptoVerifier::verifyBatch(
+                                    batch, signature_verification_pool_.get()))
+              .value_or(crypto::CryptoVerifier::BatchErrors{});
+
+      std::vector<std::optional<ValidationError>> result;
+      result.reserve(signed_data.size());
+      size_t batch_index = 0;
+      auto batch_error = batch_errors.begin();
+      for (size_t i = 0; i < signed_data.size(); ++i) {
+        const auto &signatures = signed_data[i].first;
+        ValidationErrorCreator error_creator;
+        if (boost::empty(signatures)) {
+          error_creator.addReason("Signatures are empty.");
+        }
 
-      for (auto signature : signatures | boost::adaptors::indexed(1)) {
-        ValidationErrorCreator sig_error_creator;
+        for (auto signature : signatures | boost::adaptors::indexed(1)) {
+          ValidationErrorCreator sig_error_creator;
 
-        auto sig_format_error = validateSignatureForm(signature.value());
-        sig_error_creator |= sig_format_error;
+          auto &sig_format_error = form_errors[i][signature.index() - 1];
+          sig_error_creator |= sig_format_error;
 
-        if (not sig_format_error) {
-          using namespace shared_model::interface::types;
-          if (auto e = resultToOptionalError(
-                  shared_model::crypto::CryptoVerifier::verify(
-                      SignedHexStringView{signature.value().signedData()},
-                      source,
-                      PublicKeyHexStringView{signature.value().publicKey()}))) {
-            sig_error_creator.addReason(e.value());
+          if (not sig_format_error) {
+            if (batch_error != batch_errors.end()
+                and batch_error->first == batch_index) {
+              sig_error_creator.addReason(batch_error->second);
+              ++batch_error;
+            }
+            ++batch_index;
           }
+          error_creator |=
+              std::move(sig_error_creator)
+                  .getValidationErrorWithGeneratedName([&] {
+                    return fmt::format("Signature #{} ({})",
+                                       signature.index(),
+                                       signature.value().toString());
+                  });
         }
-        error_creator |= std::move(sig_error_creator)
-                             .getValidationErrorWithGeneratedName([&] {
-                               return fmt::format("Signature #{} ({})",
-                                                  signature.index(),
-                                                  signature.value().toString());
-                             });
+        result.push_back(
+            std::move(error_creator).getValidationError("Signatures list"));
       }
-      return std::move(error_creator).getValidationError("Signatures list");
+      return result;
     }
 
     std::optional<ValidationError> FieldValidator::validateQueryPayloadMeta(
@@ -7,6 +7,7 @@
 #define IROHA_SHARED_MODEL_FIELD_VALIDATOR_HPP
 
 #include <regex>
+#include <vector>
 
 #include "cryptography/default_hash_provider.hpp"
 #include "datetime/time.hpp"
@@ -163,6 +164,19 @@ namespace shared_model {
           const interface::types::SignatureRangeType &signatures,
           const crypto::Blob &source) const;
 
+      /// Signatures of a signable object and its payload
+      using SignedData = std::pair<interface::types::SignatureRangeType,
+                                   const crypto::Blob &>;
+
+      /**
+       * Validate signatures of several objects, verifying all of them in one
+       * batch
+       * @param signed_data - signatures and payloads of the objects
+       * @return validation errors of the objects in the same order
+       */
+      std::vector<std::optional<ValidationError>> validateSignatures(
+          const std::vector<SignedData> &signed_data) const;
+
       std::optional<ValidationError> validateQueryPayloadMeta(
           const interface::QueryPayloadMeta &meta) const;
 
@@ -201,6 +215,8 @@ namespace shared_model {
       time_t future_gap_;
       // time provider callback
       TimeFunction time_provider_;
+      // threads verifying signatures of large batches, optional
+      std::shared_ptr<iroha::ThreadPool> signature_verification_pool_;
 
      public:
       // max-delay between tx creation and validation
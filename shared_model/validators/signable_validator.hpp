@@ -6,6 +6,8 @@
 #ifndef IROHA_SHARED_MODEL_SIGNABLE_VALIDATOR_HPP
 #define IROHA_SHARED_MODEL_SIGNABLE_VALIDATOR_HPP
 
+#include <vector>
+
 #include "validators/validation_error_helpers.hpp"
 
 namespace shared_model {
@@ -31,6 +33,36 @@ namespace shared_model {
         return std::move(error_creator).getValidationError("SignedData");
       }
 
+      template <typename Models, typename Validator>
+      std::vector<std::optional<ValidationError>> validateBatchImpl(
+          const Models &models, Validator &&validator) const {
+        auto signatures_checked = [](const Model &model) {
+          return SignatureRequired or not model.signatures().empty();
+        };
+
+        std::vector<typename FieldValidator::SignedData> signed_data;
+        for (const Model &model : models) {
+          if (signatures_checked(model)) {
+            signed_data.emplace_back(model.signatures(), model.payload());
+          }
+        }
+        auto signature_errors =
+            field_validator_.validateSignatures(signed_data);
+
+        std::vector<std::optional<ValidationError>> errors;
+        auto signature_error = signature_errors.begin();
+        for (const Model &model : models) {
+          ValidationErrorCreator error_creator;
+          error_creator |= validator(model);
+          if (signatures_checked(model)) {
+            error_creator |= std::move(*signature_error++);
+          }
+          errors.push_back(
+              std::move(error_creator).getValidationError("SignedData"));
+        }
+        return errors;
+      }
+
       explicit SignableModelValidator(std::shared_ptr<ValidatorsConfig> config,
                                       FieldValidator &&validator)
           : ModelValidator(config), field_validator_(std::move(validator)) {}
@@ -52,6 +84,31 @@ namespace shared_model {
             model, [&](const Model &m) { return ModelValidator::validate(m); });
       }
 
+      /**
+       * Validate several models, verifying signatures of all of them in one
+       * batch
+       * @param models - range of models to validate
+       * @param current_timestamp - timestamp to validate the models against
+       * @return validation errors of the models in the same order
+       */
+      template <typename Models>
+      std::vector<std::optional<ValidationError>> validateBatch(
+          const Models &models,
+          interface::types::TimestampType current_timestamp) const {
+        return validateBatchImpl(
+            models, [&, current_timestamp](const Model &m) {
+              return ModelValidator::validate(m, current_timestamp);
+            });
+      }
+
+      template <typename Models>
+      std::vector<std::optional<ValidationError>> validateBatch(
+          const Models &models) const {
+        return validateBatchImpl(models, [&](const Model &m) {
+          return ModelValidator::validate(m);
+        });
+      }
+
      private:
       FieldValidator field_validator_;
     };
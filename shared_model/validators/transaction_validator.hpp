@@ -6,6 +6,8 @@
 #ifndef IROHA_SHARED_MODEL_TRANSACTION_VALIDATOR_HPP
 #define IROHA_SHARED_MODEL_TRANSACTION_VALIDATOR_HPP
 
+#include <vector>
+
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/variant.hpp>
 
@@ -340,6 +342,23 @@ namespace shared_model {
         });
       }
 
+      /**
+       * Validates several transactions
+       * @param txs - range of transactions to validate
+       * @param args - current timestamp, if transactions should be validated
+       * against it instead of time provider
+       * @return validation errors of the transactions in the same order
+       */
+      template <typename Transactions, typename... Args>
+      std::vector<std::optional<ValidationError>> validateBatch(
+          const Transactions &txs, const Args &... args) const {
+        std::vector<std::optional<ValidationError>> errors;
+        for (const auto &tx : txs) {
+          errors.push_back(TransactionValidator::validate(tx, args...));
+        }
+        return errors;
+      }
+
      protected:
       FieldValidator field_validator_;
       CommandValidator command_validator_visitor_;
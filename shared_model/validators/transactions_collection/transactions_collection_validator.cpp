@@ -38,14 +38,14 @@ namespace shared_model {
     template <typename TransactionValidator,
               typename OrderValidator,
               bool CollectionCanBeEmpty>
-    template <typename Validator>
     std::optional<ValidationError>
     TransactionsCollectionValidator<TransactionValidator,
                                     OrderValidator,
                                     CollectionCanBeEmpty>::
         validateImpl(const interface::types::TransactionsForwardCollectionType
                          &transactions,
-                     Validator &&validator) const {
+                     std::vector<std::optional<ValidationError>> tx_errors)
+            const {
       ValidationErrorCreator error_creator;
 
       if (boost::empty(transactions)) {
@@ -69,7 +69,7 @@ namespace shared_model {
                 "Duplicates transaction #{}.", emplace_result.first->second));
           }
         }
-        tx_error_creator |= std::forward<Validator>(validator)(tx.value());
+        tx_error_creator |= std::move(tx_errors[tx.index() - 1]);
         error_creator |=
             std::move(tx_error_creator)
                 .getValidationErrorWithGeneratedName([&] {
@@ -96,9 +96,8 @@ namespace shared_model {
         CollectionCanBeEmpty>::validate(const shared_model::interface::types::
                                             TransactionsForwardCollectionType
                                                 &transactions) const {
-      return validateImpl(transactions, [this](const auto &tx) {
-        return transaction_validator_.validate(tx);
-      });
+      return validateImpl(transactions,
+                          transaction_validator_.validateBatch(transactions));
     }
 
     template <typename TransactionValidator,
@@ -123,10 +122,9 @@ namespace shared_model {
         validate(const interface::types::TransactionsForwardCollectionType
                      &transactions,
                  interface::types::TimestampType current_timestamp) const {
-      return validateImpl(
-          transactions, [this, current_timestamp](const auto &tx) {
-            return transaction_validator_.validate(tx, current_timestamp);
-          });
+      return validateImpl(transactions,
+                          transaction_validator_.validateBatch(
+                              transactions, current_timestamp));
     }
 
     template <typename TransactionValidator,
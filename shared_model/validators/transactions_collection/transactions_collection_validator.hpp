@@ -28,11 +28,10 @@ namespace shared_model {
       bool txs_duplicates_allowed_;
 
      private:
-      template <typename Validator>
       std::optional<ValidationError> validateImpl(
           const interface::types::TransactionsForwardCollectionType
               &transactions,
-          Validator &&validator) const;
+          std::vector<std::optional<ValidationError>> tx_errors) const;
 
      public:
       TransactionsCollectionValidator(std::shared_ptr<ValidatorsConfig> config);
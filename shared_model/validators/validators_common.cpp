@@ -10,12 +10,16 @@
 namespace shared_model {
   namespace validation {
 
-    ValidatorsConfig::ValidatorsConfig(uint64_t max_batch_size,
-                                       bool partial_ordered_batches_are_valid,
-                                       bool txs_duplicates_allowed)
+    ValidatorsConfig::ValidatorsConfig(
+        uint64_t max_batch_size,
+        bool partial_ordered_batches_are_valid,
+        bool txs_duplicates_allowed,
+        std::shared_ptr<iroha::ThreadPool> signature_verification_pool)
         : max_batch_size(max_batch_size),
           partial_ordered_batches_are_valid(partial_ordered_batches_are_valid),
-          txs_duplicates_allowed(txs_duplicates_allowed) {}
+          txs_duplicates_allowed(txs_duplicates_allowed),
+          signature_verification_pool(std::move(signature_verification_pool)) {
+    }
 
     bool validateHexString(const std::string &str) {
       static const std::regex hex_regex{R"([0-9a-fA-F]*)"};
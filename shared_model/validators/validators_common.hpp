@@ -6,8 +6,13 @@
 #ifndef IROHA_VALIDATORS_COMMON_HPP
 #define IROHA_VALIDATORS_COMMON_HPP
 
+#include <memory>
 #include <string>
 
+namespace iroha {
+  class ThreadPool;
+}
+
 namespace shared_model {
   namespace validation {
 
@@ -16,9 +21,12 @@ namespace shared_model {
      * A validator may read only specific fields.
      */
     struct ValidatorsConfig {
-      ValidatorsConfig(uint64_t max_batch_size,
-                       bool partial_ordered_batches_are_valid = false,
-                       bool txs_duplicates_allowed = false);
+      ValidatorsConfig(
+          uint64_t max_batch_size,
+          bool partial_ordered_batches_are_valid = false,
+          bool txs_duplicates_allowed = false,
+          std::shared_ptr<iroha::ThreadPool> signature_verification_pool =
+              nullptr);
       /// Maximum allowed amount of transactions within a batch
       const uint64_t max_batch_size;
 
@@ -34,6 +42,10 @@ namespace shared_model {
        * - BlockLoader
        */
       const bool txs_duplicates_allowed;
+
+      /// Threads verifying signatures of large batches, signatures are
+      /// verified by the validating thread if not set
+      const std::shared_ptr<iroha::ThreadPool> signature_verification_pool;
     };
 
     /**
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "common/result.hpp"
+#include "common/thread_pool.hpp"
+#include "cryptography/blob.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
+
+using namespace shared_model::crypto;
+using namespace shared_model::interface::types;
+
+/**
+ * Signatures of distinct payloads, each made with its own key, like
+ * signatures of transactions in a proposal
+ */
+class SignedPayloads {
+ public:
+  explicit SignedPayloads(size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      auto keypair = CryptoProviderEd25519Sha3::generateKeypair();
+      payloads_.emplace_back("payload #" + std::to_string(i));
+      signatures_.push_back(
+          CryptoProviderEd25519Sha3::sign(payloads_.back(), keypair));
+      public_keys_.push_back(keypair.publicKey());
+    }
+    for (size_t i = 0; i < size; ++i) {
+      entries_.push_back({SignedHexStringView{signatures_[i]},
+                          payloads_[i],
+                          PublicKeyHexStringView{public_keys_[i]}});
+    }
+  }
+
+  const std::vector<CryptoVerifier::BatchEntry> &entries() const {
+    return entries_;
+  }
+
+ private:
+  std::vector<Blob> payloads_;
+  std::vector<std::string> signatures_;
+  std::vector<std::string> public_keys_;
+  std::vector<CryptoVerifier::BatchEntry> entries_;
+};
+
+static void BM_VerifyOneByOne(benchmark::State &state) {
+  SignedPayloads signed_payloads(state.range(0));
+
+  while (state.KeepRunning()) {
+    for (const auto &entry : signed_payloads.entries()) {
+      benchmark::DoNotOptimize(CryptoVerifier::verify(
+          entry.signature, entry.source, entry.public_key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VerifyOneByOne)->RangeMultiplier(4)->Range(1, 1 << 12);
+
+static void BM_VerifyBatch(benchmark::State &state) {
+  SignedPayloads signed_payloads(state.range(0));
+  iroha::ThreadPool pool(std::thread::hardware_concurrency());
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        CryptoVerifier::verifyBatch(signed_payloads.entries(), &pool));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VerifyBatch)
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 12)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
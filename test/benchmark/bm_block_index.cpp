@@ -0,0 +1,165 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Each committed block is indexed by transaction hashes and by the accounts
+ * and assets of its transfers. The benchmarks measure the indexing part of
+ * the commit path depending on the number of transfers in a block, and how
+ * much of the commit path is left when the block is prepared in advance.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "common/result.hpp"
+#include "datetime/time.hpp"
+#include "framework/config_helper.hpp"
+#include "framework/test_logger.hpp"
+#include "main/impl/pg_connection_init.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+
+/**
+ * Block with the given number of transactions, each of which transfers an
+ * asset between different accounts
+ */
+static shared_model::proto::Block makeBlock(size_t transactions) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.reserve(transactions);
+  auto created_time = iroha::time::now();
+  for (size_t i = 0; i < transactions; ++i) {
+    const auto creator = "user" + std::to_string(i % 100) + "@domain";
+    const auto destination = "user" + std::to_string(i % 100 + 1) + "@domain";
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId(creator)
+                      .createdTime(created_time++)
+                      .transferAsset(
+                          creator, destination, "coin#domain", "", "1.00")
+                      .build());
+  }
+  return TestBlockBuilder()
+      .height(2)
+      .transactions(txs)
+      .prevHash(shared_model::crypto::Hash(std::string(32, '0')))
+      .build();
+}
+
+/**
+ * Index a block with range(0) transactions and flush the index
+ * @param state
+ */
+static void BM_IndexBlock(benchmark::State &state) {
+  PostgresOptions options(
+      "dbname=" + integration_framework::getRandomDbName() + " "
+          + integration_framework::getPostgresCredsOrDefault(),
+      integration_framework::kDefaultWorkingDatabaseName,
+      getTestLogger("PostgresOptions"));
+  if (auto error = iroha::expected::resultToOptionalError(
+          PgConnectionInit::prepareWorkingDatabase(
+              iroha::StartupWsvDataPolicy::kDrop, options))) {
+    state.SkipWithError(error->c_str());
+    return;
+  }
+
+  const auto block = makeBlock(state.range(0));
+  {
+    soci::session sql(*soci::factory_postgresql(),
+                      options.workingConnectionString());
+    PostgresBlockIndex block_index(std::make_unique<PostgresIndexer>(sql),
+                                   getTestLogger("PostgresBlockIndex"));
+    for (auto _ : state) {
+      state.PauseTiming();
+      sql << "BEGIN";
+      state.ResumeTiming();
+
+      // the index is flushed after each block
+      block_index.index(block);
+
+      state.PauseTiming();
+      sql << "ROLLBACK";
+      state.ResumeTiming();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+
+  PgConnectionInit::dropWorkingDatabase(options);
+}
+
+BENCHMARK(BM_IndexBlock)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * Commit a block with range(0) transactions, which is the step between
+ * consensus on the block and validation of the next proposal. If range(1) is
+ * set, the block is indexed in a prepared transaction beforehand, as the
+ * prepared state of a block is written during consensus, and only the
+ * commit of the prepared transaction is measured.
+ * @param state
+ */
+static void BM_CommitBlock(benchmark::State &state) {
+  PostgresOptions options(
+      "dbname=" + integration_framework::getRandomDbName() + " "
+          + integration_framework::getPostgresCredsOrDefault(),
+      integration_framework::kDefaultWorkingDatabaseName,
+      getTestLogger("PostgresOptions"));
+  if (auto error = iroha::expected::resultToOptionalError(
+          PgConnectionInit::prepareWorkingDatabase(
+              iroha::StartupWsvDataPolicy::kDrop, options))) {
+    state.SkipWithError(error->c_str());
+    return;
+  }
+
+  const auto block = makeBlock(state.range(0));
+  const bool prepared = state.range(1) != 0;
+  const std::string prepared_name = "bm_commit_block";
+  {
+    soci::session sql(*soci::factory_postgresql(),
+                      options.workingConnectionString());
+    PostgresBlockIndex block_index(std::make_unique<PostgresIndexer>(sql),
+                                   getTestLogger("PostgresBlockIndex"));
+    for (auto _ : state) {
+      state.PauseTiming();
+      sql << "TRUNCATE tx_positions, tx_positions_count, tx_status_by_hash";
+      if (prepared) {
+        sql << "BEGIN";
+        block_index.index(block);
+        sql << "PREPARE TRANSACTION '" + prepared_name + "'";
+      }
+      state.ResumeTiming();
+
+      if (prepared) {
+        sql << "COMMIT PREPARED '" + prepared_name + "'";
+      } else {
+        sql << "BEGIN";
+        block_index.index(block);
+        sql << "COMMIT";
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+
+  PgConnectionInit::dropWorkingDatabase(options);
+}
+
+BENCHMARK(BM_CommitBlock)
+    ->Args({100, 0})
+    ->Args({100, 1})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({10000, 0})
+    ->Args({10000, 1})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,189 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Ordering service and MST processor keep the batches which are not committed
+ * yet indexed by hashes of their transactions. The benchmarks measure the heap
+ * memory which the caches take per batch on top of the batches themselves,
+ * and compare the indices keyed by Hash and by HashKey.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <malloc.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <unordered_map>
+
+#include <gmock/gmock.h>
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "cryptography/hash_key.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/irohad/ordering/mock_proposal_creation_strategy.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "module/shared_model/validators/validators.hpp"
+#include "multi_sig_transactions/state/mst_state.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
+
+using namespace iroha::ordering;
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+static std::atomic<size_t> allocated_bytes{0};
+
+void *operator new(size_t size) {
+  if (auto *ptr = std::malloc(size)) {
+    allocated_bytes += malloc_usable_size(ptr);
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+  allocated_bytes -= malloc_usable_size(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  operator delete(ptr);
+}
+
+/// Single transaction batches, which need the given quorum to be completed
+static OnDemandOrderingService::CollectionType generateBatches(
+    size_t amount, shared_model::interface::types::QuorumType quorum) {
+  auto keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  auto now = iroha::time::now();
+  OnDemandOrderingService::CollectionType batches;
+  for (size_t i = 0; i < amount; ++i) {
+    batches.push_back(
+        std::make_shared<shared_model::interface::TransactionBatchImpl>(
+            shared_model::interface::types::SharedTxsCollectionType{
+                std::make_shared<shared_model::proto::Transaction>(
+                    shared_model::proto::TransactionBuilder()
+                        .createdTime(now + i)
+                        .creatorAccountId("foo@bar")
+                        .createAsset("asset", "domain", 1)
+                        .quorum(quorum)
+                        .build()
+                        .signAndAddSignature(keypair)
+                        .finish())}));
+  }
+  return batches;
+}
+
+/**
+ * Heap memory taken by the ordering service cache with range(0) batches
+ * @param state
+ */
+static void BM_OrderingCacheMemory(benchmark::State &state) {
+  const size_t amount = state.range(0);
+  size_t cache_bytes = 0;
+  for (auto _ : state) {
+    auto tx_cache =
+        std::make_unique<NiceMock<iroha::ametsuchi::MockTxPresenceCache>>();
+    ON_CALL(*tx_cache,
+            check(testing::Matcher<
+                  const shared_model::interface::TransactionBatch &>(_)))
+        .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+            iroha::ametsuchi::tx_cache_status_responses::Missing()}));
+    auto os = std::make_shared<OnDemandOrderingServiceImpl>(
+        amount,
+        std::make_unique<shared_model::proto::ProtoProposalFactory<
+            shared_model::validation::MockValidator<
+                shared_model::interface::Proposal>>>(
+            iroha::test::kTestsValidatorsConfig),
+        std::move(tx_cache),
+        std::make_shared<NiceMock<MockProposalCreationStrategy>>(),
+        getTestLogger("OdOrderingService"));
+    auto batches = generateBatches(amount, 1);
+
+    const size_t before = allocated_bytes;
+    os->onBatches(batches);
+    cache_bytes = allocated_bytes - before;
+  }
+  state.counters["bytes_per_batch"] =
+      static_cast<double>(cache_bytes) / amount;
+}
+
+/**
+ * Heap memory taken by the MST state with range(0) incomplete batches
+ * @param state
+ */
+static void BM_MstStateMemory(benchmark::State &state) {
+  const size_t amount = state.range(0);
+  size_t state_bytes = 0;
+  for (auto _ : state) {
+    auto batches = generateBatches(amount, 2);
+    auto completer = std::make_shared<iroha::DefaultCompleter>(
+        std::chrono::hours(24));
+
+    const size_t before = allocated_bytes;
+    auto mst_state =
+        iroha::MstState::empty(getTestLogger("MstState"), completer);
+    for (const auto &batch : batches) {
+      mst_state += batch;
+    }
+    state_bytes = allocated_bytes - before;
+  }
+  state.counters["bytes_per_batch"] =
+      static_cast<double>(state_bytes) / amount;
+}
+
+/**
+ * Heap memory taken by a transaction hash index with range(0) entries, which
+ * is keyed by Key
+ * @param state
+ */
+template <typename Key, typename Hasher>
+static void BM_HashIndexMemory(benchmark::State &state) {
+  const size_t amount = state.range(0);
+  size_t index_bytes = 0;
+  for (auto _ : state) {
+    auto batches = generateBatches(amount, 1);
+
+    const size_t before = allocated_bytes;
+    std::unordered_multimap<Key,
+                            OnDemandOrderingService::TransactionBatchType,
+                            Hasher>
+        index;
+    for (const auto &batch : batches) {
+      index.emplace(batch->transactions().front()->hash(), batch);
+    }
+    index_bytes = allocated_bytes - before;
+  }
+  state.counters["bytes_per_entry"] =
+      static_cast<double>(index_bytes) / amount;
+}
+
+BENCHMARK(BM_OrderingCacheMemory)
+    ->Arg(10000)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MstStateMemory)
+    ->Arg(10000)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HashIndexMemory,
+                   shared_model::crypto::Hash,
+                   shared_model::crypto::Hash::Hasher)
+    ->Arg(10000)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HashIndexMemory,
+                   shared_model::crypto::HashKey,
+                   shared_model::crypto::HashKey::Hasher)
+    ->Arg(10000)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,149 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Ordering service keeps batches which are not committed yet in a cache.
+ * Every commit removes the committed transactions from it, so the cost of the
+ * removal must depend on the size of the block rather than on the size of the
+ * cache.
+ *
+ * The benchmarks measure insertion of batches and removal of a committed block
+ * from caches of different sizes.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <gmock/gmock.h>
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/irohad/ordering/mock_proposal_creation_strategy.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "module/shared_model/validators/validators.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
+
+using namespace iroha::ordering;
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+/// number of transactions in a committed block
+constexpr size_t kBlockSize = 100;
+
+/**
+ * Ordering service with a given number of cached single transaction batches
+ * and a block of batches which are not cached yet
+ */
+class OnDemandOsBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &state) override {
+    auto tx_cache =
+        std::make_unique<NiceMock<iroha::ametsuchi::MockTxPresenceCache>>();
+    ON_CALL(*tx_cache,
+            check(testing::Matcher<
+                  const shared_model::interface::TransactionBatch &>(_)))
+        .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+            iroha::ametsuchi::tx_cache_status_responses::Missing()}));
+    auto proposal_creation_strategy =
+        std::make_shared<NiceMock<MockProposalCreationStrategy>>();
+
+    os = std::make_shared<OnDemandOrderingServiceImpl>(
+        kBlockSize,
+        std::make_unique<shared_model::proto::ProtoProposalFactory<
+            shared_model::validation::MockValidator<
+                shared_model::interface::Proposal>>>(
+            iroha::test::kTestsValidatorsConfig),
+        std::move(tx_cache),
+        proposal_creation_strategy,
+        getTestLogger("OdOrderingService"));
+
+    auto now = iroha::time::now();
+    os->onBatches(generateBatches(state.range(0), now));
+    block = generateBatches(kBlockSize, now + state.range(0));
+    for (const auto &batch : block) {
+      for (const auto &tx : batch->transactions()) {
+        block_hashes.insert(tx->hash());
+      }
+    }
+  }
+
+  void TearDown(benchmark::State &) override {
+    os.reset();
+    block.clear();
+    block_hashes.clear();
+  }
+
+  static OnDemandOrderingService::CollectionType generateBatches(
+      size_t amount, shared_model::interface::types::TimestampType from) {
+    // signatures are not checked by the ordering service
+    auto keypair =
+        shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+    OnDemandOrderingService::CollectionType batches;
+    for (size_t i = 0; i < amount; ++i) {
+      batches.push_back(
+          std::make_shared<shared_model::interface::TransactionBatchImpl>(
+              shared_model::interface::types::SharedTxsCollectionType{
+                  std::make_shared<shared_model::proto::Transaction>(
+                      shared_model::proto::TransactionBuilder()
+                          .createdTime(from + i)
+                          .creatorAccountId("foo@bar")
+                          .createAsset("asset", "domain", 1)
+                          .quorum(1)
+                          .build()
+                          .signAndAddSignature(keypair)
+                          .finish())}));
+    }
+    return batches;
+  }
+
+  std::shared_ptr<OnDemandOrderingService> os;
+  OnDemandOrderingService::CollectionType block;
+  OnDemandOrderingService::HashesSetType block_hashes;
+};
+
+/**
+ * Insertion of a block of batches to the cache
+ */
+BENCHMARK_DEFINE_F(OnDemandOsBenchmark, InsertBatches)
+(benchmark::State &state) {
+  for (auto _ : state) {
+    os->onBatches(block);
+
+    state.PauseTiming();
+    os->onTxsCommitted(block_hashes);
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * kBlockSize);
+}
+
+/**
+ * Removal of committed transactions of a block from the cache
+ */
+BENCHMARK_DEFINE_F(OnDemandOsBenchmark, RemoveCommitted)
+(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    os->onBatches(block);
+    state.ResumeTiming();
+
+    os->onTxsCommitted(block_hashes);
+  }
+  state.SetItemsProcessed(state.iterations() * kBlockSize);
+}
+
+BENCHMARK_REGISTER_F(OnDemandOsBenchmark, InsertBatches)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(OnDemandOsBenchmark, RemoveCommitted)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
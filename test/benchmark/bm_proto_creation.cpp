@@ -13,7 +13,9 @@
  * to blocks and proposals copying/moving.
  *
  * Each benchmark runs transaction() and commands() call to
- * initialize possibly lazy fields.
+ * initialize possibly lazy fields. Index and full access benchmarks compare
+ * the cost of a block when only the fields needed for indexing are accessed
+ * to the cost when every field is generated.
  */
 
 #include <benchmark/benchmark.h>
@@ -97,6 +99,40 @@ void checkLoop(const T &obj) {
   }
 }
 
+/**
+ * calls only the getters used to index a block, so that lazy fields which
+ * are not needed for indexing stay uninitialized
+ * @param block - block to index
+ */
+void indexLoop(const shared_model::interface::Block &block) {
+  benchmark::DoNotOptimize(block.height());
+  benchmark::DoNotOptimize(block.hash());
+  for (const auto &tx : block.transactions()) {
+    benchmark::DoNotOptimize(tx.hash());
+    benchmark::DoNotOptimize(tx.creatorAccountId());
+  }
+}
+
+/**
+ * calls all getters of a block and its transactions, so that every lazy
+ * field is initialized
+ * @param block - block to access
+ */
+void fullAccessLoop(const shared_model::interface::Block &block) {
+  indexLoop(block);
+  benchmark::DoNotOptimize(block.blob());
+  benchmark::DoNotOptimize(block.prevHash());
+  benchmark::DoNotOptimize(block.signatures());
+  benchmark::DoNotOptimize(block.rejected_transactions_hashes());
+  for (const auto &tx : block.transactions()) {
+    benchmark::DoNotOptimize(tx.blob());
+    benchmark::DoNotOptimize(tx.reducedHash());
+    benchmark::DoNotOptimize(tx.commands());
+    benchmark::DoNotOptimize(tx.signatures());
+    benchmark::DoNotOptimize(tx.batchMeta());
+  }
+}
+
 /**
  * Runs a function and updates timer of the given state
  */
@@ -141,6 +177,40 @@ BENCHMARK_DEFINE_F(BlockBenchmark, TransportMoveTest)(benchmark::State &st) {
   }
 }
 
+/**
+ * Benchmark block creation by moving protobuf object followed by accessing
+ * the fields required for block indexing
+ */
+BENCHMARK_DEFINE_F(BlockBenchmark, TransportMoveIndexTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    auto block = complete_builder.build();
+    auto proto_block = block.getTransport();
+
+    runBenchmark(st, [&proto_block] {
+      shared_model::proto::Block copy(std::move(proto_block));
+      indexLoop(copy);
+    });
+  }
+}
+
+/**
+ * Benchmark block creation by moving protobuf object followed by accessing
+ * all fields of the block
+ */
+BENCHMARK_DEFINE_F(BlockBenchmark, TransportMoveFullAccessTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    auto block = complete_builder.build();
+    auto proto_block = block.getTransport();
+
+    runBenchmark(st, [&proto_block] {
+      shared_model::proto::Block copy(std::move(proto_block));
+      fullAccessLoop(copy);
+    });
+  }
+}
+
 /**
  * Benchmark block creation by moving another block
  */
@@ -216,6 +286,9 @@ BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveIndexTest)->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveFullAccessTest)
+    ->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportMoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportCopyTest)->UseManualTime();
@@ -4,6 +4,7 @@
  */
 
 #include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 #include <boost/variant.hpp>
@@ -59,4 +60,69 @@ static void BM_QueryAccount(benchmark::State &state) {
 }
 BENCHMARK(BM_QueryAccount)->Unit(benchmark::kMicrosecond);
 
+/**
+ * This benchmark executes get account transactions query for the last page
+ * of the account history, in order to measure how the page lookup depends on
+ * the number of preceding transactions
+ */
+static void BM_QueryAccountTransactionsDeepPage(benchmark::State &state) {
+  const shared_model::interface::types::TransactionsNumberType kPageSize = 10;
+
+  integration_framework::IntegrationTestFramework itf(1);
+  itf.setInitialState(kAdminKeypair);
+  itf.sendTx(createUserWithPerms(
+                 kUser,
+                 PublicKeyHexStringView{kUserKeypair.publicKey()},
+                 kRole,
+                 {shared_model::interface::permissions::Role::kGetMyAccTxs,
+                  shared_model::interface::permissions::Role::kSetDetail})
+                 .build()
+                 .signAndAddSignature(kAdminKeypair)
+                 .finish());
+
+  itf.skipBlock().skipProposal();
+
+  std::vector<shared_model::crypto::Hash> hashes;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    auto tx = TestUnsignedTransactionBuilder()
+                  .creatorAccountId(kUserId)
+                  .createdTime(iroha::time::now())
+                  .quorum(1)
+                  .setAccountDetail(kUserId, "key", std::to_string(i))
+                  .build()
+                  .signAndAddSignature(kUserKeypair)
+                  .finish();
+    hashes.push_back(tx.hash());
+    itf.sendTxAwait(tx, [](const auto &) {});
+  }
+
+  auto make_query = [&]() {
+    return TestUnsignedQueryBuilder()
+        .createdTime(iroha::time::now())
+        .creatorAccountId(kUserId)
+        .queryCounter(1)
+        .getAccountTransactions(
+            kUserId, kPageSize, hashes.at(hashes.size() - kPageSize))
+        .build()
+        .signAndAddSignature(kUserKeypair)
+        .finish();
+  };
+
+  auto check = [](auto &status) {
+    boost::get<const shared_model::interface::TransactionsPageResponse &>(
+        status.get());
+  };
+
+  itf.sendQuery(make_query(), check);
+
+  while (state.KeepRunning()) {
+    itf.sendQuery(make_query());
+  }
+  itf.done();
+}
+BENCHMARK(BM_QueryAccountTransactionsDeepPage)
+    ->RangeMultiplier(10)
+    ->Range(100, 1000)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
@@ -221,7 +221,8 @@ namespace integration_framework {
             async_call_,
             makeTransportClientFactory<iroha::consensus::yac::NetworkImpl>(
                 client_factory_),
-            log_manager_->getChild("ConsensusTransport")->getLogger())),
+            log_manager_->getChild("ConsensusTransport")->getLogger(),
+            false)),
         cleanup_on_exit_(cleanup_on_exit) {
     // 1 h proposal_timeout results in non-deterministic behavior due to thread
     // scheduling and network
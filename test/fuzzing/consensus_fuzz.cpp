@@ -55,7 +55,8 @@ namespace fuzzing {
           async_call_,
           std::make_unique<iroha::network::MockClientFactory<
               iroha::consensus::yac::NetworkImpl::Service>>(),
-          logger::getDummyLoggerPtr());
+          logger::getDummyLoggerPtr(),
+          false);
 
       crypto_provider_ =
           std::make_shared<iroha::consensus::yac::CryptoProviderImpl>(
@@ -138,6 +138,7 @@ struct CommandFixture {
             transaction_batch_factory,
             rxcpp::observable<>::iterate(consensus_gate_objects_),
             2,
+            nullptr,
             logger::getDummyLoggerPtr());
   }
 };
@@ -163,7 +164,9 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size) {
       presense = std::make_optional(Missing{});
       break;
   }
-  EXPECT_CALL(*handler.bq_, checkTxPresence(_))
+  EXPECT_CALL(
+      *handler.bq_,
+      checkTxPresence(testing::Matcher<const shared_model::crypto::Hash &>(_)))
       .WillRepeatedly(Return(presense));
   iroha::protocol::TxStatusRequest tx;
   if (protobuf_mutator::libfuzzer::LoadProtoInput(
@@ -136,6 +136,7 @@ struct CommandFixture {
             transaction_batch_factory,
             rxcpp::observable<>::iterate(consensus_gate_objects_),
             2,
+            nullptr,
             logger::getDummyLoggerPtr());
   }
 };
@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "integration/acceptance/fake_peer_fixture.hpp"
+
+#include <chrono>
+
+#include <rxcpp/operators/rx-filter.hpp>
+#include <rxcpp/operators/rx-observe_on.hpp>
+#include <rxcpp/operators/rx-replay.hpp>
+#include <rxcpp/operators/rx-take.hpp>
+#include <rxcpp/operators/rx-timeout.hpp>
+#include "builders/protobuf/transaction.hpp"
+#include "consensus/yac/yac_hash_provider.hpp"
+#include "datetime/time.hpp"
+#include "framework/integration_framework/fake_peer/behaviour/honest.hpp"
+#include "framework/integration_framework/fake_peer/block_storage.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/block.hpp"
+#include "ordering/impl/on_demand_common.hpp"
+
+using namespace common_constants;
+using namespace integration_framework;
+
+static constexpr std::chrono::minutes kCatchUpWaitingTime(2);
+
+/// Fake peer which answers any vote with a commit of the top block
+struct CatchUpBehaviour : public fake_peer::HonestBehaviour {
+  explicit CatchUpBehaviour(iroha::consensus::yac::YacHash top_hash)
+      : top_hash_(std::move(top_hash)) {}
+
+  void processYacMessage(
+      std::shared_ptr<const fake_peer::YacMessage> message) override {
+    using iroha::operator|;
+    getFakePeer() | [&](auto fake_peer) {
+      fake_peer->sendYacState({fake_peer->makeVote(top_hash_)});
+    };
+  }
+
+  iroha::consensus::yac::YacHash top_hash_;
+};
+
+/**
+ * Chain of blocks with a single transaction each after the given genesis
+ * block, signed by the given fake peers
+ */
+static std::shared_ptr<fake_peer::BlockStorage> makeChain(
+    const shared_model::proto::Block &genesis_block,
+    size_t length,
+    const std::vector<std::shared_ptr<fake_peer::FakePeer>> &signers) {
+  auto block_storage =
+      std::make_shared<fake_peer::BlockStorage>(getTestLogger("BlockStorage"));
+  block_storage->storeBlock(clone(genesis_block));
+  auto prev_hash = genesis_block.hash();
+  for (size_t height = genesis_block.height() + 1; height <= length;
+       ++height) {
+    auto tx = shared_model::proto::TransactionBuilder()
+                  .creatorAccountId(kAdminId)
+                  .createdTime(iroha::time::now())
+                  .setAccountDetail(kAdminId, "height", std::to_string(height))
+                  .quorum(1)
+                  .build()
+                  .signAndAddSignature(kAdminKeypair)
+                  .finish();
+    auto block = shared_model::proto::BlockBuilder()
+                     .transactions(
+                         std::vector<shared_model::proto::Transaction>{tx})
+                     .height(height)
+                     .prevHash(prev_hash)
+                     .createdTime(iroha::time::now())
+                     .build();
+    for (const auto &signer : signers) {
+      block.signAndAddSignature(signer->getKeypair());
+    }
+    auto finished_block = block.finish();
+    prev_hash = finished_block.hash();
+    block_storage->storeBlock(clone(finished_block));
+  }
+  return block_storage;
+}
+
+/**
+ * A peer which falls behind the network downloads the missing blocks from
+ * the peers which signed the commit, several ranges at once. The catch up
+ * time is recorded as the catch_up_ms property of the test.
+ * @given fake peers which have a chain of many download ranges
+ * @when a fresh peer receives a commit of the top block
+ * @then it downloads and commits the whole chain
+ */
+TEST_F(FakePeerFixture, CatchUpWithLongChain) {
+  constexpr size_t kChainLength = 1000;
+  createFakePeers(4);
+  auto genesis_block = itf_->defaultBlock();
+  auto block_storage = makeChain(genesis_block, kChainLength, fake_peers_);
+  auto top_block = block_storage->getBlockByHeight(kChainLength);
+  for (auto &fake_peer : fake_peers_) {
+    fake_peer->setBlockStorage(block_storage);
+    fake_peer->setBehaviour(std::make_shared<CatchUpBehaviour>(
+        iroha::consensus::yac::YacHash{
+            iroha::consensus::Round{kChainLength,
+                                    iroha::ordering::kFirstRejectRound},
+            "proposal_hash",
+            top_block->hash().hex()}));
+  }
+
+  itf_->setGenesisBlock(genesis_block);
+  auto commits = itf_->getPcsOnCommitObservable().replay();
+  commits.connect();
+
+  const auto start = std::chrono::steady_clock::now();
+  itf_->subscribeQueuesAndRun();
+  bool caught_up = false;
+  commits
+      .filter([](const auto &sync_event) {
+        return sync_event.ledger_state->top_block_info.height >= kChainLength;
+      })
+      .take(1)
+      .timeout(kCatchUpWaitingTime, rxcpp::observe_on_new_thread())
+      .as_blocking()
+      .subscribe([&caught_up](const auto &) { caught_up = true; },
+                 [](std::exception_ptr) {});
+  ASSERT_TRUE(caught_up) << "the peer did not catch up with the chain";
+
+  RecordProperty(
+      "catch_up_ms",
+      static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count()));
+}
@@ -81,7 +81,8 @@ class ConsensusSunnyDayTest : public ::testing::Test {
         std::make_unique<
             iroha::network::ClientFactoryImpl<NetworkImpl::Service>>(
             iroha::network::getTestInsecureClientFactory()),
-        getTestLogger("YacNetwork"));
+        getTestLogger("YacNetwork"),
+        false);
     crypto = std::make_shared<MockYacCryptoProvider>(
         shared_model::interface::types::PublicKeyHexStringView{
             my_peer->pubkey()});
@@ -77,6 +77,28 @@ struct GetAccountDetailTest : public ExecutorTestBase {
     }
   }
 
+  /**
+   * Set new values of the details added with addDetails.
+   * @param num_accounts first writers, which
+   * @param num_keys_per_account set first keys again.
+   */
+  void rewriteDetails(const size_t num_accounts,
+                      const size_t num_keys_per_account) {
+    SCOPED_TRACE("rewriteDetails");
+    for (size_t acc = 0; acc < num_accounts; ++acc) {
+      auto &added_writer = added_data_[makeAccountId(acc)];
+      for (size_t key = 0; key < num_keys_per_account; ++key) {
+        const auto value = makeValue(acc, key) + "_rewritten";
+        IROHA_ASSERT_RESULT_VALUE(getItf().executeCommandAsAccount(
+            *getItf().getMockCommandFactory()->constructSetAccountDetail(
+                kUserId, makeKey(key), value),
+            makeAccountId(acc),
+            true));
+        added_writer[makeKey(key)] = value;
+      }
+    }
+  }
+
   std::unique_ptr<shared_model::interface::MockAccountDetailPaginationMeta>
   makePaginationMeta(
       TransactionsNumberType page_size,
@@ -452,6 +474,18 @@ TEST_P(GetAccountDetailRecordIdTest, LastPage) {
                                2);
 }
 
+/**
+ * @given account with 6 details from 3 writers, 2 unique keys from each,
+ * and all related permissions
+ * @when the details of the first 2 writers are set again with new values
+ * @then the rewritten details are counted once in the total number
+ */
+TEST_P(GetAccountDetailRecordIdTest, RewrittenDetailsAreCountedOnce) {
+  ASSERT_NO_FATAL_FAILURE(prepareState(3, 2));
+  ASSERT_NO_FATAL_FAILURE(rewriteDetails(2, 2));
+  queryPageAndValidateResponse(std::nullopt, 4);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     Base,
     GetAccountDetailRecordIdTest,
@@ -15,6 +15,7 @@
 #include "ametsuchi/impl/in_memory_block_storage_factory.hpp"
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "backend/protobuf/proto_permission_to_string.hpp"
@@ -107,6 +108,8 @@ namespace iroha {
                std::make_unique<InMemoryBlockStorageFactory>(),
                block_storage_,
                std::nullopt,
+               std::make_shared<WsvCache>(kWsvCacheSize),
+               nullptr,
                getTestLoggerManager()->getChild("Storage"));
          }
          |
@@ -226,6 +229,7 @@ namespace iroha {
           reconnection_strategy_factory_;
 
       static const int pool_size_ = 10;
+      static const size_t kWsvCacheSize = 100;
 
       // generate random valid dbname
       static std::string dbname_;
@@ -5,10 +5,13 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
+#include "ametsuchi/impl/wsv_snapshot.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
 #include "builders/protobuf/transaction.hpp"
@@ -506,6 +509,58 @@ TEST_F(AmetsuchiTest, TestRestoreWsvFromBlockStorage) {
   EXPECT_TRUE(res);
 }
 
+/**
+ * @given WSV and block storage after two blocks
+ * @when WSV snapshot is written @and read into empty WSV
+ * @then WSV has the state after the second block @and the second block is
+ * the top block of the snapshot
+ */
+TEST_F(AmetsuchiTest, WsvSnapshotRoundTrip) {
+  auto genesis_block = createBlock({getGenesisTx()});
+  auto block2 = createBlock({createAddAsset("5.00")}, 2, genesis_block->hash());
+  apply(storage, genesis_block);
+  apply(storage, block2);
+
+  std::stringstream snapshot;
+  IROHA_ASSERT_RESULT_VALUE(writeWsvSnapshot(*sql, *block2, snapshot));
+
+  truncateWsv();
+  *sql << "BEGIN";
+  auto top_block = readWsvSnapshot(*sql, snapshot);
+  *sql << "COMMIT";
+  IROHA_ASSERT_RESULT_VALUE(top_block);
+  EXPECT_EQ(top_block.assumeValue()->hash(), block2->hash());
+
+  shared_model::interface::Amount updated_qty("10.00");
+  validateAccountAsset(sql_query, kUserId, kAssetId, updated_qty);
+}
+
+/**
+ * @given WSV snapshot of a ledger with genesis block
+ * @when the snapshot is imported into empty storage
+ * @then ledger state and block storage continue from the snapshot top block
+ */
+TEST_F(AmetsuchiTest, ImportWsvSnapshot) {
+  auto genesis_block = createBlock({getGenesisTx()});
+  apply(storage, genesis_block);
+
+  std::stringstream snapshot;
+  IROHA_ASSERT_RESULT_VALUE(storage->exportWsvSnapshot(snapshot));
+
+  truncateWsv();
+  destroyWsvStorage();
+  block_storage_->clear();
+  initializeStorage();
+  ASSERT_EQ(storage->getLedgerState(), boost::none);
+
+  IROHA_ASSERT_RESULT_VALUE(storage->importWsvSnapshot(snapshot));
+  ASSERT_TRUE(storage->getLedgerState());
+  EXPECT_EQ(storage->getLedgerState().value()->top_block_info.top_hash,
+            genesis_block->hash());
+  EXPECT_EQ(storage->getBlockQuery()->getTopBlockHeight(), 1);
+  validateAccountAsset(sql_query, kUserId, kAssetId, base_balance);
+}
+
 class RestoreWsvTest : public AmetsuchiTest {
  public:
   using BlockPtr = decltype(createBlock({}));
@@ -537,14 +592,18 @@ class RestoreWsvTest : public AmetsuchiTest {
         << "Failed to rewrite block storage.";
   }
 
-  void restoreWsv() {
+  void restoreWsv(size_t replay_threads = 0,
+                  size_t bulk_load_min_blocks =
+                      WsvRestorerImpl::kDefaultBulkLoadMinBlocks) {
     auto chain_validator = std::make_shared<IdentityChainValidator>();
     auto interface_validator = std::make_unique<MockBlockIValidator>();
     auto proto_validator = std::make_unique<MockBlockPValidator>();
     WsvRestorerImpl wsvRestorer(std::move(interface_validator),
                                 std::move(proto_validator),
                                 chain_validator,
-                                getTestLogger("WsvRestorer"));
+                                getTestLogger("WsvRestorer"),
+                                replay_threads,
+                                bulk_load_min_blocks);
     wsvRestorer.restoreWsv(*storage, false)
         .match([](const auto &) {},
                [&](const auto &error) {
@@ -595,6 +654,96 @@ TEST_F(RestoreWsvTest, TestRestoreWsvFromBlockStorageReuseOlderState) {
   validateAccountAsset(sql_query, kUserId, kAssetId, updated_qty);
 }
 
+/**
+ * @given valid WSV matching genesis block. block store contains genesis block
+ * and several more blocks.
+ * @when WSV is restored from block storage with blocks prefetched by several
+ * threads
+ * @then the missing blocks are applied to WSV in order @and WSV is valid
+ */
+TEST_F(RestoreWsvTest, TestRestoreWsvWithPrefetch) {
+  auto genesis_block = createBlock({getGenesisTx()});
+  commitToWsvAndBlockStorage({genesis_block});
+
+  auto prev_hash = genesis_block->hash();
+  for (size_t height = 2; height <= 5; ++height) {
+    // amounts differ so that transactions have different hashes
+    auto block = createBlock({createAddAsset(std::to_string(height) + ".00")},
+                             height,
+                             prev_hash);
+    prev_hash = block->hash();
+    commitToBlockStorageOnly({block});
+  }
+
+  restoreWsv(3);
+  shared_model::interface::Amount updated_qty("19.00");
+  validateAccountAsset(sql_query, kUserId, kAssetId, updated_qty);
+  EXPECT_EQ((*storage->getLedgerState())->top_block_info.top_hash, prev_hash);
+}
+
+/**
+ * @given valid WSV matching genesis block. block store contains genesis block
+ * and several more blocks.
+ * @when WSV is restored from block storage in bulk mode
+ * @then the missing blocks are applied to WSV @and the transaction indices
+ * are recreated @and the transactions of the blocks are indexed
+ */
+TEST_F(RestoreWsvTest, TestRestoreWsvInBulkMode) {
+  auto genesis_block = createBlock({getGenesisTx()});
+  commitToWsvAndBlockStorage({genesis_block});
+  auto creator_transactions = [] {
+    long long count = 0;
+    *sql << "SELECT COALESCE(SUM(count), 0)::bigint FROM tx_positions_count "
+            "WHERE creator_id = :creator_id AND asset_id = ''",
+        soci::use(std::string{kUserId}), soci::into(count);
+    return count;
+  };
+  const auto initial_creator_transactions = creator_transactions();
+
+  auto prev_hash = genesis_block->hash();
+  std::vector<std::string> tx_hashes;
+  for (size_t height = 2; height <= 5; ++height) {
+    auto block = createBlock({createAddAsset(std::to_string(height) + ".00")},
+                             height,
+                             prev_hash);
+    prev_hash = block->hash();
+    tx_hashes.push_back(block->transactions().front().hash().hex());
+    commitToBlockStorageOnly({block});
+  }
+
+  restoreWsv(2, 1);
+  shared_model::interface::Amount updated_qty("19.00");
+  validateAccountAsset(sql_query, kUserId, kAssetId, updated_qty);
+  EXPECT_EQ((*storage->getLedgerState())->top_block_info.top_hash, prev_hash);
+
+  int indices = 0;
+  *sql << "SELECT count(*) FROM pg_indexes WHERE indexname IN "
+          "('tx_positions_hash_index', "
+          "'tx_positions_creator_id_asset_height_index', "
+          "'tx_positions_creator_id_asset_ts_index', "
+          "'tx_positions_ts_height_index_index', "
+          "'tx_status_by_hash_hash_index')",
+      soci::into(indices);
+  EXPECT_EQ(indices, 5);
+
+  for (const auto &hash : tx_hashes) {
+    int positions = 0;
+    *sql << "SELECT count(*) FROM tx_positions "
+            "WHERE hash = decode(:hash, 'hex')",
+        soci::use(hash), soci::into(positions);
+    EXPECT_GT(positions, 0) << hash;
+    auto tx_status = storage->getBlockQuery()->checkTxPresence(
+        shared_model::crypto::Hash::fromHexString(hash));
+    ASSERT_TRUE(tx_status) << hash;
+    EXPECT_TRUE(std::holds_alternative<tx_cache_status_responses::Committed>(
+        *tx_status))
+        << hash;
+  }
+  EXPECT_EQ(creator_transactions(),
+            initial_creator_transactions
+                + static_cast<long long>(tx_hashes.size()));
+}
+
 /**
  * @given valid WSV matching block storage
  * @when WSV is restored from block storage reusing present data
@@ -765,7 +914,8 @@ TEST_F(PreparedBlockTest, PrepareBlockNoStateChanged) {
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_FALSE(framework::expected::err(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv),
+                        createBlock({*initial_tx}, 2, genesis_block->hash()));
 
   // balance remains unchanged
   validateAccountAsset(sql_query, kUserId, kAssetId, base_balance);
@@ -774,16 +924,15 @@ TEST_F(PreparedBlockTest, PrepareBlockNoStateChanged) {
 /**
  * @given Storage with prepared state
  * @when prepared state is applied
- * @then state of the ledger is changed
+ * @then state of the ledger is changed @and the transactions of the block are
+ * indexed
  */
 TEST_F(PreparedBlockTest, CommitPreparedStateChanged) {
-  auto other_tx = createAddAsset("5.00");
-
-  auto block = createBlock({other_tx}, 2);
+  auto block = createBlock({*initial_tx}, 2, genesis_block->hash());
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_FALSE(framework::expected::err(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv), block);
 
   auto commited_res = storage->commitPrepared(block);
   IROHA_ASSERT_RESULT_VALUE(commited_res);
@@ -800,6 +949,34 @@ TEST_F(PreparedBlockTest, CommitPreparedStateChanged) {
   ASSERT_TRUE(top_block_info) << "Failed to get top block info.";
   EXPECT_EQ(top_block_info->height, ledger_state->top_block_info.height);
   EXPECT_EQ(top_block_info->top_hash, ledger_state->top_block_info.top_hash);
+  EXPECT_EQ(ledger_state->top_block_info.top_hash, block->hash());
+
+  auto tx_status =
+      storage->getBlockQuery()->checkTxPresence(initial_tx->hash());
+  ASSERT_TRUE(tx_status);
+  EXPECT_TRUE(
+      std::holds_alternative<tx_cache_status_responses::Committed>(*tx_status));
+}
+
+/**
+ * @given Storage with prepared state
+ * @when another block is committed with commitPrepared
+ * @then commitPrepared fails @and prepared state is rolled back
+ */
+TEST_F(PreparedBlockTest, CommitPreparedOtherBlockFails) {
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_FALSE(framework::expected::err(result));
+  storage->prepareBlock(std::move(temp_wsv),
+                        createBlock({*initial_tx}, 2, genesis_block->hash()));
+
+  auto other_block =
+      createBlock({createAddAsset("10.00")}, 2, genesis_block->hash());
+  EXPECT_TRUE(err(storage->commitPrepared(other_block)));
+  EXPECT_FALSE(storage->preparedCommitEnabled());
+
+  apply(storage, other_block);
+  shared_model::interface::Amount resultingBalance{"15.00"};
+  validateAccountAsset(sql_query, kUserId, kAssetId, resultingBalance);
 }
 
 /**
@@ -816,7 +993,8 @@ TEST_F(PreparedBlockTest, PrepareBlockCommitDifferentBlock) {
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_TRUE(val(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv),
+                        createBlock({*initial_tx}, 2, genesis_block->hash()));
 
   apply(storage, block);
 
@@ -840,7 +1018,8 @@ TEST_F(PreparedBlockTest, CommitPreparedFailsAfterCommit) {
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_FALSE(framework::expected::err(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv),
+                        createBlock({*initial_tx}, 2, genesis_block->hash()));
 
   apply(storage, block);
 
@@ -852,6 +1031,35 @@ TEST_F(PreparedBlockTest, CommitPreparedFailsAfterCommit) {
   validateAccountAsset(sql_query, kUserId, kAssetId, resultingBalance);
 }
 
+/**
+ * @given storage with the cache of committed state @and the quorum of the
+ * creator account is read to the cache by a temporary WSV
+ * @when a block raising the quorum is committed
+ * @then a transaction with the old number of signatures fails in a new
+ * temporary WSV
+ */
+TEST_F(PreparedBlockTest, CachedQuorumIsUpdatedOnCommit) {
+  ASSERT_TRUE(val(temp_wsv->apply(*initial_tx)));
+  temp_wsv.reset();
+
+  auto quorum_tx =
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId(kUserId)
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .addSignatory(
+              kUserId,
+              PublicKeyHexStringView{kSameDomainUserKeypair.publicKey()})
+          .setAccountQuorum(kUserId, 2)
+          .build()
+          .signAndAddSignature(kUserKeypair)
+          .finish();
+  apply(storage, createBlock({quorum_tx}, 2, genesis_block->hash()));
+
+  temp_wsv = storage->createTemporaryWsv(command_executor);
+  EXPECT_TRUE(err(temp_wsv->apply(createAddAsset("1.00"))));
+}
+
 /**
  * @given Storage with prepared state
  * @when another temporary wsv is created and transaction is applied
@@ -860,11 +1068,13 @@ TEST_F(PreparedBlockTest, CommitPreparedFailsAfterCommit) {
 TEST_F(PreparedBlockTest, TemporaryWsvUnlocks) {
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_TRUE(val(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv),
+                        createBlock({*initial_tx}, 2, genesis_block->hash()));
 
   temp_wsv = storage->createTemporaryWsv(command_executor);
 
   result = temp_wsv->apply(*initial_tx);
   ASSERT_TRUE(val(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv),
+                        createBlock({*initial_tx}, 2, genesis_block->hash()));
 }
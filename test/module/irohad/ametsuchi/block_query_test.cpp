@@ -42,7 +42,11 @@ class BlockQueryTest : public AmetsuchiTest {
     auto converter =
         std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
     auto block_storage_factory = std::make_unique<FlatFileBlockStorageFactory>(
-        []() { return block_store_path; }, converter, getTestLoggerManager());
+        []() { return block_store_path; },
+        converter,
+        FlatFileBlockFormat::kJson,
+        KeyValueStorageType::kFilePerBlock,
+        getTestLoggerManager());
     block_storage = block_storage_factory->create().assumeValue();
     blocks = std::make_shared<PostgresBlockQuery>(
         *sql, *block_storage, getTestLogger("BlockQuery"));
@@ -284,6 +288,32 @@ TEST_F(BlockQueryTest, HasTxWithRejectedHash) {
   });
 }
 
+/**
+ * @given block store with preinserted blocks
+ * @when checkTxPresence is invoked on committed, missing and rejected hashes
+ * at once
+ * @then their statuses are returned in the same order
+ */
+TEST_F(BlockQueryTest, HasTxWithSeveralHashes) {
+  shared_model::crypto::Hash missing_tx_hash(zero_string);
+  auto statuses = blocks->checkTxPresence(
+      std::vector<shared_model::crypto::Hash>{
+          tx_hashes.at(0), missing_tx_hash, rejected_hash});
+  ASSERT_TRUE(statuses);
+  ASSERT_EQ(statuses->size(), 3);
+  ASSERT_NO_THROW({
+    EXPECT_EQ(
+        std::get<tx_cache_status_responses::Committed>(statuses->at(0)).hash,
+        tx_hashes.at(0));
+    EXPECT_EQ(
+        std::get<tx_cache_status_responses::Missing>(statuses->at(1)).hash,
+        missing_tx_hash);
+    EXPECT_EQ(
+        std::get<tx_cache_status_responses::Rejected>(statuses->at(2)).hash,
+        rejected_hash);
+  });
+}
+
 /**
  * @given block store with preinserted blocks
  * @when getTopBlock is invoked on this block store
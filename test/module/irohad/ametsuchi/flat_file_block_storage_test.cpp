@@ -5,11 +5,15 @@
 
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
 #include "ametsuchi/impl/flat_file_block_storage_factory.hpp"
+#include "ametsuchi/impl/key_value_storage_factory.hpp"
 
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "datetime/time.hpp"
 #include "framework/result_gtest_checkers.hpp"
 #include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/interface_mocks.hpp"
 
 using namespace iroha::ametsuchi;
@@ -20,7 +24,8 @@ using ::testing::Invoke;
 using ::testing::NiceMock;
 using ::testing::Return;
 
-class FlatFileBlockStorageTest : public ::testing::Test {
+class FlatFileBlockStorageTest
+    : public ::testing::TestWithParam<KeyValueStorageType> {
  public:
   FlatFileBlockStorageTest() {
     ON_CALL(*block_, height()).WillByDefault(Return(height_));
@@ -43,6 +48,29 @@ class FlatFileBlockStorageTest : public ::testing::Test {
   logger::LoggerManagerTreePtr log_manager_ = getTestLoggerManager();
   std::shared_ptr<MockBlock> block_ = std::make_shared<NiceMock<MockBlock>>();
   shared_model::interface::types::HeightType height_ = 1;
+
+  std::shared_ptr<shared_model::interface::BlockJsonConverter>
+      proto_converter_ =
+          std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
+  std::shared_ptr<const shared_model::interface::Block> proto_block_ =
+      createBlock({}, height_);
+
+  std::unique_ptr<FlatFileBlockStorage> makeStorage(
+      FlatFileBlockFormat format) {
+    return std::make_unique<FlatFileBlockStorage>(
+        createKeyValueStorage(GetParam(), block_store_path_, log_manager_)
+            .assumeValue(),
+        FlatFileBlockCodec(
+            format, proto_converter_, not checksumsRecords(GetParam())),
+        getTestLogger("FlatFileBlockStorage"));
+  }
+
+  KeyValueStorage::Bytes readRawBlock() {
+    return createKeyValueStorage(GetParam(), block_store_path_, log_manager_)
+        .assumeValue()
+        ->get(height_)
+        .value();
+  }
 };
 
 /**
@@ -50,9 +78,13 @@ class FlatFileBlockStorageTest : public ::testing::Test {
  * @when create is called
  * @then block storage is created
  */
-TEST_F(FlatFileBlockStorageTest, Creation) {
+TEST_P(FlatFileBlockStorageTest, Creation) {
   auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+      FlatFileBlockStorageFactory(path_provider_,
+                                  converter_,
+                                  FlatFileBlockFormat::kJson,
+                                  GetParam(),
+                                  log_manager_)
           .create();
   IROHA_ASSERT_RESULT_VALUE(block_storage);
 }
@@ -62,9 +94,13 @@ TEST_F(FlatFileBlockStorageTest, Creation) {
  * @when another block with height_ is inserted
  * @then second insertion fails
  */
-TEST_F(FlatFileBlockStorageTest, Insert) {
+TEST_P(FlatFileBlockStorageTest, Insert) {
   auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+      FlatFileBlockStorageFactory(path_provider_,
+                                  converter_,
+                                  FlatFileBlockFormat::kJson,
+                                  GetParam(),
+                                  log_manager_)
           .create()
           .assumeValue();
   ASSERT_TRUE(block_storage->insert(block_));
@@ -76,9 +112,13 @@ TEST_F(FlatFileBlockStorageTest, Insert) {
  * @when block with height_ is fetched
  * @then it is returned
  */
-TEST_F(FlatFileBlockStorageTest, FetchExisting) {
+TEST_P(FlatFileBlockStorageTest, FetchExisting) {
   auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+      FlatFileBlockStorageFactory(path_provider_,
+                                  converter_,
+                                  FlatFileBlockFormat::kJson,
+                                  GetParam(),
+                                  log_manager_)
           .create()
           .assumeValue();
   ASSERT_TRUE(block_storage->insert(block_));
@@ -107,9 +147,13 @@ TEST_F(FlatFileBlockStorageTest, FetchExisting) {
  * @when block with height_ is fetched
  * @then nothing is returned
  */
-TEST_F(FlatFileBlockStorageTest, FetchNonexistent) {
+TEST_P(FlatFileBlockStorageTest, FetchNonexistent) {
   auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+      FlatFileBlockStorageFactory(path_provider_,
+                                  converter_,
+                                  FlatFileBlockFormat::kJson,
+                                  GetParam(),
+                                  log_manager_)
           .create()
           .assumeValue();
   auto block_var = block_storage->fetch(height_);
@@ -121,9 +165,13 @@ TEST_F(FlatFileBlockStorageTest, FetchNonexistent) {
  * @when size is fetched
  * @then 1 is returned
  */
-TEST_F(FlatFileBlockStorageTest, Size) {
+TEST_P(FlatFileBlockStorageTest, Size) {
   auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+      FlatFileBlockStorageFactory(path_provider_,
+                                  converter_,
+                                  FlatFileBlockFormat::kJson,
+                                  GetParam(),
+                                  log_manager_)
           .create()
           .assumeValue();
   ASSERT_TRUE(block_storage->insert(block_));
@@ -136,9 +184,13 @@ TEST_F(FlatFileBlockStorageTest, Size) {
  * @when storage is cleared with clear
  * @then no blocks are left in storage
  */
-TEST_F(FlatFileBlockStorageTest, Clear) {
+TEST_P(FlatFileBlockStorageTest, Clear) {
   auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+      FlatFileBlockStorageFactory(path_provider_,
+                                  converter_,
+                                  FlatFileBlockFormat::kJson,
+                                  GetParam(),
+                                  log_manager_)
           .create()
           .assumeValue();
   ASSERT_TRUE(block_storage->insert(block_));
@@ -155,9 +207,13 @@ TEST_F(FlatFileBlockStorageTest, Clear) {
  * @when forEach is called
  * @then block with height_ is visited, lambda is invoked once
  */
-TEST_F(FlatFileBlockStorageTest, ForEach) {
+TEST_P(FlatFileBlockStorageTest, ForEach) {
   auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+      FlatFileBlockStorageFactory(path_provider_,
+                                  converter_,
+                                  FlatFileBlockFormat::kJson,
+                                  GetParam(),
+                                  log_manager_)
           .create()
           .assumeValue();
   ASSERT_TRUE(block_storage->insert(block_));
@@ -189,3 +245,99 @@ TEST_F(FlatFileBlockStorageTest, ForEach) {
 
   ASSERT_EQ(1, count);
 }
+
+/**
+ * @given block storage with binary format
+ * @when a block is inserted and fetched
+ * @then the block is stored with the binary header
+ * @and the fetched block is equal to the inserted one
+ */
+TEST_P(FlatFileBlockStorageTest, BinaryRoundTrip) {
+  auto block_storage = makeStorage(FlatFileBlockFormat::kBinary);
+  ASSERT_TRUE(block_storage->insert(proto_block_));
+
+  EXPECT_EQ(FlatFileBlockCodec::detectFormat(readRawBlock()),
+            FlatFileBlockFormat::kBinary);
+  auto fetched = block_storage->fetch(height_);
+  ASSERT_TRUE(fetched);
+  EXPECT_EQ(**fetched, *proto_block_);
+  // blobs are taken from the stored bytes
+  EXPECT_EQ((*fetched)->blob(), proto_block_->blob());
+  EXPECT_EQ((*fetched)->payload(), proto_block_->payload());
+  EXPECT_EQ((*fetched)->hash(), proto_block_->hash());
+}
+
+/**
+ * @given block inserted to json block storage
+ * @when the block is fetched by block storage with binary format
+ * @then the fetched block is equal to the inserted one
+ */
+TEST_P(FlatFileBlockStorageTest, BinaryStorageReadsJson) {
+  ASSERT_TRUE(makeStorage(FlatFileBlockFormat::kJson)->insert(proto_block_));
+
+  auto fetched = makeStorage(FlatFileBlockFormat::kBinary)->fetch(height_);
+  ASSERT_TRUE(fetched);
+  EXPECT_EQ(**fetched, *proto_block_);
+}
+
+/**
+ * @given block inserted to json block storage
+ * @when the storage is converted to binary format twice
+ * @then the block is converted only once
+ * @and the converted block is equal to the inserted one
+ */
+TEST_P(FlatFileBlockStorageTest, ConvertJsonToBinary) {
+  ASSERT_TRUE(makeStorage(FlatFileBlockFormat::kJson)->insert(proto_block_));
+
+  auto block_storage = makeStorage(FlatFileBlockFormat::kBinary);
+  auto converted = block_storage->convertToWriteFormat();
+  IROHA_ASSERT_RESULT_VALUE(converted);
+  EXPECT_EQ(converted.assumeValue(), 1);
+  EXPECT_EQ(FlatFileBlockCodec::detectFormat(readRawBlock()),
+            FlatFileBlockFormat::kBinary);
+
+  converted = block_storage->convertToWriteFormat();
+  IROHA_ASSERT_RESULT_VALUE(converted);
+  EXPECT_EQ(converted.assumeValue(), 0);
+
+  auto fetched = block_storage->fetch(height_);
+  ASSERT_TRUE(fetched);
+  EXPECT_EQ(**fetched, *proto_block_);
+}
+
+/**
+ * @given binary encoded block with a corrupted payload byte
+ * @when the block is decoded
+ * @then checksum mismatch error is returned
+ */
+TEST_P(FlatFileBlockStorageTest, CorruptedBinaryBlock) {
+  FlatFileBlockCodec codec(FlatFileBlockFormat::kBinary, proto_converter_);
+  auto encoded = codec.encode(*proto_block_);
+  IROHA_ASSERT_RESULT_VALUE(encoded);
+  auto data = std::move(encoded).assumeValue();
+  data.back() ^= 0xFF;
+
+  IROHA_ASSERT_RESULT_ERROR(codec.decode(data));
+}
+
+/**
+ * @given binary block encoded without payload checksum
+ * @when the block is decoded by a codec which checksums payloads
+ * @then the block is decoded without the checksum check
+ */
+TEST_P(FlatFileBlockStorageTest, BinaryBlockWithoutChecksum) {
+  FlatFileBlockCodec unchecked_codec(
+      FlatFileBlockFormat::kBinary, proto_converter_, false);
+  auto encoded = unchecked_codec.encode(*proto_block_);
+  IROHA_ASSERT_RESULT_VALUE(encoded);
+
+  FlatFileBlockCodec codec(FlatFileBlockFormat::kBinary, proto_converter_);
+  auto decoded = codec.decode(encoded.assumeValue());
+  IROHA_ASSERT_RESULT_VALUE(decoded);
+  EXPECT_EQ(*decoded.assumeValue(), *proto_block_);
+}
+
+INSTANTIATE_TEST_SUITE_P(StorageTypes,
+                         FlatFileBlockStorageTest,
+                         ::testing::Values(KeyValueStorageType::kFilePerBlock,
+                                           KeyValueStorageType::kSegmentedLog));
@@ -53,6 +53,25 @@ TEST_F(BlStore_Test, Read_Write_Test) {
   ASSERT_EQ(*res, block);
 }
 
+/**
+ * @given FlatFile storage with a block
+ * @when the block is read with getView and then replaced
+ * @then the view contains the block as it was read
+ */
+TEST_F(BlStore_Test, GetView) {
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  IROHA_ASSERT_RESULT_VALUE(store);
+  auto bl_store = std::move(store).assumeValue();
+  ASSERT_TRUE(bl_store->add(1u, block));
+
+  auto view = bl_store->getView(1u);
+  ASSERT_TRUE(view);
+  ASSERT_TRUE(bl_store->replace(1u, std::vector<uint8_t>(10, 7)));
+
+  ASSERT_EQ(std::vector<uint8_t>(view->data, view->data + view->size), block);
+  ASSERT_FALSE(bl_store->getView(2u));
+}
+
 /**
  * @given initialized FlatFile storage and 3 blocks are inserted into it
  * @when storage removed, file for a second block removed and new storage is
@@ -22,6 +22,10 @@ namespace iroha {
                   checkTxPresence,
                   (const shared_model::crypto::Hash &),
                   (override));
+      MOCK_METHOD(std::optional<std::vector<TxCacheStatusType>>,
+                  checkTxPresence,
+                  (const std::vector<shared_model::crypto::Hash> &),
+                  (override));
       MOCK_METHOD0(getTopBlockHeight,
                    shared_model::interface::types::HeightType());
       MOCK_METHOD0(reloadBlockstore, void());
@@ -9,6 +9,7 @@
 #include "ametsuchi/key_value_storage.hpp"
 
 #include <gmock/gmock.h>
+#include "common/result.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -16,9 +17,15 @@ namespace iroha {
     class MockKeyValueStorage : public KeyValueStorage {
      public:
       MOCK_METHOD2(add, bool(Identifier, const Bytes &));
+      MOCK_METHOD2(replace, bool(Identifier, const Bytes &));
       MOCK_CONST_METHOD1(get, boost::optional<Bytes>(Identifier));
+      MOCK_CONST_METHOD1(getView, boost::optional<BytesView>(Identifier));
       MOCK_CONST_METHOD0(directory, std::string(void));
       MOCK_CONST_METHOD0(last_id, Identifier(void));
+      MOCK_CONST_METHOD1(forEachIdentifier,
+                         expected::Result<void, std::string>(
+                             IdentifierFunction));
+      MOCK_METHOD0(reload, void(void));
       MOCK_METHOD0(dropAll, void(void));
     };
 
@@ -56,21 +56,34 @@ namespace iroha {
           createMutableStorage,
           iroha::expected::Result<std::unique_ptr<MutableStorage>, std::string>(
               std::shared_ptr<CommandExecutor>, BlockStorageFactory &));
+      MOCK_METHOD2(
+          createBulkMutableStorage,
+          iroha::expected::Result<std::unique_ptr<MutableStorage>, std::string>(
+              std::shared_ptr<CommandExecutor>, BlockStorageFactory &));
 
       MOCK_METHOD1(insertPeer,
                    expected::Result<void, std::string>(
                        const shared_model::interface::Peer &));
       MOCK_METHOD0(dropBlockStorage, expected::Result<void, std::string>());
+      MOCK_METHOD1(exportWsvSnapshot,
+                   expected::Result<void, std::string>(std::ostream &));
+      MOCK_METHOD1(importWsvSnapshot,
+                   expected::Result<void, std::string>(std::istream &));
       MOCK_METHOD0(resetPeers, void());
       MOCK_CONST_METHOD0(
           getLedgerState,
           boost::optional<std::shared_ptr<const iroha::LedgerState>>());
       MOCK_METHOD0(freeConnections, void());
-      MOCK_METHOD1(prepareBlock_, void(std::unique_ptr<TemporaryWsv> &));
+      MOCK_METHOD2(
+          prepareBlock_,
+          void(std::unique_ptr<TemporaryWsv> &,
+               std::shared_ptr<const shared_model::interface::Block>));
 
-      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) override {
+      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv,
+                        std::shared_ptr<const shared_model::interface::Block>
+                            block) override {
         // gmock workaround for non-copyable parameters
-        prepareBlock_(wsv);
+        prepareBlock_(wsv, block);
       }
 
       rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
@@ -9,6 +9,7 @@
 #include "ametsuchi/temporary_factory.hpp"
 
 #include <gmock/gmock.h>
+#include "interfaces/iroha_internal/block.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -18,11 +19,16 @@ namespace iroha {
       MOCK_METHOD1(
           createTemporaryWsv,
           std::unique_ptr<TemporaryWsv>(std::shared_ptr<CommandExecutor>));
-      MOCK_METHOD1(prepareBlock_, void(std::unique_ptr<TemporaryWsv> &));
-
-      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) override {
+      MOCK_METHOD2(
+          prepareBlock_,
+          void(std::unique_ptr<TemporaryWsv> &,
+               std::shared_ptr<const shared_model::interface::Block>));
+
+      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv,
+                        std::shared_ptr<const shared_model::interface::Block>
+                            block) override {
         // gmock workaround for non-copyable parameters
-        prepareBlock_(wsv);
+        prepareBlock_(wsv, block);
       }
     };
 
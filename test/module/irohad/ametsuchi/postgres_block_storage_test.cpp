@@ -209,3 +209,66 @@ TEST_F(PostgresBlockStorageTest, ForEach) {
 
   ASSERT_EQ(2, count);
 }
+
+/**
+ * @given initialized block storage with blocks at heights height_..height_+2
+ * @when fetchRange is called for the last two of them
+ * @then exactly these blocks are returned in ascending height order
+ */
+TEST_F(PostgresBlockStorageTest, FetchRange) {
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  std::vector<shared_model::proto::Block> blocks;
+  for (auto height = height_; height < height_ + 3; ++height) {
+    blocks.push_back(
+        TestBlockBuilder().height(height).transactions(txs).build());
+    ASSERT_TRUE(block_storage_->insert(clone(blocks.back())));
+  }
+
+  auto &storage = static_cast<PostgresBlockStorage &>(*block_storage_);
+  auto fetched = storage.fetchRange(height_ + 1, height_ + 5);
+  IROHA_ASSERT_RESULT_VALUE(fetched);
+  auto &range = fetched.assumeValue();
+  ASSERT_EQ(2, range.size());
+  ASSERT_EQ(blocks[1].blob(), range[0]->blob());
+  ASSERT_EQ(blocks[2].blob(), range[1]->blob());
+}
+
+/**
+ * @given block table in the legacy format with a hex encoded block
+ * @when the table is migrated
+ * @then the block is fetched from the migrated table
+ */
+TEST_F(PostgresBlockStorageTest, MigrateLegacyTable) {
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  auto block = TestBlockBuilder().height(height_).transactions(txs).build();
+
+  const std::string legacy_table = "legacy_blocks";
+  const auto block_hex = block.blob().hex();
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  sql << "CREATE TABLE " << legacy_table
+      << "(height bigint PRIMARY KEY, block_data text not null)";
+  sql << "INSERT INTO " << legacy_table
+      << " (height, block_data) VALUES(:height, :block_data)",
+      soci::use(height_), soci::use(block_hex);
+
+  IROHA_ASSERT_RESULT_VALUE(
+      PgConnectionInit::migrateBlockStorage(sql, legacy_table));
+  // second run does nothing
+  IROHA_ASSERT_RESULT_VALUE(
+      PgConnectionInit::migrateBlockStorage(sql, legacy_table));
+
+  auto storage = PostgresBlockStorage::create(
+      pool_wrapper_,
+      block_factory_,
+      legacy_table,
+      true,
+      getTestLogger("PostgresBlockStorage"));
+  IROHA_ASSERT_RESULT_VALUE(storage);
+  auto fetched = storage.assumeValue()->fetch(height_);
+  ASSERT_TRUE(fetched);
+  ASSERT_EQ(block.blob(), (*fetched)->blob());
+}
@@ -919,6 +919,50 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given initialized storage with transactions of the account in several
+     * blocks
+     * @when get account transactions page by page in descending order of their
+     * positions
+     * @then every page continues the previous one @and the total number of
+     * transactions is returned with every page
+     */
+    TEST_F(GetAccountTransactionsExecutorTest, ValidPaginationThroughBlocks) {
+      addPerms({shared_model::interface::permissions::Role::kGetMyAccTxs});
+
+      commitBlocks();
+      auto hashes = commitAdditionalBlocks(kTxPageSize);
+      // transactions of the account committed by commitBlocks
+      const size_t total_size = hashes.size() + 3;
+
+      using Ordering = shared_model::interface::Ordering;
+      shared_model::proto::OrderingImpl ordering;
+      ordering.append(Ordering::Field::kPosition,
+                      Ordering::Direction::kDescending);
+
+      std::vector<shared_model::crypto::Hash> received;
+      std::optional<shared_model::crypto::Hash> first_hash;
+      do {
+        auto query = TestQueryBuilder()
+                         .creatorAccountId(account_id)
+                         .getAccountTransactions(
+                             account_id, 2, first_hash, &ordering)
+                         .build();
+        first_hash = std::nullopt;
+        checkSuccessfulResult<TransactionsPageResponse>(
+            executeQuery(query), [&](const auto &tx_page_response) {
+              EXPECT_EQ(tx_page_response.allTransactionsSize(), total_size);
+              for (const auto &tx : tx_page_response.transactions()) {
+                received.push_back(tx.hash());
+              }
+              first_hash = tx_page_response.nextTxHash();
+            });
+      } while (first_hash);
+
+      ASSERT_EQ(received.size(), total_size);
+      EXPECT_TRUE(std::equal(hashes.rbegin(), hashes.rend(), received.begin()));
+    }
+
     /**
      * @given initialized storage, global permission
      * @when get account transactions of other user
@@ -0,0 +1,246 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "common/result.hpp"
+#include "framework/result_gtest_checkers.hpp"
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+using Identifier = SegmentedLog::Identifier;
+
+class SegmentedLogTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    fs::remove_all(block_store_path);
+  }
+
+  std::unique_ptr<SegmentedLog> createStorage(
+      SegmentedLog::Options options = SegmentedLog::kDefaultOptions) {
+    auto store = SegmentedLog::create(block_store_path, options, log_);
+    EXPECT_TRUE(iroha::expected::hasValue(store));
+    return std::move(store).assumeValue();
+  }
+
+  SegmentedLog::Bytes makeBlock(uint8_t fill) {
+    return SegmentedLog::Bytes(1000, fill);
+  }
+
+  void expectBlock(const SegmentedLog &store, Identifier id, uint8_t fill) {
+    auto blob = store.get(id);
+    ASSERT_TRUE(blob) << "no record " << id;
+    EXPECT_EQ(*blob, makeBlock(fill));
+  }
+
+  fs::path segmentPath(uint32_t number, const std::string &extension) {
+    std::string name = std::to_string(number);
+    name.insert(0, 16 - name.size(), '0');
+    return fs::path(block_store_path) / (name + extension);
+  }
+
+  std::string block_store_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  logger::LoggerPtr log_ = getTestLogger("SegmentedLog");
+};
+
+/**
+ * @given empty segmented log
+ * @when two records are added
+ * @then both records are returned by get
+ * @and last id is the id of the second record
+ */
+TEST_F(SegmentedLogTest, ReadWrite) {
+  auto store = createStorage();
+  ASSERT_TRUE(store->add(1, makeBlock(1)));
+  ASSERT_TRUE(store->add(2, makeBlock(2)));
+
+  expectBlock(*store, 1, 1);
+  expectBlock(*store, 2, 2);
+  EXPECT_FALSE(store->get(3));
+  EXPECT_EQ(store->last_id(), 2);
+}
+
+/**
+ * @given segmented log with a record
+ * @when a record with the same or a non-sequential id is added
+ * @then add fails
+ */
+TEST_F(SegmentedLogTest, NonSequentialAdd) {
+  auto store = createStorage();
+  ASSERT_TRUE(store->add(1, makeBlock(1)));
+
+  EXPECT_FALSE(store->add(1, makeBlock(1)));
+  EXPECT_FALSE(store->add(3, makeBlock(3)));
+  EXPECT_EQ(store->last_id(), 1);
+}
+
+/**
+ * @given segmented log with small segment size and several records
+ * @when the log is reopened
+ * @then the records are split into several sealed segments with indices
+ * @and all records are available
+ */
+TEST_F(SegmentedLogTest, ReopenWithSeveralSegments) {
+  const SegmentedLog::Options options{2500, 2};
+  {
+    auto store = createStorage(options);
+    for (Identifier id = 1; id <= 5; ++id) {
+      ASSERT_TRUE(store->add(id, makeBlock(id)));
+    }
+  }
+
+  EXPECT_TRUE(fs::exists(segmentPath(0, SegmentedLog::kIndexExtension)));
+  EXPECT_TRUE(fs::exists(segmentPath(2, SegmentedLog::kSegmentExtension)));
+
+  auto store = createStorage(options);
+  ASSERT_EQ(store->last_id(), 5);
+  for (Identifier id = 1; id <= 5; ++id) {
+    expectBlock(*store, id, id);
+  }
+  ASSERT_TRUE(store->add(6, makeBlock(6)));
+}
+
+/**
+ * @given segmented log with two records
+ * @when the last record is torn and the log is reopened
+ * @then the torn record is dropped
+ * @and a record with its id can be added again
+ */
+TEST_F(SegmentedLogTest, TornTailIsTruncated) {
+  createStorage()->add(1, makeBlock(1));
+  createStorage()->add(2, makeBlock(2));
+  const auto segment = segmentPath(0, SegmentedLog::kSegmentExtension);
+  fs::resize_file(segment, fs::file_size(segment) - 10);
+
+  auto store = createStorage();
+  EXPECT_EQ(store->last_id(), 1);
+  expectBlock(*store, 1, 1);
+  ASSERT_TRUE(store->add(2, makeBlock(2)));
+  expectBlock(*store, 2, 2);
+}
+
+/**
+ * @given segmented log with a record
+ * @when the record is replaced and the log is reopened
+ * @then the latest data is returned
+ */
+TEST_F(SegmentedLogTest, Replace) {
+  {
+    auto store = createStorage();
+    ASSERT_TRUE(store->add(1, makeBlock(1)));
+    ASSERT_TRUE(store->replace(1, makeBlock(7)));
+    EXPECT_FALSE(store->replace(2, makeBlock(7)));
+    expectBlock(*store, 1, 7);
+  }
+
+  auto store = createStorage();
+  EXPECT_EQ(store->last_id(), 1);
+  expectBlock(*store, 1, 7);
+}
+
+/**
+ * @given segmented log with records in several sealed segments
+ * @when every record is replaced and the log is reopened
+ * @then the sealed segments are compacted, so the log keeps its size
+ * @and the latest data is returned
+ */
+TEST_F(SegmentedLogTest, ReplaceCompactsSegments) {
+  const SegmentedLog::Options options{2500, 1};
+  auto log_size = [this] {
+    uint64_t size = 0;
+    for (fs::directory_iterator it(block_store_path), end; it != end; ++it) {
+      if (it->path().extension() == SegmentedLog::kSegmentExtension) {
+        size += fs::file_size(it->path());
+      }
+    }
+    return size;
+  };
+  {
+    auto store = createStorage(options);
+    for (Identifier id = 1; id <= 6; ++id) {
+      ASSERT_TRUE(store->add(id, makeBlock(id)));
+    }
+    const auto initial_size = log_size();
+    for (Identifier id = 1; id <= 6; ++id) {
+      ASSERT_TRUE(store->replace(id, makeBlock(id + 10)));
+    }
+    // records of the same size replace each other
+    EXPECT_EQ(log_size(), initial_size);
+    for (Identifier id = 1; id <= 6; ++id) {
+      expectBlock(*store, id, id + 10);
+    }
+  }
+
+  auto store = createStorage(options);
+  ASSERT_EQ(store->last_id(), 6);
+  for (Identifier id = 1; id <= 6; ++id) {
+    expectBlock(*store, id, id + 10);
+  }
+}
+
+/**
+ * @given segmented log with records
+ * @when forEachIdentifier is called
+ * @then all ids are visited in ascending order
+ */
+TEST_F(SegmentedLogTest, ForEachIdentifier) {
+  auto store = createStorage();
+  for (Identifier id = 3; id <= 5; ++id) {
+    ASSERT_TRUE(store->add(id, makeBlock(id)));
+  }
+
+  std::vector<Identifier> ids;
+  IROHA_ASSERT_RESULT_VALUE(store->forEachIdentifier(
+      [&ids](auto id) -> iroha::expected::Result<void, std::string> {
+        ids.push_back(id);
+        return {};
+      }));
+  EXPECT_EQ(ids, (std::vector<Identifier>{3, 4, 5}));
+}
+
+/**
+ * @given segmented log with records
+ * @when dropAll is called
+ * @then the log is empty and records can be added from any id
+ */
+TEST_F(SegmentedLogTest, DropAll) {
+  auto store = createStorage();
+  ASSERT_TRUE(store->add(1, makeBlock(1)));
+  store->dropAll();
+
+  EXPECT_EQ(store->last_id(), 0);
+  EXPECT_FALSE(store->get(1));
+  ASSERT_TRUE(store->add(1, makeBlock(1)));
+  expectBlock(*store, 1, 1);
+}
+
+/**
+ * @given segmented log with small segment size and records in several
+ * segments
+ * @when records are read with getView while the active segment grows
+ * @then views contain the records and stay valid after the log is closed
+ */
+TEST_F(SegmentedLogTest, GetView) {
+  auto store = createStorage({2500, 1});
+  std::vector<SegmentedLog::BytesView> views;
+  for (Identifier id = 1; id <= 4; ++id) {
+    ASSERT_TRUE(store->add(id, makeBlock(id)));
+    auto view = store->getView(id);
+    ASSERT_TRUE(view);
+    views.push_back(*view);
+  }
+  EXPECT_FALSE(store->getView(5));
+  store.reset();
+
+  for (Identifier id = 1; id <= 4; ++id) {
+    const auto &view = views[id - 1];
+    EXPECT_EQ(SegmentedLog::Bytes(view.data, view.data + view.size),
+              makeBlock(id));
+  }
+}
@@ -117,6 +117,8 @@ TEST_F(StorageInitTest, CreateStorageWithDatabase) {
                       std::move(block_storage_factory_),
                       std::move(block_storage_),
                       std::nullopt,
+                      nullptr,
+                      nullptr,
                       storage_log_manager_)
       .match(
           [&storage](const auto &value) {
@@ -158,3 +160,174 @@ TEST_F(StorageInitTest, CreateStorageWithInvalidPgOpt) {
   pool.match([](const auto &) { FAIL() << "storage created, but should not"; },
              [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given working database with account details kept in the JSONB column of
+ * account table, as older versions did
+ * @when account details are migrated
+ * @then each detail becomes a row of account_detail table @and details are
+ * counted by accounts and writers @and the column is dropped
+ */
+TEST_F(StorageInitTest, MigrateAccountDetails) {
+  PostgresOptions options(pgopt_,
+                          integration_framework::kDefaultWorkingDatabaseName,
+                          storage_log_manager_->getLogger());
+  PgConnectionInit::prepareWorkingDatabase(iroha::StartupWsvDataPolicy::kDrop,
+                                           options)
+      .match([](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+
+  soci::session sql(*soci::factory_postgresql(),
+                    options.workingConnectionString());
+  sql << R"(
+    DROP TABLE account_detail;
+    DROP TABLE account_detail_count;
+    ALTER TABLE account ADD COLUMN data JSONB;
+    INSERT INTO role VALUES ('user');
+    INSERT INTO domain VALUES ('domain', 'user');
+    INSERT INTO account VALUES
+        ('id@domain', 'domain', 1,
+         '{"id@domain": {"age": "18"},
+           "admin@domain": {"age": "21", "a": "b"}}'),
+        ('empty@domain', 'domain', 1, '{}');
+  )";
+
+  PgConnectionInit::migrateAccountDetails(sql).match(
+      [](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+
+  int details = 0;
+  sql << "SELECT count(*) FROM account_detail", soci::into(details);
+  EXPECT_EQ(details, 3);
+  std::string value;
+  sql << "SELECT value #>> '{}' FROM account_detail WHERE account_id = "
+         "'id@domain' AND writer = 'admin@domain' AND key = 'age'",
+      soci::into(value);
+  EXPECT_EQ(value, "21");
+  int admin_details = 0;
+  sql << "SELECT count::integer FROM account_detail_count WHERE account_id = "
+         "'id@domain' AND writer = 'admin@domain'",
+      soci::into(admin_details);
+  EXPECT_EQ(admin_details, 2);
+  int count_rows = 0;
+  sql << "SELECT count(*) FROM account_detail_count", soci::into(count_rows);
+  EXPECT_EQ(count_rows, 2);
+  int data_columns = 1;
+  sql << "SELECT count(*) FROM information_schema.columns "
+         "WHERE table_schema = current_schema() AND table_name = 'account' "
+         "AND column_name = 'data'",
+      soci::into(data_columns);
+  EXPECT_EQ(data_columns, 0);
+
+  // nothing is left to migrate on the next start
+  PgConnectionInit::migrateAccountDetails(sql).match(
+      [](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+  sql << "SELECT count(*) FROM account_detail", soci::into(details);
+  EXPECT_EQ(details, 3);
+
+  sql.close();
+  PgConnectionInit::dropWorkingDatabase(options);
+}
+
+/**
+ * @given working database with transaction positions, but without the
+ * transaction numbers table and with the account transaction index of
+ * older versions
+ * @when transaction positions are migrated
+ * @then the numbers of distinct transactions by accounts and assets are
+ * counted and the index is replaced
+ */
+TEST_F(StorageInitTest, MigrateTransactionPositions) {
+  PostgresOptions options(pgopt_,
+                          integration_framework::kDefaultWorkingDatabaseName,
+                          storage_log_manager_->getLogger());
+  PgConnectionInit::prepareWorkingDatabase(iroha::StartupWsvDataPolicy::kDrop,
+                                           options)
+      .match([](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+
+  soci::session sql(*soci::factory_postgresql(),
+                    options.workingConnectionString());
+  sql << R"(
+    DROP TABLE tx_positions_count;
+    DROP INDEX tx_positions_creator_id_asset_height_index;
+    CREATE INDEX tx_positions_creator_id_asset_index
+        ON tx_positions (creator_id, asset_id);
+    INSERT INTO tx_positions(creator_id, hash, asset_id, ts, height, index)
+    VALUES ('id@domain', 'a', NULL, 1, 1, 0),
+           ('id@domain', 'b', NULL, 2, 2, 0),
+           ('id@domain', 'b', 'coin#domain', 2, 2, 0),
+           ('id@domain', 'b', 'coin#domain', 2, 2, 0),
+           ('other@domain', 'b', 'coin#domain', 2, 2, 0);
+  )";
+
+  auto count = [&sql](const std::string &account, const std::string &asset) {
+    long long number = 0;
+    sql << "SELECT count FROM tx_positions_count "
+           "WHERE creator_id = :account AND asset_id = :asset",
+        soci::use(account, "account"), soci::use(asset, "asset"),
+        soci::into(number);
+    return number;
+  };
+  auto index_exists = [&sql](const std::string &name) {
+    int indices = 0;
+    sql << "SELECT count(*) FROM pg_indexes WHERE indexname = :name",
+        soci::use(name, "name"), soci::into(indices);
+    return indices != 0;
+  };
+
+  PgConnectionInit::migrateTransactionPositions(sql).match(
+      [](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+
+  EXPECT_EQ(count("id@domain", ""), 2);
+  EXPECT_EQ(count("id@domain", "coin#domain"), 1);
+  EXPECT_EQ(count("other@domain", "coin#domain"), 1);
+  EXPECT_FALSE(index_exists("tx_positions_creator_id_asset_index"));
+  EXPECT_TRUE(index_exists("tx_positions_creator_id_asset_height_index"));
+
+  // the numbers maintained by the indexer are kept on the next start
+  sql << "UPDATE tx_positions_count SET count = 3 "
+         "WHERE creator_id = 'id@domain' AND asset_id = ''";
+  PgConnectionInit::migrateTransactionPositions(sql).match(
+      [](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+  EXPECT_EQ(count("id@domain", ""), 3);
+
+  sql.close();
+  PgConnectionInit::dropWorkingDatabase(options);
+}
+
+/**
+ * @given working database of an older version, which stores transaction
+ * hashes as hex strings
+ * @when transaction positions are migrated
+ * @then the hashes are converted to bytes in both transaction tables
+ */
+TEST_F(StorageInitTest, MigrateTransactionHashesToBytes) {
+  PostgresOptions options(pgopt_,
+                          integration_framework::kDefaultWorkingDatabaseName,
+                          storage_log_manager_->getLogger());
+  PgConnectionInit::prepareWorkingDatabase(iroha::StartupWsvDataPolicy::kDrop,
+                                           options)
+      .match([](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+
+  soci::session sql(*soci::factory_postgresql(),
+                    options.workingConnectionString());
+  sql << R"(
+    ALTER TABLE tx_positions ALTER COLUMN hash TYPE varchar(64);
+    ALTER TABLE tx_status_by_hash ALTER COLUMN hash TYPE varchar;
+    INSERT INTO tx_positions(creator_id, hash, asset_id, ts, height, index)
+    VALUES ('id@domain', '0a1b', NULL, 1, 1, 0);
+    INSERT INTO tx_status_by_hash(hash, status) VALUES ('0a1b', true);
+  )";
+
+  PgConnectionInit::migrateTransactionPositions(sql).match(
+      [](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+
+  std::string positions_hash, status_hash;
+  sql << "SELECT encode(hash, 'hex') FROM tx_positions",
+      soci::into(positions_hash);
+  sql << "SELECT encode(hash, 'hex') FROM tx_status_by_hash",
+      soci::into(status_hash);
+  EXPECT_EQ(positions_hash, "0a1b");
+  EXPECT_EQ(status_hash, "0a1b");
+
+  sql.close();
+  PgConnectionInit::dropWorkingDatabase(options);
+}
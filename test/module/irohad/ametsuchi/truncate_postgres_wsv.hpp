@@ -19,6 +19,8 @@ namespace iroha {
         TRUNCATE TABLE role_has_permissions RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account_has_roles RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account_has_grantable_permissions RESTART IDENTITY CASCADE;
+        TRUNCATE TABLE account_detail RESTART IDENTITY CASCADE;
+        TRUNCATE TABLE account_detail_count RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account RESTART IDENTITY CASCADE;
         TRUNCATE TABLE asset RESTART IDENTITY CASCADE;
         TRUNCATE TABLE domain RESTART IDENTITY CASCADE;
@@ -33,6 +35,7 @@ namespace iroha {
         TRUNCATE TABLE burrow_tx_logs RESTART IDENTITY CASCADE;
         TRUNCATE TABLE burrow_tx_logs_topics;
         TRUNCATE TABLE tx_positions RESTART IDENTITY CASCADE;
+        TRUNCATE TABLE tx_positions_count RESTART IDENTITY CASCADE;
             )";
     }
   }  // namespace ametsuchi
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/tx_hash_filter.hpp"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "cryptography/hash_providers/sha3_256.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::crypto::Hash;
+
+namespace {
+  std::vector<Hash> makeHashes(const std::string &prefix, size_t amount) {
+    std::vector<Hash> hashes;
+    for (size_t i = 0; i < amount; ++i) {
+      hashes.push_back(shared_model::crypto::Sha3_256::makeHash(
+          shared_model::crypto::Blob(prefix + std::to_string(i))));
+    }
+    return hashes;
+  }
+}  // namespace
+
+/**
+ * @given filter sized for 100 hashes
+ * @when 1000 hashes are added
+ * @then all of them may be contained @and the share of other hashes reported
+ * as possibly contained stays small
+ */
+TEST(TxHashFilterTest, GrowsWithoutFalseNegatives) {
+  TxHashFilter filter(100);
+  auto added = makeHashes("added", 1000);
+  for (const auto &hash : added) {
+    filter.add(hash);
+  }
+
+  for (const auto &hash : added) {
+    EXPECT_TRUE(filter.mayContain(hash)) << hash.hex();
+  }
+  size_t false_positives = 0;
+  for (const auto &hash : makeHashes("other", 1000)) {
+    false_positives += filter.mayContain(hash) ? 1 : 0;
+  }
+  EXPECT_LT(false_positives, 50);
+}
+
+/**
+ * @given filter sized for 10 hashes
+ * @when 10000 hashes are added, which takes about ten stages
+ * @then the share of other hashes reported as possibly contained stays within
+ * the rate of a filter with a single stage
+ */
+TEST(TxHashFilterTest, FalsePositiveRateIsBoundedWithManyStages) {
+  TxHashFilter filter(10);
+  for (const auto &hash : makeHashes("added", 10000)) {
+    filter.add(hash);
+  }
+
+  size_t false_positives = 0;
+  for (const auto &hash : makeHashes("other", 10000)) {
+    false_positives += filter.mayContain(hash) ? 1 : 0;
+  }
+  EXPECT_LT(false_positives, 250);
+}
+
+/**
+ * @given empty filter
+ * @when a short hash is added
+ * @then it may be contained
+ */
+TEST(TxHashFilterTest, ShortHash) {
+  TxHashFilter filter(0);
+  Hash hash("1");
+  filter.add(hash);
+
+  EXPECT_TRUE(filter.mayContain(hash));
+}
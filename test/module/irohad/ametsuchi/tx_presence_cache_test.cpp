@@ -7,6 +7,7 @@
 
 #include <memory>
 
+#include "ametsuchi/impl/tx_hash_filter.hpp"
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
@@ -100,6 +101,32 @@ TEST_F(TxPresenceCacheTest, MissingThenCommittedHashTest) {
   ASSERT_EQ(hash, check_committed_result.hash);
 }
 
+/**
+ * @given cache with a filter which contains one committed hash
+ * @when cache asked for statuses of the committed hash and of another one
+ * @then the storage is asked for the committed hash only @and the other hash
+ * is reported as Missing
+ */
+TEST_F(TxPresenceCacheTest, FilteredHashTest) {
+  shared_model::crypto::Hash committed_hash("committed");
+  shared_model::crypto::Hash new_hash("new");
+  auto filter = std::make_shared<TxHashFilter>(10);
+  filter->add(committed_hash);
+  EXPECT_CALL(*mock_block_query, checkTxPresence(committed_hash))
+      .WillOnce(Return(std::make_optional<TxCacheStatusType>(
+          tx_cache_status_responses::Committed(committed_hash))));
+  EXPECT_CALL(*mock_block_query, checkTxPresence(new_hash)).Times(0);
+  auto cache = std::make_unique<TxPresenceCacheImpl>(mock_storage, filter);
+
+  ASSERT_NO_THROW(std::get<tx_cache_status_responses::Committed>(
+      *cache->check(committed_hash)));
+  tx_cache_status_responses::Missing check_missing_result;
+  ASSERT_NO_THROW(
+      check_missing_result =
+          std::get<tx_cache_status_responses::Missing>(*cache->check(new_hash)));
+  ASSERT_EQ(new_hash, check_missing_result.hash);
+}
+
 /**
  * @given batch with 3 transactions: Rejected, Committed and Missing
  * @when cache asked for batch status
@@ -116,15 +143,13 @@ TEST_F(TxPresenceCacheTest, BatchHashTest) {
   shared_model::crypto::Hash hash3("3");
   shared_model::crypto::Hash reduced_hash_3("r3");
 
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash1))
-      .WillOnce(Return(std::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Rejected(hash1))));
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash2))
-      .WillOnce(Return(std::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Committed(hash2))));
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash3))
-      .WillOnce(Return(std::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Missing(hash3))));
+  EXPECT_CALL(*mock_block_query,
+              checkTxPresence(std::vector<shared_model::crypto::Hash>{
+                  hash1, hash2, hash3}))
+      .WillOnce(Return(std::make_optional(std::vector<TxCacheStatusType>{
+          tx_cache_status_responses::Rejected(hash1),
+          tx_cache_status_responses::Committed(hash2),
+          tx_cache_status_responses::Missing(hash3)})));
   auto tx1 = std::make_shared<MockTransaction>();
   EXPECT_CALL(*tx1, hash()).WillOnce(ReturnRefOfCopy(hash1));
   EXPECT_CALL(*tx1, reducedHash()).WillOnce(ReturnRefOfCopy(reduced_hash_1));
@@ -172,3 +197,31 @@ TEST_F(TxPresenceCacheTest, BatchHashTest) {
       },
       [&](const auto &error) { FAIL() << error.error; });
 }
+
+/**
+ * @given cache which already knows that one transaction is committed
+ * @when cache asked for statuses of this transaction and of another one
+ * @then the storage is asked only for the other one with a single request
+ */
+TEST_F(TxPresenceCacheTest, HashesTest) {
+  shared_model::crypto::Hash hash1("1");
+  shared_model::crypto::Hash hash2("2");
+  EXPECT_CALL(*mock_block_query, checkTxPresence(hash1))
+      .WillOnce(Return(std::make_optional<TxCacheStatusType>(
+          tx_cache_status_responses::Committed(hash1))));
+  EXPECT_CALL(*mock_block_query,
+              checkTxPresence(std::vector<shared_model::crypto::Hash>{hash2}))
+      .WillOnce(Return(std::make_optional(std::vector<TxCacheStatusType>{
+          tx_cache_status_responses::Rejected(hash2)})));
+  auto cache = std::make_unique<TxPresenceCacheImpl>(mock_storage);
+  ASSERT_TRUE(cache->check(hash1));
+
+  auto statuses =
+      cache->check(std::vector<shared_model::crypto::Hash>{hash1, hash2});
+  ASSERT_TRUE(statuses);
+  ASSERT_EQ(2, statuses->size());
+  EXPECT_TRUE(std::holds_alternative<tx_cache_status_responses::Committed>(
+      statuses->at(0)));
+  EXPECT_TRUE(std::holds_alternative<tx_cache_status_responses::Rejected>(
+      statuses->at(1)));
+}
@@ -0,0 +1,187 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::EvmCodeHexStringView;
+using shared_model::interface::types::PublicKeyHexStringView;
+
+class WsvCacheTest : public ::testing::Test {
+ protected:
+  void put(const std::string &account_id, WsvCache::AccountSignatories value) {
+    cache.putSignatories(account_id, std::move(value), cache.generation());
+  }
+
+  void expectSignatories(const std::string &account_id,
+                         shared_model::interface::types::QuorumType quorum,
+                         std::set<std::string> public_keys) {
+    auto signatories = cache.getSignatories(account_id);
+    ASSERT_TRUE(signatories) << "no entry for " << account_id;
+    EXPECT_EQ(signatories->quorum, quorum);
+    EXPECT_EQ(signatories->public_keys, public_keys);
+  }
+
+  const std::string key_a = std::string(64, 'a');
+  const std::string key_b = std::string(64, 'b');
+  const std::string evm_code = "00";
+  WsvCache cache{2};
+};
+
+/**
+ * @given cache with capacity of two accounts
+ * @when three accounts are put and the first one is accessed before the third
+ * one is put
+ * @then the least recently used account is evicted
+ */
+TEST_F(WsvCacheTest, EvictsLeastRecentlyUsed) {
+  put("a@test", {1, {key_a}});
+  put("b@test", {1, {key_b}});
+  ASSERT_TRUE(cache.getSignatories("a@test"));
+  put("c@test", {1, {key_a}});
+
+  EXPECT_TRUE(cache.getSignatories("a@test"));
+  EXPECT_FALSE(cache.getSignatories("b@test"));
+  EXPECT_TRUE(cache.getSignatories("c@test"));
+}
+
+/**
+ * @given state read before a block was committed
+ * @when it is put to the cache
+ * @then it is ignored
+ */
+TEST_F(WsvCacheTest, StaleReadIsIgnored) {
+  auto generation = cache.generation();
+  cache.applyBlock(*createBlock({}));
+  cache.putSignatories("a@test", {1, {key_a}}, generation);
+
+  EXPECT_FALSE(cache.getSignatories("a@test"));
+}
+
+/**
+ * @given cached account
+ * @when a block adding a signatory, raising the quorum and creating another
+ * account is applied
+ * @then cached entries reflect the committed changes
+ */
+TEST_F(WsvCacheTest, BlockUpdatesEntries) {
+  put("a@test", {1, {key_a}});
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("a@test")
+                .addSignatory("a@test", PublicKeyHexStringView{key_b})
+                .setAccountQuorum("a@test", 2)
+                .createAccount("b", "test", PublicKeyHexStringView{key_b})
+                .build();
+  cache.applyBlock(*createBlock({tx}));
+
+  expectSignatories("a@test", 2, {key_a, key_b});
+  expectSignatories("b@test", 1, {key_b});
+}
+
+/**
+ * @given cached account
+ * @when a block with an engine call is applied
+ * @then the cache is emptied @and the transaction is reported to modify any
+ * account
+ */
+TEST_F(WsvCacheTest, EngineCallClearsCache) {
+  put("a@test", {1, {key_a}});
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("a@test")
+                .callEngine(
+                    "a@test", std::nullopt, EvmCodeHexStringView{evm_code})
+                .build();
+  cache.applyBlock(*createBlock({tx}));
+
+  EXPECT_FALSE(cache.getSignatories("a@test"));
+  EXPECT_FALSE(WsvCache::modifiedAccounts(tx));
+}
+
+/**
+ * @given transaction which removes a signatory and sets an account detail
+ * @when modified accounts are requested
+ * @then only the account losing the signatory is returned
+ */
+TEST_F(WsvCacheTest, ModifiedAccounts) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("a@test")
+                .removeSignatory("b@test", PublicKeyHexStringView{key_b})
+                .setAccountDetail("c@test", "key", "value")
+                .build();
+  auto accounts = WsvCache::modifiedAccounts(tx);
+
+  ASSERT_TRUE(accounts);
+  EXPECT_EQ(*accounts, std::vector<std::string>{"b@test"});
+}
+
+/**
+ * @given cached signatories and role permissions of two accounts
+ * @when a block appending a role to one account and detaching a role from the
+ * other one is applied
+ * @then role permissions of both accounts are dropped @and their signatories
+ * stay cached
+ */
+TEST_F(WsvCacheTest, RoleChangeDropsRolePermissions) {
+  using shared_model::interface::RolePermissionSet;
+  using shared_model::interface::permissions::Role;
+  put("a@test", {1, {key_a}});
+  put("b@test", {1, {key_b}});
+  cache.putRolePermissions(
+      "a@test", RolePermissionSet{Role::kGetBlocks}, cache.generation());
+  cache.putRolePermissions(
+      "b@test", RolePermissionSet{Role::kGetBlocks}, cache.generation());
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("a@test")
+                .appendRole("a@test", "admin")
+                .detachRole("b@test", "user")
+                .build();
+  cache.applyBlock(*createBlock({tx}));
+
+  EXPECT_FALSE(cache.getRolePermissions("a@test"));
+  EXPECT_FALSE(cache.getRolePermissions("b@test"));
+  expectSignatories("a@test", 1, {key_a});
+  expectSignatories("b@test", 1, {key_b});
+}
+
+/**
+ * @given cached role permissions of an account
+ * @when a block changing its signatories and creating a role is applied
+ * @then the role permissions stay cached
+ */
+TEST_F(WsvCacheTest, RolePermissionsSurviveOtherCommands) {
+  using shared_model::interface::RolePermissionSet;
+  using shared_model::interface::permissions::Role;
+  const RolePermissionSet permissions{Role::kGetBlocks, Role::kTransfer};
+  cache.putRolePermissions("a@test", permissions, cache.generation());
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("a@test")
+                .addSignatory("a@test", PublicKeyHexStringView{key_b})
+                .createRole("new_role", RolePermissionSet{Role::kRoot})
+                .build();
+  cache.applyBlock(*createBlock({tx}));
+
+  auto cached = cache.getRolePermissions("a@test");
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(*cached, permissions);
+  EXPECT_FALSE(cache.getSignatories("a@test"));
+}
+
+/**
+ * @given role permissions read before a block was committed
+ * @when they are put to the cache
+ * @then they are ignored
+ */
+TEST_F(WsvCacheTest, StaleRolePermissionsAreIgnored) {
+  auto generation = cache.generation();
+  cache.applyBlock(*createBlock({}));
+  cache.putRolePermissions(
+      "a@test", shared_model::interface::RolePermissionSet{}, generation);
+
+  EXPECT_FALSE(cache.getRolePermissions("a@test"));
+}
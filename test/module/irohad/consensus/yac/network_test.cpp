@@ -18,6 +18,7 @@
 
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::InvokeWithoutArgs;
 using ::testing::Return;
 using ::testing::SaveArg;
@@ -51,7 +52,8 @@ namespace iroha {
           network = std::make_shared<NetworkImpl>(
               async_call,
               std::unique_ptr<NetworkImpl::ClientFactory>(mock_client_factory_),
-              getTestLogger("YacNetwork"));
+              getTestLogger("YacNetwork"),
+              true);
 
           message.hash.vote_hashes.proposal_hash = "proposal";
           message.hash.vote_hashes.block_hash = "block";
@@ -67,6 +69,25 @@ namespace iroha {
           peer = makePeer(std::string(default_ip) + ":" + std::to_string(port));
         }
 
+        /// Votes of several peers for the same hash as the message
+        std::vector<VoteMessage> makeCommit() {
+          using namespace shared_model::interface::types;
+          std::vector<VoteMessage> votes;
+          for (auto public_key : {"0a0a", "0b0b", "0c0c"}) {
+            auto vote = message;
+            vote.signature = createSig(PublicKeyHexStringView{public_key},
+                                       SignedHexStringView{"1a1a"});
+            vote.hash.block_signature =
+                createSig(PublicKeyHexStringView{public_key},
+                          SignedHexStringView{"2a2a"});
+            votes.push_back(vote);
+          }
+          // block signed by another peer
+          votes.back().hash.block_signature = createSig(
+              PublicKeyHexStringView{"0d0d"}, SignedHexStringView{"2b2b"});
+          return votes;
+        }
+
         iroha::network::MockClientFactory<NetworkImpl::Service>
             *mock_client_factory_;
         std::shared_ptr<MockYacNetworkNotifications> notifications;
@@ -96,6 +117,68 @@ namespace iroha {
         ASSERT_EQ(request.votes_size(), 1);
       }
 
+      /**
+       * @given initialized network
+       * @when send votes of several peers for the same hash
+       * @then the votes are sent as a commit certificate, from which the same
+       * votes are restored
+       */
+      TEST_F(YacNetworkTest, CommitSentAsCertificate) {
+        proto::State request;
+        auto r = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        expectConnection(*peer, [&request, &r](auto &stub) {
+          EXPECT_CALL(stub, AsyncSendStateRaw(_, _, _))
+              .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+        });
+        auto commit = makeCommit();
+
+        network->sendState(*peer, commit);
+
+        ASSERT_EQ(request.votes_size(), 0);
+        ASSERT_TRUE(request.has_certificate());
+        auto votes = PbConverters::expandCertificate(request.certificate());
+        ASSERT_EQ(votes.size(), commit.size());
+        for (size_t i = 0; i < commit.size(); ++i) {
+          auto vote = PbConverters::deserializeVote(
+              votes[i], getTestLogger("PbConverters"));
+          ASSERT_TRUE(vote);
+          EXPECT_EQ(vote->hash, commit[i].hash);
+          EXPECT_EQ(vote->signature->publicKey(),
+                    commit[i].signature->publicKey());
+          EXPECT_EQ(vote->signature->signedData(),
+                    commit[i].signature->signedData());
+          EXPECT_EQ(vote->hash.block_signature->publicKey(),
+                    commit[i].hash.block_signature->publicKey());
+          EXPECT_EQ(vote->hash.block_signature->signedData(),
+                    commit[i].hash.block_signature->signedData());
+        }
+      }
+
+      /**
+       * @given initialized network
+       * @when request with a commit certificate is received
+       * @then the votes of the certificate are handled
+       */
+      TEST_F(YacNetworkTest, CertificateHandled) {
+        proto::State request;
+        grpc::ServerContext context;
+        auto commit = makeCommit();
+        *request.mutable_certificate() =
+            *PbConverters::serializeCertificate(commit);
+        EXPECT_CALL(*notifications, onState(_))
+            .WillOnce(Invoke([&commit](auto state) {
+              ASSERT_EQ(state.size(), commit.size());
+              for (size_t i = 0; i < commit.size(); ++i) {
+                EXPECT_EQ(state[i].signature->publicKey(),
+                          commit[i].signature->publicKey());
+              }
+            }));
+
+        auto response = network->SendState(&context, &request, nullptr);
+        ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+      }
+
       /**
        * @given initialized network
        * @when send request with one vote
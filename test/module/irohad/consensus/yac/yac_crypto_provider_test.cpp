@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/thread_pool.hpp"
 #include "consensus/yac/outcome_messages.hpp"
 #include "framework/test_logger.hpp"
 #include "interfaces/common_objects/string_view_types.hpp"
@@ -25,6 +26,25 @@ namespace iroha {
   namespace consensus {
     namespace yac {
 
+      /// Crypto provider which counts the verified signatures
+      class CountingCryptoProvider : public CryptoProviderImpl {
+       public:
+        using CryptoProviderImpl::CryptoProviderImpl;
+
+        size_t verified_signatures{0};
+
+       protected:
+        iroha::expected::Result<
+            void,
+            shared_model::crypto::CryptoVerifier::BatchErrors>
+        verifySignatures(
+            const std::vector<shared_model::crypto::CryptoVerifier::BatchEntry>
+                &entries) override {
+          verified_signatures += entries.size();
+          return CryptoProviderImpl::verifySignatures(entries);
+        }
+      };
+
       class YacCryptoProviderTest : public ::testing::Test {
        public:
         YacCryptoProviderTest()
@@ -78,6 +98,111 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify({vote}));
       }
 
+      /**
+       * @given votes of several peers, which are verified once
+       * @when the same votes are verified again along with a changed vote
+       * @then the changed vote fails verification, although the signature is
+       * cached for the original one
+       */
+      TEST_F(YacCryptoProviderTest, CachedSignatureDoesNotMatchChangedVote) {
+        std::vector<VoteMessage> votes;
+        for (size_t i = 0; i < 10; ++i) {
+          YacHash hash(Round{1, 1}, "1", "1");
+          hash.block_signature = makeSignature();
+          votes.push_back(
+              CryptoProviderImpl(shared_model::crypto::
+                                     DefaultCryptoAlgorithmType::
+                                         generateKeypair(),
+                                 getTestLogger("CryptoProviderImpl"))
+                  .getVote(hash));
+        }
+        ASSERT_TRUE(crypto_provider->verify(votes));
+        ASSERT_TRUE(crypto_provider->verify(votes));
+
+        votes.back().hash.vote_hashes.block_hash = "hash changed";
+        ASSERT_FALSE(crypto_provider->verify(votes));
+      }
+
+      /**
+       * @given crypto provider which remembers a single verified vote
+       * @when more votes are verified than it remembers
+       * @then all the votes are still verified correctly
+       */
+      TEST_F(YacCryptoProviderTest, VerifiesVotesEvictedFromCache) {
+        CryptoProviderImpl provider(
+            keypair, getTestLogger("CryptoProviderImpl"), nullptr, 1);
+        std::vector<VoteMessage> votes;
+        for (size_t i = 0; i < 3; ++i) {
+          YacHash hash(Round{1, i}, "1", "1");
+          hash.block_signature = makeSignature();
+          votes.push_back(provider.getVote(hash));
+        }
+        ASSERT_TRUE(provider.verify(votes));
+
+        votes.front().hash.vote_hashes.proposal_hash = "hash changed";
+        ASSERT_FALSE(provider.verify(votes));
+      }
+
+      /**
+       * @given votes of several peers, which are verified once
+       * @when the same votes are verified again along with a new vote
+       * @then only the signature of the new vote is verified
+       */
+      TEST_F(YacCryptoProviderTest, CachedVotesAreNotVerifiedAgain) {
+        CountingCryptoProvider provider(keypair,
+                                        getTestLogger("CryptoProviderImpl"));
+        auto make_vote = [this](size_t reject_round) {
+          YacHash hash(Round{1, reject_round}, "1", "1");
+          hash.block_signature = makeSignature();
+          return CryptoProviderImpl(shared_model::crypto::
+                                        DefaultCryptoAlgorithmType::
+                                            generateKeypair(),
+                                    getTestLogger("CryptoProviderImpl"))
+              .getVote(hash);
+        };
+        std::vector<VoteMessage> votes;
+        for (size_t i = 0; i < 5; ++i) {
+          votes.push_back(make_vote(i));
+        }
+        ASSERT_TRUE(provider.verify(votes));
+        EXPECT_EQ(provider.verified_signatures, votes.size());
+
+        ASSERT_TRUE(provider.verify(votes));
+        EXPECT_EQ(provider.verified_signatures, votes.size());
+
+        votes.push_back(make_vote(votes.size()));
+        ASSERT_TRUE(provider.verify(votes));
+        EXPECT_EQ(provider.verified_signatures, votes.size());
+      }
+
+      /**
+       * @given crypto provider with a verification pool
+       * @when more votes are verified than a single thread verifies
+       * @then valid votes pass verification and a changed one fails
+       */
+      TEST_F(YacCryptoProviderTest, VerifiesVotesOnPool) {
+        auto pool = std::make_shared<iroha::ThreadPool>(3);
+        std::vector<VoteMessage> votes;
+        for (size_t i = 0;
+             i < 3 * shared_model::crypto::CryptoVerifier::
+                         kMinBatchEntriesPerThread;
+             ++i) {
+          YacHash hash(Round{1, i}, "1", "1");
+          hash.block_signature = makeSignature();
+          votes.push_back(crypto_provider->getVote(hash));
+        }
+
+        // own votes are cached by the signing provider, so others verify them
+        ASSERT_TRUE(CryptoProviderImpl(
+                        keypair, getTestLogger("CryptoProviderImpl"), pool)
+                        .verify(votes));
+
+        votes.back().hash.vote_hashes.block_hash = "hash changed";
+        ASSERT_FALSE(CryptoProviderImpl(
+                         keypair, getTestLogger("CryptoProviderImpl"), pool)
+                         .verify(votes));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
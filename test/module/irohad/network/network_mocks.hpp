@@ -52,6 +52,13 @@ namespace iroha {
                                            std::string>(
                        const shared_model::interface::types::HeightType,
                        shared_model::interface::types::PublicKeyHexStringView));
+      MOCK_METHOD3(retrieveBlocks,
+                   iroha::expected::Result<rxcpp::observable<std::shared_ptr<
+                                               shared_model::interface::Block>>,
+                                           std::string>(
+                       const shared_model::interface::types::HeightType,
+                       const shared_model::interface::types::HeightType,
+                       shared_model::interface::types::PublicKeyHexStringView));
       MOCK_METHOD2(retrieveBlock,
                    iroha::expected::Result<
                        std::unique_ptr<shared_model::interface::Block>,
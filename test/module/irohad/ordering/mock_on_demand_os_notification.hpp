@@ -20,6 +20,10 @@ namespace iroha {
         MOCK_METHOD1(onRequestProposal,
                      boost::optional<std::shared_ptr<const ProposalType>>(
                          consensus::Round));
+
+        MOCK_METHOD1(hasBatches,
+                     std::vector<bool>(
+                         const std::vector<shared_model::crypto::Hash> &));
       };
 
     }  // namespace transport
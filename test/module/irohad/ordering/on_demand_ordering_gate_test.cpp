@@ -31,7 +31,9 @@ using namespace framework::test_subscriber;
 using ::testing::_;
 using ::testing::AtMost;
 using ::testing::ByMove;
+using ::testing::ElementsAre;
 using ::testing::get;
+using ::testing::Invoke;
 using ::testing::InvokeArgument;
 using ::testing::NiceMock;
 using ::testing::Return;
@@ -51,10 +53,14 @@ class OnDemandOrderingGateTest : public ::testing::Test {
     proposal_creation_strategy =
         std::make_shared<MockProposalCreationStrategy>();
     ON_CALL(*tx_cache,
-            check(testing::Matcher<const shared_model::crypto::Hash &>(_)))
-        .WillByDefault(
-            Return(boost::make_optional<ametsuchi::TxCacheStatusType>(
-                iroha::ametsuchi::tx_cache_status_responses::Missing())));
+            check(testing::Matcher<
+                  const std::vector<shared_model::crypto::Hash> &>(_)))
+        .WillByDefault(Invoke([](const auto &hashes) {
+          return boost::make_optional(
+              ametsuchi::TxPresenceCache::BatchStatusCollectionType(
+                  hashes.size(),
+                  iroha::ametsuchi::tx_cache_status_responses::Missing())));
+        }));
     ordering_gate = std::make_shared<OnDemandOrderingGate>(
         ordering_service,
         std::unique_ptr<OdOsNotification>(notification),
@@ -276,9 +282,12 @@ TEST_F(OnDemandOrderingGateTest, ReplayedTransactionInProposal) {
   EXPECT_CALL(*notification, onRequestProposal(round))
       .WillOnce(Return(ByMove(std::move(arriving_proposal))));
   EXPECT_CALL(*tx_cache,
-              check(testing::Matcher<const shared_model::crypto::Hash &>(_)))
-      .WillOnce(Return(boost::make_optional<ametsuchi::TxCacheStatusType>(
-          iroha::ametsuchi::tx_cache_status_responses::Committed())));
+              check(testing::Matcher<
+                    const std::vector<shared_model::crypto::Hash> &>(
+                  ElementsAre(hash))))
+      .WillOnce(Return(boost::make_optional(
+          ametsuchi::TxPresenceCache::BatchStatusCollectionType(
+              1, iroha::ametsuchi::tx_cache_status_responses::Committed()))));
   // expect proposal to be created without any transactions because it was
   // removed by tx cache
   auto ufactory_proposal = std::make_unique<MockProposal>();
@@ -333,9 +342,11 @@ TEST_F(OnDemandOrderingGateTest, RepeatedTransactionInProposal) {
   EXPECT_CALL(*notification, onRequestProposal(round))
       .WillOnce(Return(ByMove(std::move(arriving_proposal))));
   EXPECT_CALL(*tx_cache,
-              check(testing::Matcher<const shared_model::crypto::Hash &>(_)))
-      .WillRepeatedly(Return(boost::make_optional<ametsuchi::TxCacheStatusType>(
-          iroha::ametsuchi::tx_cache_status_responses::Missing())));
+              check(testing::Matcher<
+                    const std::vector<shared_model::crypto::Hash> &>(_)))
+      .WillOnce(Return(boost::make_optional(
+          ametsuchi::TxPresenceCache::BatchStatusCollectionType(
+              2, iroha::ametsuchi::tx_cache_status_responses::Missing()))));
 
   auto ufactory_proposal = std::make_unique<MockProposal>();
   auto factory_proposal = ufactory_proposal.get();
@@ -5,6 +5,9 @@
 
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 
+#include <future>
+
+#include <grpcpp/alarm.h>
 #include <gtest/gtest.h>
 #include "backend/protobuf/proposal.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
@@ -23,6 +26,8 @@ using namespace iroha::ordering::transport;
 using grpc::testing::MockClientAsyncResponseReader;
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
+using ::testing::InvokeWithoutArgs;
 using ::testing::Return;
 using ::testing::SaveArg;
 using ::testing::SetArgPointee;
@@ -48,6 +53,8 @@ class OnDemandOsClientGrpcTest : public ::testing::Test {
     async_call =
         std::make_shared<network::AsyncGrpcClient<google::protobuf::Empty>>(
             getTestLogger("AsyncCall"));
+    announce_call = std::make_shared<OnDemandOsClientGrpc::AnnounceCallType>(
+        getTestLogger("AnnounceCall"));
     auto validator = std::make_unique<MockProposalValidator>();
     proposal_validator = validator.get();
     auto proto_validator = std::make_unique<MockProtoProposalValidator>();
@@ -57,6 +64,7 @@ class OnDemandOsClientGrpcTest : public ::testing::Test {
     client =
         std::make_shared<OnDemandOsClientGrpc>(std::move(ustub),
                                                async_call,
+                                               announce_call,
                                                proposal_factory,
                                                [&] { return timepoint; },
                                                timeout,
@@ -64,7 +72,51 @@ class OnDemandOsClientGrpcTest : public ::testing::Test {
   }
 
   proto::MockOnDemandOrderingStub *stub;
+  /**
+   * Expect an announcement of batches and complete it with given status and
+   * response
+   * @param announcement - announcement request to be saved
+   * @param status - status of the call
+   * @param response - response of the peer
+   */
+  void expectAnnouncement(proto::BatchesAnnouncement &announcement,
+                          grpc::Status status,
+                          proto::BatchesAnnouncementResponse response) {
+    // the reader is deleted by the client on call completion
+    auto reader = new MockClientAsyncResponseReader<
+        proto::BatchesAnnouncementResponse>();
+    EXPECT_CALL(*stub, AsyncAnnounceBatchesRaw(_, _, _))
+        .WillOnce(DoAll(SaveArg<1>(&announcement), Return(reader)));
+    EXPECT_CALL(*reader, Finish(_, _, _))
+        .WillOnce(Invoke([this, status, response](auto *r, auto *s, auto tag) {
+          *r = response;
+          *s = status;
+          alarm.Set(&announce_call->cq_, std::chrono::system_clock::now(), tag);
+        }));
+  }
+
+  /**
+   * @return collection with batches of a single transaction with given
+   * creators
+   */
+  static OdOsNotification::CollectionType makeBatches(
+      const std::vector<std::string> &creators) {
+    OdOsNotification::CollectionType collection;
+    for (const auto &creator : creators) {
+      protocol::Transaction tx;
+      tx.mutable_payload()->mutable_reduced_payload()->set_creator_account_id(
+          creator);
+      collection.push_back(
+          std::make_unique<shared_model::interface::TransactionBatchImpl>(
+              shared_model::interface::types::SharedTxsCollectionType{
+                  std::make_unique<shared_model::proto::Transaction>(tx)}));
+    }
+    return collection;
+  }
+
   std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>> async_call;
+  std::shared_ptr<OnDemandOsClientGrpc::AnnounceCallType> announce_call;
+  grpc::Alarm alarm;
   OnDemandOsClientGrpc::TimepointType timepoint;
   std::chrono::milliseconds timeout{1};
   std::shared_ptr<OnDemandOsClientGrpc> client;
@@ -77,33 +129,71 @@ class OnDemandOsClientGrpcTest : public ::testing::Test {
 
 /**
  * @given client
- * @when onBatches is called
- * @then data is correctly serialized and sent
+ * @when onBatches is called with two batches
+ * AND the peer reports the second one as missing
+ * @then hashes of both batches are announced
+ * AND only the second one is serialized and sent
  */
 TEST_F(OnDemandOsClientGrpcTest, onBatches) {
+  auto collection = makeBatches({"known", "missing"});
+  auto known_hash = collection.at(0)->transactions().at(0)->hash();
+
+  proto::BatchesAnnouncement announcement;
+  proto::BatchesAnnouncementResponse response;
+  response.add_missing_batches(1);
+  expectAnnouncement(announcement, grpc::Status::OK, response);
+
   proto::BatchesRequest request;
+  std::promise<void> sent;
   auto r = std::make_unique<
       MockClientAsyncResponseReader<google::protobuf::Empty>>();
   EXPECT_CALL(*stub, AsyncSendBatchesRaw(_, _, _))
-      .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+      .WillOnce(DoAll(SaveArg<1>(&request),
+                      InvokeWithoutArgs([&sent] { sent.set_value(); }),
+                      Return(r.get())));
 
-  OdOsNotification::CollectionType collection;
-  auto creator = "test";
-  protocol::Transaction tx;
-  tx.mutable_payload()->mutable_reduced_payload()->set_creator_account_id(
-      creator);
-  collection.push_back(
-      std::make_unique<shared_model::interface::TransactionBatchImpl>(
-          shared_model::interface::types::SharedTxsCollectionType{
-              std::make_unique<shared_model::proto::Transaction>(tx)}));
   client->onBatches(std::move(collection));
 
+  ASSERT_EQ(sent.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  ASSERT_EQ(announcement.batch_hashes_size(), 2);
+  ASSERT_EQ(shared_model::crypto::Hash(announcement.batch_hashes(0)),
+            known_hash);
+  ASSERT_EQ(request.transactions_size(), 1);
   ASSERT_EQ(request.transactions()
                 .Get(0)
                 .payload()
                 .reduced_payload()
                 .creator_account_id(),
-            creator);
+            "missing");
+}
+
+/**
+ * @given client
+ * @when onBatches is called
+ * AND the announcement fails
+ * @then all batches are serialized and sent
+ */
+TEST_F(OnDemandOsClientGrpcTest, onBatchesAnnouncementFailed) {
+  proto::BatchesAnnouncement announcement;
+  expectAnnouncement(announcement,
+                     grpc::Status(grpc::StatusCode::UNIMPLEMENTED, ""),
+                     proto::BatchesAnnouncementResponse{});
+
+  proto::BatchesRequest request;
+  std::promise<void> sent;
+  auto r = std::make_unique<
+      MockClientAsyncResponseReader<google::protobuf::Empty>>();
+  EXPECT_CALL(*stub, AsyncSendBatchesRaw(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&request),
+                      InvokeWithoutArgs([&sent] { sent.set_value(); }),
+                      Return(r.get())));
+
+  client->onBatches(makeBatches({"first", "second"}));
+
+  ASSERT_EQ(sent.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  ASSERT_EQ(request.transactions_size(), 2);
 }
 
 /**
@@ -106,6 +106,76 @@ TEST_F(OnDemandOsServerGrpcTest, SendBatches) {
             creator);
 }
 
+/**
+ * @given server
+ * @when batches are announced
+ * AND one of them is known to the ordering service
+ * @then positions of the other ones are returned
+ */
+TEST_F(OnDemandOsServerGrpcTest, AnnounceBatches) {
+  shared_model::crypto::Hash hash1(std::string(32, '1')),
+      hash2(std::string(32, '2')), hash3(std::string(32, '3'));
+  EXPECT_CALL(*notification,
+              hasBatches(std::vector<shared_model::crypto::Hash>{
+                  hash1, hash2, hash3}))
+      .WillOnce(Return(std::vector<bool>{false, true, false}));
+  proto::BatchesAnnouncement request;
+  for (const auto &hash : {hash1, hash2, hash3}) {
+    request.add_batch_hashes(shared_model::crypto::toBinaryString(hash));
+  }
+  proto::BatchesAnnouncementResponse response;
+
+  server->AnnounceBatches(nullptr, &request, &response);
+
+  ASSERT_EQ(response.missing_batches_size(), 2);
+  ASSERT_EQ(response.missing_batches(0), 0);
+  ASSERT_EQ(response.missing_batches(1), 2);
+}
+
+/**
+ * @given server
+ * @when batches with hashes of a wrong size are announced
+ * @then only the hashes of the right size are looked up
+ * AND the other ones are reported missing
+ */
+TEST_F(OnDemandOsServerGrpcTest, AnnounceBatchesWithWrongSizedHashes) {
+  shared_model::crypto::Hash hash(std::string(32, '1'));
+  EXPECT_CALL(*notification,
+              hasBatches(std::vector<shared_model::crypto::Hash>{hash}))
+      .WillOnce(Return(std::vector<bool>{true}));
+  proto::BatchesAnnouncement request;
+  request.add_batch_hashes(std::string(33, '2'));
+  request.add_batch_hashes(shared_model::crypto::toBinaryString(hash));
+  request.add_batch_hashes(std::string(31, '3'));
+  proto::BatchesAnnouncementResponse response;
+
+  auto status = server->AnnounceBatches(nullptr, &request, &response);
+
+  ASSERT_TRUE(status.ok());
+  ASSERT_EQ(response.missing_batches_size(), 2);
+  ASSERT_EQ(response.missing_batches(0), 0);
+  ASSERT_EQ(response.missing_batches(1), 2);
+}
+
+/**
+ * @given server
+ * @when more batches than allowed are announced
+ * @then the announcement is rejected without looking the batches up
+ */
+TEST_F(OnDemandOsServerGrpcTest, AnnounceTooManyBatches) {
+  EXPECT_CALL(*notification, hasBatches(_)).Times(0);
+  proto::BatchesAnnouncement request;
+  for (int i = 0; i <= OnDemandOsServerGrpc::kMaxAnnouncedBatches; ++i) {
+    request.add_batch_hashes(std::string(32, '1'));
+  }
+  proto::BatchesAnnouncementResponse response;
+
+  auto status = server->AnnounceBatches(nullptr, &request, &response);
+
+  ASSERT_EQ(status.error_code(), grpc::StatusCode::INVALID_ARGUMENT);
+  ASSERT_EQ(response.missing_batches_size(), 0);
+}
+
 /**
  * @given server
  * @when proposal is requested
@@ -167,6 +167,30 @@ TEST_F(OnDemandOsTest, OverflowRound) {
             (*os->onRequestProposal(target_round))->transactions().size());
 }
 
+/**
+ * @given initialized on-demand OS
+ * @when  send more transactions than the limit one by one
+ * AND initiate next round
+ * @then  proposal consists of the earliest received transactions in the order
+ * of their arrival
+ */
+TEST_F(OnDemandOsTest, ArrivalOrderRound) {
+  auto batches = generateTransactions({1, transaction_limit * 2});
+  for (const auto &batch : batches) {
+    os->onBatches({batch});
+  }
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  const auto &txs = (*proposal)->transactions();
+  ASSERT_EQ(transaction_limit, txs.size());
+  for (size_t i = 0; i < transaction_limit; ++i) {
+    EXPECT_EQ(txs[i].hash(), batches.at(i)->transactions().at(0)->hash());
+  }
+}
+
 /**
  * @given initialized on-demand OS
  * @when  insert commit round and then proposal_limit + 2 reject rounds
@@ -322,6 +346,51 @@ TEST_F(OnDemandOsTest, SeveralTransactionsOneCommited) {
   EXPECT_TRUE(std::find(txs.begin(), txs.end(), batch2_tx) == txs.end());
 }
 
+/**
+ * @given initialized on-demand OS with a batch of two transactions and a
+ * single transaction batch
+ * @when only one transaction of the first batch is committed
+ * @then the whole first batch is removed from the cache @and the second batch
+ * is kept
+ */
+TEST_F(OnDemandOsTest, PartiallyCommittedBatchIsRemoved) {
+  auto batches = generateTransactions({1, 4});
+  auto second_tx = batches.at(1)->transactions().at(0);
+  OnDemandOrderingService::CollectionType collection{
+      std::make_shared<shared_model::interface::TransactionBatchImpl>(
+          shared_model::interface::types::SharedTxsCollectionType{
+              batches.at(0)->transactions().at(0), second_tx}),
+      batches.at(2)};
+  os->onBatches(collection);
+
+  os->onTxsCommitted({second_tx->hash()});
+
+  os->forCachedBatches([&](const auto &cached) {
+    ASSERT_EQ(1, cached.size());
+    EXPECT_EQ(*collection.at(1), **cached.begin());
+  });
+}
+
+/**
+ * @given initialized on-demand OS with a cached batch
+ * @when presence of the cached batch, of another one and of a hash too long
+ * to be a key is checked
+ * @then only the cached batch is reported as present
+ */
+TEST_F(OnDemandOsTest, HasBatches) {
+  auto batches = generateTransactions({1, 3});
+  os->onBatches({batches.at(0)});
+
+  auto present = os->hasBatches({batches.at(0)->transactions().at(0)->hash(),
+                                 batches.at(1)->transactions().at(0)->hash(),
+                                 shared_model::crypto::Hash(std::string(
+                                     shared_model::crypto::HashKey::kMaxSize
+                                         + 1,
+                                     'a'))});
+
+  EXPECT_EQ(present, (std::vector<bool>{true, false, false}));
+}
+
 /**
  * @given initialized on-demand OS with a batch in collection
  * @when the same batch arrives, round is closed, proposal is requested
@@ -0,0 +1,157 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_packing_policies.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/range/adaptor/transformed.hpp>
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ordering;
+
+using BatchesCollectionType = ProposalPackingPolicy::BatchesCollectionType;
+
+class ProposalPackingPolicyTest : public ::testing::Test {
+ protected:
+  /**
+   * Create a batch of transactions of the given creator
+   * @param creator - account id of the creator
+   * @param size - number of transactions in the batch
+   */
+  ProposalPackingPolicy::TransactionBatchType makeBatch(
+      const std::string &creator, size_t size) {
+    shared_model::interface::types::SharedTxsCollectionType txs;
+    for (size_t i = 0; i < size; ++i) {
+      txs.push_back(
+          makePolyTxFromBuilder(TestTransactionBuilder()
+                                    .createdTime(++created_time)
+                                    .creatorAccountId(creator)
+                                    .setAccountQuorum(creator, 1)));
+    }
+    return std::make_shared<shared_model::interface::TransactionBatchImpl>(
+        std::move(txs));
+  }
+
+  /**
+   * @return range over the batches which counts the batches read from it
+   */
+  auto countingRange(const BatchesCollectionType &batches) {
+    return batches
+        | boost::adaptors::transformed(
+               [this](const ProposalPackingPolicy::TransactionBatchType &batch)
+                   -> const ProposalPackingPolicy::TransactionBatchType & {
+                 ++batches_read;
+                 return batch;
+               });
+  }
+
+  shared_model::interface::types::TimestampType created_time = 0;
+  size_t batches_read = 0;
+};
+
+/**
+ * @given batches of 3, 4 and 2 transactions in the order of arrival
+ * @when they are packed by FIFO policy into a proposal of 5 transactions
+ * @then the batch which does not fit is skipped and the later one is taken
+ */
+TEST_F(ProposalPackingPolicyTest, FifoSkipsBatchWhichDoesNotFit) {
+  BatchesCollectionType batches{makeBatch("a@test", 3),
+                                makeBatch("a@test", 4),
+                                makeBatch("a@test", 2)};
+
+  auto packed = FifoProposalPackingPolicy{}.pack(batches, 5);
+
+  EXPECT_EQ(packed, (BatchesCollectionType{batches[0], batches[2]}));
+}
+
+/**
+ * @given four batches of one creator followed by two batches of another one
+ * @when they are packed by round-robin policy into a proposal of 4
+ * transactions
+ * @then the creators get two batches each, taken in turns
+ */
+TEST_F(ProposalPackingPolicyTest, RoundRobinSharesProposal) {
+  BatchesCollectionType batches{makeBatch("a@test", 1),
+                                makeBatch("a@test", 1),
+                                makeBatch("a@test", 1),
+                                makeBatch("a@test", 1),
+                                makeBatch("b@test", 1),
+                                makeBatch("b@test", 1)};
+
+  auto packed = RoundRobinProposalPackingPolicy{}.pack(batches, 4);
+
+  EXPECT_EQ(packed,
+            (BatchesCollectionType{
+                batches[0], batches[4], batches[1], batches[5]}));
+}
+
+/**
+ * @given batches of 1, 2, 3 and 4 transactions in the order of arrival
+ * @when they are packed by best-fit policy into a proposal of 5 transactions
+ * @then the oldest batch and the largest batch which fits are taken
+ */
+TEST_F(ProposalPackingPolicyTest, BestFitFillsProposal) {
+  BatchesCollectionType batches{makeBatch("a@test", 1),
+                                makeBatch("a@test", 2),
+                                makeBatch("a@test", 3),
+                                makeBatch("a@test", 4)};
+
+  auto packed = BestFitProposalPackingPolicy{}.pack(batches, 5);
+
+  EXPECT_EQ(packed, (BatchesCollectionType{batches[0], batches[3]}));
+}
+
+/**
+ * @given ten batches of one transaction
+ * @when they are packed by FIFO policy into a proposal of 2 transactions
+ * @then only the two batches which fill the proposal are read
+ */
+TEST_F(ProposalPackingPolicyTest, FifoStopsReadingWhenFull) {
+  BatchesCollectionType batches;
+  for (size_t i = 0; i < 10; ++i) {
+    batches.push_back(makeBatch("a@test", 1));
+  }
+
+  auto packed = FifoProposalPackingPolicy{}.pack(countingRange(batches), 2);
+
+  EXPECT_EQ(packed, (BatchesCollectionType{batches[0], batches[1]}));
+  EXPECT_EQ(batches_read, 2u);
+}
+
+/**
+ * @given more batches than a proposal of 1 transaction may consider, none of
+ * which fits into it
+ * @when they are packed by each policy into the proposal
+ * @then the proposal is empty and no more than kBatchesPerTransaction batches
+ * are read
+ */
+TEST_F(ProposalPackingPolicyTest, PoliciesReadBoundedNumberOfBatches) {
+  BatchesCollectionType batches;
+  for (size_t i = 0; i < ProposalPackingPolicy::kBatchesPerTransaction * 2;
+       ++i) {
+    batches.push_back(makeBatch("a@test", 2));
+  }
+
+  for (auto policy : {createProposalPackingPolicy("fifo"),
+                      createProposalPackingPolicy("round_robin"),
+                      createProposalPackingPolicy("best_fit")}) {
+    batches_read = 0;
+    EXPECT_TRUE(policy->pack(countingRange(batches), 1).empty());
+    EXPECT_LE(batches_read, ProposalPackingPolicy::kBatchesPerTransaction);
+  }
+}
+
+/**
+ * @given names of packing policies
+ * @when policies are created by them
+ * @then known names give a policy and an unknown one gives nothing
+ */
+TEST_F(ProposalPackingPolicyTest, CreateByName) {
+  EXPECT_TRUE(createProposalPackingPolicy("fifo"));
+  EXPECT_TRUE(createProposalPackingPolicy("round_robin"));
+  EXPECT_TRUE(createProposalPackingPolicy("best_fit"));
+  EXPECT_FALSE(createProposalPackingPolicy("lifo"));
+}
@@ -16,6 +16,7 @@
 #include "framework/crypto_literals.hpp"
 #include "framework/test_logger.hpp"
 #include "framework/test_subscriber.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/ametsuchi/mock_command_executor.hpp"
 #include "module/irohad/ametsuchi/mock_temporary_factory.hpp"
 #include "module/irohad/network/network_mocks.hpp"
@@ -40,6 +41,7 @@ using ::testing::A;
 using ::testing::ByMove;
 using ::testing::Invoke;
 using ::testing::NiceMock;
+using ::testing::NotNull;
 using ::testing::Return;
 using ::testing::ReturnArg;
 
@@ -179,6 +181,42 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
   EXPECT_TRUE(block_wrapper.validate());
 }
 
+/**
+ * @given proposal which is validated in a complete temporary wsv
+ * @when a block is created from the verified proposal
+ * @then the temporary wsv is prepared for the created block
+ */
+TEST_F(SimulatorTest, PreparesCreatedBlock) {
+  std::vector<shared_model::proto::Transaction> txs = {makeTx()};
+  auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
+  validation_result->verified_proposal =
+      std::make_unique<shared_model::proto::Proposal>(
+          shared_model::proto::ProposalBuilder()
+              .height(2)
+              .createdTime(iroha::time::now())
+              .transactions(txs)
+              .build());
+  auto proposal = validation_result->verified_proposal;
+
+  EXPECT_CALL(*factory, createTemporaryWsv(_))
+      .WillOnce(Return(ByMove(std::make_unique<MockTemporaryWsv>())));
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Invoke([&validation_result](const auto &p, auto &v) {
+        return std::move(validation_result);
+      }));
+  EXPECT_CALL(*crypto_signer, sign(A<shared_model::interface::Block &>()));
+
+  auto verified_proposal = simulator->processProposal(*proposal);
+
+  EXPECT_CALL(*factory, prepareBlock_(NotNull(), _))
+      .WillOnce(Invoke([](auto &, const auto &block) {
+        EXPECT_EQ(block->height(), 2);
+      }));
+  auto block = simulator->processVerifiedProposal(
+      verified_proposal, TopBlockInfo{1, shared_model::crypto::Hash{"hash"}});
+  ASSERT_TRUE(block);
+}
+
 /**
  * Checks, that after failing a certain number of transactions in a proposal,
  * returned verified proposal will have only valid transactions
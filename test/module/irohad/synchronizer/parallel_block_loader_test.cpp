@@ -0,0 +1,180 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/parallel_block_loader.hpp"
+
+#include <thread>
+
+#include <gmock/gmock.h>
+#include "framework/test_logger.hpp"
+#include "module/irohad/network/network_mocks.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::synchronizer;
+using namespace iroha::network;
+using namespace shared_model::interface::types;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+using Chain = rxcpp::observable<BlockPtr>;
+using ChainResult = iroha::expected::Result<Chain, std::string>;
+
+static constexpr HeightType kTopHeight = 10;
+static constexpr HeightType kTargetHeight = 30;
+static constexpr size_t kRangeSize = 4;
+
+class ParallelBlockLoaderTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    block_loader = std::make_shared<MockBlockLoader>();
+    loader = std::make_shared<ParallelBlockLoader>(
+        block_loader,
+        kRangeSize,
+        2,
+        std::chrono::milliseconds(100),
+        getTestLogger("ParallelBlockLoader"));
+  }
+
+  static BlockPtr makeBlock(HeightType height) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    return block;
+  }
+
+  /// Honest peer, which provides all the requested blocks
+  static ChainResult provide(HeightType height,
+                             HeightType end_height,
+                             PublicKeyHexStringView) {
+    std::vector<BlockPtr> blocks;
+    for (auto block_height = height + 1; block_height <= end_height;
+         ++block_height) {
+      blocks.push_back(makeBlock(block_height));
+    }
+    return iroha::expected::makeValue(
+        rxcpp::observable<>::iterate(std::move(blocks)).as_dynamic());
+  }
+
+  /// Honest peer, which lets the other peer take a range first
+  static ChainResult provideLater(HeightType height,
+                                  HeightType end_height,
+                                  PublicKeyHexStringView key) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    return provide(height, end_height, key);
+  }
+
+  /// Peer which does not send anything until it is unsubscribed
+  static ChainResult stall(HeightType, HeightType, PublicKeyHexStringView) {
+    return iroha::expected::makeValue(
+        rxcpp::observable<>::create<BlockPtr>([](auto subscriber) {
+          while (subscriber.is_subscribed()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          }
+          subscriber.on_completed();
+        })
+            .as_dynamic());
+  }
+
+  std::vector<HeightType> download(const PublicKeyCollectionType &peers) {
+    std::vector<HeightType> heights;
+    loader->retrieveBlocks(kTopHeight, kTargetHeight, peers)
+        .as_blocking()
+        .subscribe([&heights](const auto &block) {
+          heights.push_back(block->height());
+        });
+    return heights;
+  }
+
+  static std::vector<HeightType> heightsUpTo(HeightType last) {
+    std::vector<HeightType> heights;
+    for (auto height = kTopHeight + 1; height <= last; ++height) {
+      heights.push_back(height);
+    }
+    return heights;
+  }
+
+  const std::string peer_a = std::string(64, 'a');
+  const std::string peer_b = std::string(64, 'b');
+
+  std::shared_ptr<MockBlockLoader> block_loader;
+  std::shared_ptr<ParallelBlockLoader> loader;
+};
+
+/**
+ * @given two honest peers
+ * @when blocks are downloaded
+ * @then all the blocks are emitted in the order of their heights
+ * @and each request is bounded by the range size
+ */
+TEST_F(ParallelBlockLoaderTest, EmitsBlocksInOrder) {
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
+      .WillRepeatedly(Invoke([](HeightType height,
+                                HeightType end_height,
+                                PublicKeyHexStringView key) {
+        EXPECT_LE(end_height - height, kRangeSize);
+        return provide(height, end_height, key);
+      }));
+
+  EXPECT_EQ(download({peer_a, peer_b}), heightsUpTo(kTargetHeight));
+}
+
+/**
+ * @given a peer which provides only a part of the first range it is asked
+ * for, and an honest peer
+ * @when blocks are downloaded
+ * @then the missing blocks are downloaded from the honest peer
+ */
+TEST_F(ParallelBlockLoaderTest, RequeuesUnfinishedRange) {
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(_, _, PublicKeyHexStringView{peer_a}))
+      .WillOnce(Invoke([](HeightType height,
+                          HeightType end_height,
+                          PublicKeyHexStringView key) {
+        return provide(height, end_height - 1, key);
+      }));
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(_, _, PublicKeyHexStringView{peer_b}))
+      .WillRepeatedly(Invoke(&ParallelBlockLoaderTest::provideLater));
+
+  EXPECT_EQ(download({peer_a, peer_b}), heightsUpTo(kTargetHeight));
+}
+
+/**
+ * @given a peer which does not send blocks, and an honest peer
+ * @when blocks are downloaded
+ * @then the stalled peer is abandoned @and all the blocks are downloaded from
+ * the honest peer
+ */
+TEST_F(ParallelBlockLoaderTest, SwitchesFromStalledPeer) {
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(_, _, PublicKeyHexStringView{peer_a}))
+      .WillOnce(Invoke(&ParallelBlockLoaderTest::stall));
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(_, _, PublicKeyHexStringView{peer_b}))
+      .WillRepeatedly(Invoke(&ParallelBlockLoaderTest::provideLater));
+
+  EXPECT_EQ(download({peer_a, peer_b}), heightsUpTo(kTargetHeight));
+}
+
+/**
+ * @given two peers which have blocks only up to some height
+ * @when blocks are downloaded
+ * @then the consecutive blocks up to that height are emitted
+ * @and the observable completes
+ */
+TEST_F(ParallelBlockLoaderTest, CompletesWhenNoPeerHasBlock) {
+  static constexpr HeightType kPeersTop = kTopHeight + 2 * kRangeSize + 1;
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
+      .WillRepeatedly(Invoke([](HeightType height,
+                                HeightType end_height,
+                                PublicKeyHexStringView key) {
+        return provide(height, std::min(end_height, kPeersTop), key);
+      }));
+
+  EXPECT_EQ(download({peer_a, peer_b}), heightsUpTo(kPeersTop));
+}
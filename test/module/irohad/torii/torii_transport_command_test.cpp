@@ -14,6 +14,7 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "common/thread_pool.hpp"
 #include "endpoint.pb.h"
 #include "endpoint_mock.grpc.pb.h"
 #include "framework/test_logger.hpp"
@@ -90,6 +91,7 @@ class CommandServiceTransportGrpcTest : public testing::Test {
         batch_factory,
         rxcpp::observable<>::iterate(gate_objects),
         gate_objects.size(),
+        nullptr,
         getTestLogger("CommandServiceTransportGrpc"));
   }
 
@@ -247,6 +249,63 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
   transport_grpc->ListTorii(&context, &request, &response);
 }
 
+/**
+ * @given torii service with a validation pool
+ *        and a transaction list large enough to be split between threads
+ *        where two transactions are stateless invalid
+ * @when calling ListTorii
+ * @then the error of the first invalid transaction in the list is published
+ *       for all transactions
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiParallelReportsFirstError) {
+  transport_grpc = std::make_shared<CommandServiceTransportGrpc>(
+      command_service,
+      status_bus,
+      status_factory,
+      transaction_factory,
+      batch_parser,
+      batch_factory,
+      rxcpp::observable<>::iterate(gate_objects),
+      gate_objects.size(),
+      std::make_shared<iroha::ThreadPool>(4),
+      getTestLogger("CommandServiceTransportGrpc"));
+
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+  const size_t kTxs = 100;
+  const size_t kFirstInvalid = 30;
+  const size_t kSecondInvalid = 80;
+
+  iroha::protocol::TxList request{};
+  for (size_t i = 0; i < kTxs; ++i) {
+    auto tx = request.add_transactions();
+    tx->mutable_payload()->mutable_reduced_payload()->set_created_time(i);
+  }
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .WillRepeatedly(Return(std::nullopt));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .WillRepeatedly(Invoke(
+          [&](const shared_model::interface::Transaction &tx)
+              -> std::optional<shared_model::validation::ValidationError> {
+            if (tx.createdTime() == kFirstInvalid
+                or tx.createdTime() == kSecondInvalid) {
+              return shared_model::validation::ValidationError{
+                  "tx " + std::to_string(tx.createdTime()), {}};
+            }
+            return std::nullopt;
+          }));
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(0);
+  EXPECT_CALL(*status_bus, publish(_))
+      .Times(kTxs)
+      .WillRepeatedly(Invoke([&](auto status) {
+        EXPECT_THAT(status->statelessErrorOrCommandName(),
+                    testing::HasSubstr("tx " + std::to_string(kFirstInvalid)));
+      }));
+
+  transport_grpc->ListTorii(&context, &request, &response);
+}
+
 /**
  * @given torii service and command_service with empty status stream
  * @when calling StatusStream on transport
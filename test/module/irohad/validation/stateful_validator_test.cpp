@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 #include "backend/protobuf/proto_proposal_factory.hpp"
 #include "common/result.hpp"
+#include "common/thread_pool.hpp"
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
@@ -351,3 +352,66 @@ TEST_F(Validator, Batches) {
   EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[1].tx_hash,
             txs[4].hash());
 }
+
+/**
+ * @given stateful validator with two workers @and a proposal with two
+ * transactions of one account and an independent transaction of another
+ * account in between, the last transaction being invalid
+ * @when statefully validating the proposal
+ * @then the independent transaction is applied to a separate temporary WSV
+ * @and the verified proposal and errors are the same as of sequential
+ * validation @and the given WSV is marked as incomplete
+ */
+TEST_F(Validator, IndependentTxsValidatedInParallel) {
+  auto other_wsv = std::make_unique<iroha::ametsuchi::MockTemporaryWsv>();
+  auto &other_wsv_ref = *other_wsv;
+  sfv = std::make_shared<StatefulValidatorImpl>(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      parser,
+      getTestLogger("StatefulValidator"),
+      2,
+      [&other_wsv]()
+          -> iroha::expected::Result<
+              std::unique_ptr<iroha::ametsuchi::TemporaryWsv>,
+              std::string> { return std::move(other_wsv); },
+      std::make_shared<iroha::ThreadPool>(1));
+
+  auto make_tx = [](const std::string &account, const std::string &value) {
+    return TestTransactionBuilder()
+        .creatorAccountId(account)
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .setAccountDetail(account, "key", value)
+        .build();
+  };
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(make_tx("doge@master", "1"));
+  txs.push_back(make_tx("cate@master", "2"));
+  txs.push_back(make_tx("doge@master", "3"));
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[0]))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(other_wsv_ref, apply(Eq(ByRef(txs[1]))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[2]))))
+      .WillOnce(Return(iroha::expected::makeError(
+          CommandError{"", sample_error_code, sample_error_extra, true})));
+
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  const auto &verified_txs =
+      verified_proposal_and_errors->verified_proposal->transactions();
+  ASSERT_EQ(verified_txs.size(), 2);
+  EXPECT_EQ(verified_txs[0].hash(), txs[0].hash());
+  EXPECT_EQ(verified_txs[1].hash(), txs[1].hash());
+  ASSERT_EQ(verified_proposal_and_errors->rejected_transactions.size(), 1);
+  EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[0].tx_hash,
+            txs[2].hash());
+  EXPECT_FALSE(verified_proposal_and_errors->temporary_wsv_is_complete);
+}
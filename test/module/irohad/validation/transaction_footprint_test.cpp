@@ -0,0 +1,110 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/transaction_footprint.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::validation;
+
+using Groups = std::vector<std::vector<size_t>>;
+
+namespace {
+  TransactionFootprint makeFootprint(std::vector<std::string> reads,
+                                     std::vector<std::string> writes) {
+    TransactionFootprint footprint;
+    footprint.reads = std::move(reads);
+    footprint.writes = std::move(writes);
+    return footprint;
+  }
+}  // namespace
+
+/**
+ * @given transfer transaction
+ * @when its footprint is built
+ * @then the creator and the asset are read @and both accounts are written
+ */
+TEST(TransactionFootprintTest, TransferAsset) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("alice@test")
+                .transferAsset("alice@test", "bob@test", "coin#test", "", "1.0")
+                .build();
+  TransactionFootprint footprint;
+  footprint.add(tx);
+
+  EXPECT_EQ(footprint.reads,
+            (std::vector<std::string>{"account:alice@test",
+                                      "asset:coin#test"}));
+  EXPECT_EQ(footprint.writes,
+            (std::vector<std::string>{"account:alice@test",
+                                      "account:bob@test"}));
+  EXPECT_FALSE(footprint.global);
+}
+
+/**
+ * @given transaction adding a peer
+ * @when its footprint is built
+ * @then the footprint is global
+ */
+TEST(TransactionFootprintTest, AddPeerIsGlobal) {
+  const std::string peer_key(64, '0');
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("alice@test")
+                .addPeer("127.0.0.1:50541",
+                         shared_model::interface::types::PublicKeyHexStringView{
+                             peer_key})
+                .build();
+  TransactionFootprint footprint;
+  footprint.add(tx);
+
+  EXPECT_TRUE(footprint.global);
+}
+
+/**
+ * @given footprints which share only read keys
+ * @when they are split into groups
+ * @then each footprint forms its own group
+ */
+TEST(TransactionFootprintTest, SharedReadsAreIndependent) {
+  auto groups = splitIntoIndependentGroups(
+      {makeFootprint({"asset:coin#test"}, {"account:a@test"}),
+       makeFootprint({"asset:coin#test"}, {"account:b@test"})});
+
+  EXPECT_EQ(groups, (Groups{{0}, {1}}));
+}
+
+/**
+ * @given footprints where a key is read before and after it is written, and
+ * an unrelated footprint
+ * @when they are split into groups
+ * @then the readers are grouped with the writer @and the unrelated footprint
+ * forms its own group
+ */
+TEST(TransactionFootprintTest, ReadersJoinWriter) {
+  auto groups = splitIntoIndependentGroups(
+      {makeFootprint({"domain:test"}, {"account:a@test"}),
+       makeFootprint({}, {"account:c@other"}),
+       makeFootprint({}, {"domain:test"}),
+       makeFootprint({"domain:test"}, {"account:b@test"})});
+
+  EXPECT_EQ(groups, (Groups{{0, 2, 3}, {1}}));
+}
+
+/**
+ * @given independent footprints and a global one
+ * @when they are split into groups
+ * @then all footprints are in one group
+ */
+TEST(TransactionFootprintTest, GlobalJoinsAll) {
+  auto global = makeFootprint({}, {});
+  global.global = true;
+  auto groups = splitIntoIndependentGroups(
+      {makeFootprint({}, {"account:a@test"}),
+       global,
+       makeFootprint({}, {"account:b@test"})});
+
+  EXPECT_EQ(groups, (Groups{{0, 1, 2}}));
+}
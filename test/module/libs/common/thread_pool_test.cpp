@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_pool.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::ThreadPool;
+
+/**
+ * @given thread pool with several threads
+ * @when tasks are submitted
+ * @then every future holds the result of its own task
+ */
+TEST(ThreadPoolTest, ReturnsResultsOfTasks) {
+  ThreadPool pool(4);
+  ASSERT_EQ(pool.size(), 4);
+
+  std::vector<std::future<size_t>> results;
+  for (size_t i = 0; i < 100; ++i) {
+    results.push_back(pool.submit([i] { return i * i; }));
+  }
+
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(results[i].get(), i * i);
+  }
+}
+
+/**
+ * @given thread pool with a task which throws
+ * @when result of the task is requested
+ * @then the exception is rethrown @and the pool keeps executing tasks
+ */
+TEST(ThreadPoolTest, PropagatesExceptions) {
+  ThreadPool pool(1);
+
+  auto failed = pool.submit([]() -> int { throw std::runtime_error("fail"); });
+  auto succeeded = pool.submit([] { return 1; });
+
+  EXPECT_THROW(failed.get(), std::runtime_error);
+  EXPECT_EQ(succeeded.get(), 1);
+}
+
+/**
+ * @given thread pool with submitted tasks
+ * @when the pool is destroyed
+ * @then all the tasks are executed
+ */
+TEST(ThreadPoolTest, ExecutesPendingTasksOnDestruction) {
+  std::atomic<size_t> executed{0};
+  {
+    ThreadPool pool(2);
+    for (size_t i = 0; i < 50; ++i) {
+      pool.submit([&executed] { ++executed; });
+    }
+  }
+  EXPECT_EQ(executed, 50);
+}
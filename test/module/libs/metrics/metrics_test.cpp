@@ -0,0 +1,233 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+#include "cryptography/hash.hpp"
+#include "framework/result_gtest_checkers.hpp"
+#include "framework/test_logger.hpp"
+#include "metrics/metrics_exporter.hpp"
+#include "metrics/transaction_stages.hpp"
+
+using namespace iroha::metrics;
+
+/**
+ * @given histogram bucket bounds
+ * @when values are put into the buckets
+ * @then each value belongs to the bucket which bounds it, and the bounds are
+ * within 25% of the values
+ */
+TEST(MetricsTest, HistogramBucketsBoundValues) {
+  for (uint64_t value : {0ull,
+                         1ull,
+                         3ull,
+                         4ull,
+                         7ull,
+                         8ull,
+                         9ull,
+                         10ull,
+                         1000ull,
+                         123456789ull,
+                         (1ull << 63) + 1,
+                         ~0ull}) {
+    auto index = Histogram::bucketIndex(value);
+    ASSERT_LT(index, Histogram::kBuckets) << value;
+    EXPECT_LE(value, Histogram::bucketUpperBound(index)) << value;
+    if (index > 0) {
+      EXPECT_GT(value, Histogram::bucketUpperBound(index - 1)) << value;
+    }
+    EXPECT_LE(Histogram::bucketUpperBound(index) - value, value / 4) << value;
+  }
+  EXPECT_EQ(Histogram::bucketUpperBound(Histogram::kBuckets - 1), ~0ull);
+}
+
+/**
+ * @given registry with a counter, a gauge and a histogram
+ * @when the metrics are updated and serialized
+ * @then the text has the values in Prometheus format
+ */
+TEST(MetricsTest, SerializesPrometheusText) {
+  Registry registry;
+  registry.counter("requests_total", "Requests", {{"type", "a\"b"}})
+      .increment(3);
+  registry.gauge("queue_size", "Queue").set(-2);
+  auto &histogram = registry.histogram("latency", "Latency");
+  histogram.observe(1);
+  histogram.observe(5);
+
+  EXPECT_EQ(registry.serialize(),
+            "# HELP latency Latency\n"
+            "# TYPE latency histogram\n"
+            "latency_bucket{le=\"0\"} 0\n"
+            "latency_bucket{le=\"1\"} 1\n"
+            "latency_bucket{le=\"2\"} 1\n"
+            "latency_bucket{le=\"3\"} 1\n"
+            "latency_bucket{le=\"4\"} 1\n"
+            "latency_bucket{le=\"5\"} 2\n"
+            "latency_bucket{le=\"+Inf\"} 2\n"
+            "latency_sum 6\n"
+            "latency_count 2\n"
+            "# HELP queue_size Queue\n"
+            "# TYPE queue_size gauge\n"
+            "queue_size -2\n"
+            "# HELP requests_total Requests\n"
+            "# TYPE requests_total counter\n"
+            "requests_total{type=\"a\\\"b\"} 3\n");
+}
+
+/**
+ * @given registry with a counter
+ * @when the counter is requested again, and a gauge with its name is requested
+ * @then the same counter is returned, and the gauge is not created
+ */
+TEST(MetricsTest, SharesMetricsByName) {
+  Registry registry;
+  auto &counter = registry.counter("name", "help");
+  EXPECT_EQ(&registry.counter("name", "help"), &counter);
+  EXPECT_NE(&registry.counter("name", "help", {{"label", "value"}}), &counter);
+  EXPECT_THROW(registry.gauge("name", "help"), std::invalid_argument);
+}
+
+namespace {
+  /// @return hash of a transaction which is unique for the given seed
+  shared_model::crypto::Hash txHash(const std::string &seed) {
+    return shared_model::crypto::Hash(seed);
+  }
+
+  /// @return number of observations of the histogram
+  uint64_t observations(const Histogram &histogram) {
+    uint64_t count = 0;
+    for (size_t i = 0; i < Histogram::kBuckets; ++i) {
+      count += histogram.bucketCount(i);
+    }
+    return count;
+  }
+}  // namespace
+
+/**
+ * @given transaction stages of a registry with a submitted transaction
+ * @when the transaction finishes some of the stages, skipping one, and an
+ * unknown transaction finishes a stage
+ * @then the time of each finished stage and the total time is observed once
+ * for the submitted transaction, and it is not tracked after the commit
+ */
+TEST(MetricsTest, TransactionStagesObserveFinishedStages) {
+  Registry registry;
+  TransactionStages stages(registry);
+  stages.enable();
+  auto stage_time = [&registry](const std::string &stage) -> Histogram & {
+    return registry.histogram(
+        "iroha_transaction_stage_microseconds", "", {{"stage", stage}});
+  };
+  const auto a = txHash("a"), b = txHash("b");
+
+  stages.submitted(a, std::chrono::steady_clock::now());
+  stages.finished(a, TransactionStages::kStatelessValidation);
+  stages.finished(a, TransactionStages::kProposal);
+  // stages are not observed twice
+  stages.finished(a, TransactionStages::kStatelessValidation);
+  stages.finished(b, TransactionStages::kProposal);
+  EXPECT_EQ(stages.size(), 1u);
+  stages.finished(a, TransactionStages::kCommit);
+
+  EXPECT_EQ(observations(stage_time("stateless_validation")), 1u);
+  EXPECT_EQ(observations(stage_time("ordering")), 0u);
+  EXPECT_EQ(observations(stage_time("proposal")), 1u);
+  EXPECT_EQ(observations(stage_time("commit")), 1u);
+  EXPECT_EQ(observations(registry.histogram(
+                "iroha_transaction_latency_microseconds", "")),
+            1u);
+  EXPECT_EQ(stages.size(), 0u);
+}
+
+/**
+ * @given transaction stages which are not enabled
+ * @when a transaction is submitted and committed
+ * @then it is not tracked and nothing is observed
+ */
+TEST(MetricsTest, TransactionStagesAreOffUntilEnabled) {
+  Registry registry;
+  TransactionStages stages(registry);
+  const auto a = txHash("a");
+
+  stages.submitted(a, std::chrono::steady_clock::now());
+  EXPECT_EQ(stages.size(), 0u);
+  stages.finished(a, TransactionStages::kCommit);
+
+  EXPECT_EQ(observations(registry.histogram(
+                "iroha_transaction_latency_microseconds", "")),
+            0u);
+}
+
+/**
+ * @given transaction stages
+ * @when twice as many transactions as can be tracked are submitted
+ * @then at most the maximal number of them is tracked
+ * AND the first submitted transaction is forgotten
+ * AND the last submitted one is still tracked
+ */
+TEST(MetricsTest, TransactionStagesForgetOldest) {
+  Registry registry;
+  TransactionStages stages(registry);
+  stages.enable();
+  const auto now = std::chrono::steady_clock::now();
+  const size_t submitted = 2 * TransactionStages::kMaxTracked;
+  for (size_t i = 0; i < submitted; ++i) {
+    stages.submitted(txHash(std::to_string(i)), now);
+  }
+
+  EXPECT_LE(stages.size(), TransactionStages::kMaxTracked);
+  stages.finished(txHash("0"), TransactionStages::kCommit);
+  stages.finished(txHash(std::to_string(submitted - 1)),
+                  TransactionStages::kCommit);
+  EXPECT_EQ(observations(registry.histogram(
+                "iroha_transaction_latency_microseconds", "")),
+            1u);
+}
+
+/**
+ * @given metrics exporter of a registry
+ * @when metrics are requested over HTTP
+ * @then the serialized registry is returned
+ */
+TEST(MetricsTest, ExporterServesMetrics) {
+  Registry registry;
+  registry.counter("requests_total", "Requests").increment();
+  auto exporter = MetricsExporter::create(
+      registry, 0, getTestLogger("MetricsExporter"));
+  IROHA_ASSERT_RESULT_VALUE(exporter);
+  auto port = exporter.assumeValue()->port();
+
+  int client = ::socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(port);
+  ASSERT_EQ(::connect(client,
+                      reinterpret_cast<sockaddr *>(&address),
+                      sizeof(address)),
+            0);
+  std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  ASSERT_EQ(::send(client, request.data(), request.size(), 0),
+            static_cast<ssize_t>(request.size()));
+  std::string response;
+  char buffer[1024];
+  ssize_t received;
+  while ((received = ::recv(client, buffer, sizeof(buffer), 0)) > 0) {
+    response.append(buffer, received);
+  }
+  ::close(client);
+
+  EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0u);
+  EXPECT_NE(response.find("\r\n\r\n" + registry.serialize()),
+            std::string::npos);
+}
@@ -6,6 +6,9 @@
 #include "cryptography/blob.hpp"
 #include <gtest/gtest.h>
 #include <memory>
+#include <unordered_set>
+#include "cryptography/hash.hpp"
+#include "cryptography/hash_key.hpp"
 
 using namespace shared_model::crypto;
 using namespace std::literals::string_literals;
@@ -43,3 +46,73 @@ TEST_F(BlobMock, BlobIsString) {
     ASSERT_EQ(binary[i], bin_str[i]);
   }
 }
+
+/**
+ * @given blob which hex representation is already built
+ * @when the blob is copied and another blob is assigned to the copy
+ * @then hex representation of each blob corresponds to its data
+ */
+TEST_F(BlobMock, HexFollowsAssignment) {
+  ASSERT_EQ("48656c6c6f2000576f726c64", blob->hex());
+  Blob copy(*blob);
+  ASSERT_EQ(blob->hex(), copy.hex());
+
+  copy = Blob("ab"s);
+  ASSERT_EQ("6162", copy.hex());
+  ASSERT_EQ("48656c6c6f2000576f726c64", blob->hex());
+}
+
+/**
+ * @given reference to the hex representation of a blob
+ * @when other blobs are copied and moved to the blob
+ * @then the reference stays valid and follows the data of the blob
+ */
+TEST_F(BlobMock, HexReferenceSurvivesAssignment) {
+  const std::string &hex = blob->hex();
+
+  *blob = Blob("ab"s);
+  ASSERT_EQ("6162", blob->hex());
+  ASSERT_EQ("6162", hex);
+
+  Blob other("cd"s);
+  *blob = other;
+  ASSERT_EQ("6364", blob->hex());
+  ASSERT_EQ("6364", hex);
+}
+
+/**
+ * @given hashes of different contents and lengths
+ * @when hash keys are made from them
+ * @then keys are equal only for equal hashes @and keep the hash bytes
+ */
+TEST(HashKeyTest, KeysFollowHashes) {
+  Hash hash(std::string(32, 'a'));
+  Hash other_hash(std::string(32, 'b'));
+  Hash short_hash("a"s);
+
+  ASSERT_EQ(HashKey(hash), HashKey(Hash(std::string(32, 'a'))));
+  ASSERT_NE(HashKey(hash), HashKey(other_hash));
+  ASSERT_NE(HashKey(hash), HashKey(short_hash));
+  ASSERT_EQ(hash.hex(), HashKey(hash).hex());
+  ASSERT_EQ(short_hash.hex(), HashKey(short_hash).hex());
+
+  std::unordered_set<HashKey, HashKey::Hasher> keys{
+      HashKey(hash), HashKey(other_hash), HashKey(short_hash)};
+  ASSERT_EQ(keys.size(), 3);
+  ASSERT_EQ(keys.count(HashKey(Hash(std::string(32, 'b')))), 1);
+}
+
+/**
+ * @given hash longer than a hash key holds
+ * @when a hash key is made from it
+ * @then it is rejected instead of being truncated
+ */
+TEST(HashKeyTest, LongHashIsRejected) {
+  Hash long_hash(std::string(HashKey::kMaxSize + 1, 'a'));
+  Hash hash(std::string(HashKey::kMaxSize, 'a'));
+
+  ASSERT_THROW(HashKey{long_hash}, std::invalid_argument);
+  ASSERT_NO_THROW(HashKey{hash});
+  ASSERT_FALSE(HashKey::fromHash(long_hash));
+  ASSERT_EQ(HashKey::fromHash(hash), HashKey(hash));
+}
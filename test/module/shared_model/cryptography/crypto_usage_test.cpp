@@ -12,6 +12,7 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include "common/thread_pool.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
@@ -232,6 +233,72 @@ TYPED_TEST(CryptoUsageTest, SignAndVerifyTransactionkWithWrongSignature) {
   EXPECT_THAT(this->verify(*this->transaction), kBadSignatureMatcher);
 }
 
+/**
+ * @given a batch of signatures where some of them are made for other data
+ * @when the batch is verified by the calling thread and by a thread pool
+ * @then exactly the wrong signatures are reported in the order of the batch
+ */
+TYPED_TEST(CryptoUsageTest, BatchVerificationReportsFailedEntries) {
+  using namespace shared_model::interface::types;
+  const size_t kBatchSize = 200;
+  const Blob wrong_data{"wrong payload"};
+
+  std::vector<std::string> signatures;
+  std::vector<size_t> wrong_indices;
+  for (size_t i = 0; i < kBatchSize; ++i) {
+    bool wrong = i % 7 == 3;
+    signatures.push_back(TypeParam::sign(
+        wrong ? wrong_data : this->data, this->keypair));
+    if (wrong) {
+      wrong_indices.push_back(i);
+    }
+  }
+  std::vector<CryptoVerifier::BatchEntry> entries;
+  for (const auto &signature : signatures) {
+    entries.push_back({SignedHexStringView{signature},
+                       this->data,
+                       PublicKeyHexStringView{this->keypair.publicKey()}});
+  }
+
+  iroha::ThreadPool pool(3);
+  for (auto *verification_pool : {static_cast<iroha::ThreadPool *>(nullptr),
+                                  &pool}) {
+    auto verified = CryptoVerifier::verifyBatch(entries, verification_pool);
+    IROHA_ASSERT_RESULT_ERROR(verified);
+    std::vector<size_t> failed_indices;
+    for (const auto &error : verified.assumeError()) {
+      failed_indices.push_back(error.first);
+      EXPECT_THAT(error.second, ::testing::HasSubstr("Bad signature"));
+    }
+    EXPECT_EQ(failed_indices, wrong_indices);
+
+    std::vector<CryptoVerifier::BatchEntry> correct_entries(
+        entries.begin(), entries.begin() + wrong_indices.front());
+    IROHA_ASSERT_RESULT_VALUE(
+        CryptoVerifier::verifyBatch(correct_entries, verification_pool));
+  }
+}
+
+/**
+ * @given properly signed block and transaction with a wrong signature
+ * @when their signatures are validated together
+ * @then only the transaction gets an error
+ */
+TYPED_TEST(CryptoUsageTest, BatchSignaturesValidation) {
+  this->signer.sign(*this->block);
+  this->signIncorrect(*this->transaction);
+
+  using SignedData = shared_model::validation::FieldValidator::SignedData;
+  auto errors = this->field_validator_.validateSignatures(
+      {SignedData{this->block->signatures(), this->block->payload()},
+       SignedData{this->transaction->signatures(),
+                  this->transaction->payload()}});
+
+  ASSERT_EQ(errors.size(), 2);
+  EXPECT_EQ(errors[0], std::nullopt);
+  EXPECT_THAT(errors[1], kBadSignatureMatcher);
+}
+
 /**
  * @given a multihash public key of some unknown algorithm
  * @when trying to verify a signature with this public key
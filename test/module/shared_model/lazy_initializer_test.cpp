@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/lazy_initializer.hpp"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using shared_model::detail::LazyInitializer;
+
+/**
+ * @given lazy initializer
+ * @when value is accessed several times
+ * @then generator is invoked once
+ */
+TEST(LazyInitializer, GeneratedOnce) {
+  int calls = 0;
+  auto generate = [&calls] { return ++calls; };
+  LazyInitializer<int> lazy;
+  ASSERT_EQ(lazy.get(generate), 1);
+  ASSERT_EQ(lazy.get(generate), 1);
+  ASSERT_EQ(calls, 1);
+}
+
+/**
+ * @given lazy initializer
+ * @when value is accessed from several threads simultaneously
+ * @then generator is invoked once and all threads get the same value
+ */
+TEST(LazyInitializer, ConcurrentAccess) {
+  std::atomic<int> calls{0};
+  auto generate = [&calls] { return ++calls; };
+  const LazyInitializer<int> lazy;
+  std::vector<std::thread> threads;
+  std::vector<int> values(8);
+  for (size_t i = 0; i < values.size(); ++i) {
+    threads.emplace_back(
+        [&lazy, &values, &generate, i] { values[i] = lazy.get(generate); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(calls, 1);
+  ASSERT_EQ(values, std::vector<int>(values.size(), 1));
+}
+
+/**
+ * @given lazy initializer with a set value
+ * @when the value is invalidated and accessed
+ * @then generator is invoked
+ * AND the value stays at the same address
+ */
+TEST(LazyInitializer, SetAndInvalidate) {
+  int calls = 0;
+  auto generate = [&calls] { return ++calls; };
+  LazyInitializer<int> lazy;
+  lazy.set(5);
+  const int &value = lazy.get(generate);
+  ASSERT_EQ(value, 5);
+  ASSERT_EQ(calls, 0);
+  lazy.invalidate();
+  ASSERT_EQ(lazy.get(generate), 1);
+  ASSERT_EQ(&lazy.get(generate), &value);
+  ASSERT_EQ(value, 1);
+}
+
+/**
+ * @given lazy initializer
+ * @when the generator throws
+ * @then the exception is passed to the caller
+ * AND the value is generated on next access
+ */
+TEST(LazyInitializer, GeneratedAgainAfterException) {
+  LazyInitializer<std::string> lazy;
+  ASSERT_THROW(lazy.get([]() -> std::string {
+    throw std::runtime_error("failed");
+  }),
+               std::runtime_error);
+  ASSERT_EQ(lazy.get([] { return std::string("value"); }), "value");
+}